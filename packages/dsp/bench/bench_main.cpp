@@ -0,0 +1,363 @@
+/**
+ * @file bench_main.cpp
+ * @brief Microbenchmarks for radioform_dsp_process_interleaved / _planar
+ *
+ * Sweeps one parameter at a time around a default configuration (10 peak
+ * bands, 512-frame buffers, 48 kHz, limiter on):
+ *   bands        0 to 10 bands
+ *   filter_type  each radioform_filter_type_t, 10 bands
+ *   buffer_size  16 to 8192 frames
+ *   sample_rate  every rate the driver supports
+ *   feature      bypass, continuous ramping, limiter off, true-peak metering on
+ *   oversampling limiter at 1x, 2x, 4x and 8x (each step adds one half-band
+ *                stage; the table ends with the cost of each stage)
+ * Every case runs through both the interleaved and the planar API.
+ *
+ * Reports ns/frame and realtime factor (median of several trials), plus
+ * cycles, instructions, cache and branch misses per frame when
+ * perf_event_open is available. Results go to stdout (or --output) as
+ * JSON; a readable table goes to stderr.
+ *
+ * Usage: radioform_dsp_bench [--output results.json] [--min-time-ms N] [--quick]
+ */
+
+#include "radioform_dsp.h"
+#include "perf_counters.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+
+// RF_SUPPORTED_SAMPLE_RATES in packages/driver/include/RFSharedAudio.h
+const uint32_t kSampleRates[] = {44100, 48000, 88200, 96000, 176400, 192000};
+
+const uint32_t kBufferSizes[] = {16, 32, 64, 128, 256, 512, 1024, 2048, 4096, 8192};
+
+const uint32_t kOversamplingFactors[] = {1, 2, 4, 8};
+
+const char* const kFilterTypeNames[] = {
+    "peak", "low_shelf", "high_shelf", "low_pass", "high_pass", "notch", "band_pass"
+};
+
+enum class Api { Interleaved, Planar };
+
+struct BenchCase {
+    const char* sweep;
+    Api api = Api::Interleaved;
+    uint32_t num_bands = 10;
+    radioform_filter_type_t filter_type = RADIOFORM_FILTER_PEAK;
+    uint32_t buffer_frames = 512;
+    uint32_t sample_rate = 48000;
+    bool bypass = false;
+    bool ramping = false;
+    bool limiter = true;
+    uint32_t oversampling = 1;
+    bool true_peak = false;
+    bool loudness = false;
+};
+
+struct BenchResult {
+    double ns_per_frame;
+    double realtime_factor;
+    bool has_counters;
+    double cycles_per_frame;
+    double instructions_per_frame;
+    double cache_misses_per_frame;
+    double branch_misses_per_frame;
+};
+
+struct BenchOptions {
+    double min_time_ms = 20.0;
+    int trials = 5;
+};
+
+void make_preset(const BenchCase& c, radioform_preset_t& preset) {
+    radioform_dsp_preset_init_flat(&preset);
+    preset.num_bands = c.num_bands;
+    for (uint32_t b = 0; b < c.num_bands; b++) {
+        // Octave-spaced bands from 31 Hz, like the app's 10-band presets
+        preset.bands[b].frequency_hz = 31.25f * static_cast<float>(1u << b);
+        preset.bands[b].gain_db = (b % 2 == 0) ? 3.0f : -3.0f;
+        preset.bands[b].q_factor = 1.0f;
+        preset.bands[b].type = c.filter_type;
+        preset.bands[b].enabled = true;
+    }
+    preset.preamp_db = -3.0f;
+    preset.limiter_enabled = c.limiter;
+}
+
+BenchResult run_case(const BenchCase& c, const BenchOptions& options, PerfCounters& counters) {
+    radioform_dsp_engine_t* engine = radioform_dsp_create(c.sample_rate);
+    radioform_preset_t preset;
+    make_preset(c, preset);
+    radioform_dsp_apply_preset(engine, &preset);
+    radioform_dsp_set_bypass(engine, c.bypass);
+    radioform_dsp_set_limiter_oversampling(engine, c.oversampling);
+    radioform_dsp_set_true_peak_metering(engine, c.true_peak);
+    radioform_dsp_set_loudness_metering(engine, c.loudness);
+
+    // Input cycled through 1 s of noise so buffers do not repeat exactly
+    const uint32_t n = c.buffer_frames;
+    const size_t pool_frames = std::max<size_t>(c.sample_rate, static_cast<size_t>(n) * 4);
+    std::vector<float> noise(pool_frames * 2);
+    std::mt19937 rng(12345);
+    std::uniform_real_distribution<float> dist(-0.5f, 0.5f);
+    for (float& sample : noise) {
+        sample = dist(rng);
+    }
+    std::vector<float> out(static_cast<size_t>(n) * 2);
+    std::vector<float> in_left(pool_frames), in_right(pool_frames);
+    for (size_t i = 0; i < pool_frames; i++) {
+        in_left[i] = noise[i * 2];
+        in_right[i] = noise[i * 2 + 1];
+    }
+
+    size_t position = 0;
+    uint64_t calls = 0;
+    auto process_once = [&] {
+        if (position + n > pool_frames) {
+            position = 0;
+        }
+        if (c.ramping && c.num_bands > 0) {
+            // A new target every buffer keeps the coefficient ramps running
+            radioform_dsp_update_band_gain(engine, 0, (calls % 2 == 0) ? 6.0f : -6.0f);
+        }
+        if (c.api == Api::Interleaved) {
+            radioform_dsp_process_interleaved(engine, noise.data() + position * 2, out.data(), n);
+        } else {
+            radioform_dsp_process_planar(engine, in_left.data() + position, in_right.data() + position,
+                                         out.data(), out.data() + n, n);
+        }
+        position += n;
+        calls++;
+    };
+
+    using clock = std::chrono::steady_clock;
+
+    // Warm up and size the trials
+    uint64_t calls_per_trial = 1;
+    for (;;) {
+        auto start = clock::now();
+        for (uint64_t i = 0; i < calls_per_trial; i++) process_once();
+        const double ms = std::chrono::duration<double, std::milli>(clock::now() - start).count();
+        if (ms >= options.min_time_ms / 4.0) {
+            calls_per_trial = std::max<uint64_t>(1, static_cast<uint64_t>(
+                static_cast<double>(calls_per_trial) * options.min_time_ms / ms));
+            break;
+        }
+        calls_per_trial *= 2;
+    }
+
+    std::vector<double> ns_per_frame;
+    std::vector<PerfSample> samples;
+    for (int trial = 0; trial < options.trials; trial++) {
+        counters.start();
+        auto start = clock::now();
+        for (uint64_t i = 0; i < calls_per_trial; i++) process_once();
+        const double ns = std::chrono::duration<double, std::nano>(clock::now() - start).count();
+        samples.push_back(counters.stop());
+        ns_per_frame.push_back(ns / static_cast<double>(calls_per_trial * n));
+    }
+    radioform_dsp_destroy(engine);
+
+    // Median trial, with its counters
+    std::vector<int> order(options.trials);
+    for (int i = 0; i < options.trials; i++) order[i] = i;
+    std::sort(order.begin(), order.end(), [&](int a, int b) { return ns_per_frame[a] < ns_per_frame[b]; });
+    const int median = order[options.trials / 2];
+    const double frames = static_cast<double>(calls_per_trial * n);
+
+    BenchResult result;
+    result.ns_per_frame = ns_per_frame[median];
+    result.realtime_factor = 1e9 / (result.ns_per_frame * static_cast<double>(c.sample_rate));
+    result.has_counters = counters.available();
+    result.cycles_per_frame = static_cast<double>(samples[median].cycles) / frames;
+    result.instructions_per_frame = static_cast<double>(samples[median].instructions) / frames;
+    result.cache_misses_per_frame = static_cast<double>(samples[median].cache_misses) / frames;
+    result.branch_misses_per_frame = static_cast<double>(samples[median].branch_misses) / frames;
+    return result;
+}
+
+std::vector<BenchCase> build_cases(bool quick) {
+    std::vector<BenchCase> sweeps;
+
+    for (uint32_t bands = 0; bands <= RADIOFORM_MAX_BANDS; bands++) {
+        BenchCase c{"bands"};
+        c.num_bands = bands;
+        sweeps.push_back(c);
+    }
+    for (int type = 0; type < 7; type++) {
+        BenchCase c{"filter_type"};
+        c.filter_type = static_cast<radioform_filter_type_t>(type);
+        sweeps.push_back(c);
+    }
+    for (uint32_t frames : kBufferSizes) {
+        BenchCase c{"buffer_size"};
+        c.buffer_frames = frames;
+        sweeps.push_back(c);
+    }
+    for (uint32_t rate : kSampleRates) {
+        BenchCase c{"sample_rate"};
+        c.sample_rate = rate;
+        sweeps.push_back(c);
+    }
+    {
+        BenchCase bypass{"feature"};
+        bypass.bypass = true;
+        BenchCase ramping{"feature"};
+        ramping.ramping = true;
+        BenchCase no_limiter{"feature"};
+        no_limiter.limiter = false;
+        BenchCase true_peak{"feature"};
+        true_peak.true_peak = true;
+        BenchCase loudness{"feature"};
+        loudness.loudness = true;
+        sweeps.push_back(BenchCase{"feature"});
+        sweeps.push_back(bypass);
+        sweeps.push_back(ramping);
+        sweeps.push_back(no_limiter);
+        sweeps.push_back(true_peak);
+        sweeps.push_back(loudness);
+    }
+    for (uint32_t factor : kOversamplingFactors) {
+        BenchCase c{"oversampling"};
+        c.oversampling = factor;
+        sweeps.push_back(c);
+    }
+
+    std::vector<BenchCase> cases;
+    for (const BenchCase& c : sweeps) {
+        if (quick && std::strcmp(c.sweep, "bands") == 0 && c.num_bands % 5 != 0) {
+            continue;
+        }
+        for (Api api : {Api::Interleaved, Api::Planar}) {
+            BenchCase with_api = c;
+            with_api.api = api;
+            cases.push_back(with_api);
+        }
+    }
+    return cases;
+}
+
+void write_json(FILE* out, const std::vector<BenchCase>& cases, const std::vector<BenchResult>& results,
+                const radioform_kernel_info_t& kernel, bool counters) {
+    std::fprintf(out, "{\n");
+    std::fprintf(out, "  \"library_version\": \"%s\",\n", radioform_dsp_get_version());
+    std::fprintf(out, "  \"kernel_set\": \"%s\",\n", kernel.kernel_set);
+    std::fprintf(out, "  \"vector_width\": %u,\n", kernel.vector_width);
+    std::fprintf(out, "  \"perf_counters\": %s,\n", counters ? "true" : "false");
+    std::fprintf(out, "  \"results\": [\n");
+    for (size_t i = 0; i < cases.size(); i++) {
+        const BenchCase& c = cases[i];
+        const BenchResult& r = results[i];
+        std::fprintf(out,
+            "    {\"sweep\": \"%s\", \"api\": \"%s\", \"bands\": %u, \"filter_type\": \"%s\", "
+            "\"buffer_frames\": %u, \"sample_rate\": %u, \"bypass\": %s, \"ramping\": %s, "
+            "\"limiter\": %s, \"oversampling\": %u, \"true_peak\": %s, \"loudness\": %s, \"ns_per_frame\": %.3f, \"realtime_factor\": %.1f",
+            c.sweep, c.api == Api::Interleaved ? "interleaved" : "planar", c.num_bands,
+            kFilterTypeNames[c.filter_type], c.buffer_frames, c.sample_rate,
+            c.bypass ? "true" : "false", c.ramping ? "true" : "false", c.limiter ? "true" : "false",
+            c.oversampling, c.true_peak ? "true" : "false", c.loudness ? "true" : "false", r.ns_per_frame, r.realtime_factor);
+        if (r.has_counters) {
+            std::fprintf(out,
+                ", \"cycles_per_frame\": %.2f, \"instructions_per_frame\": %.2f, "
+                "\"cache_misses_per_frame\": %.4f, \"branch_misses_per_frame\": %.4f",
+                r.cycles_per_frame, r.instructions_per_frame,
+                r.cache_misses_per_frame, r.branch_misses_per_frame);
+        }
+        std::fprintf(out, "}%s\n", i + 1 < cases.size() ? "," : "");
+    }
+    std::fprintf(out, "  ]\n}\n");
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    BenchOptions options;
+    const char* output_path = nullptr;
+    bool quick = false;
+
+    for (int i = 1; i < argc; i++) {
+        if (std::strcmp(argv[i], "--output") == 0 && i + 1 < argc) {
+            output_path = argv[++i];
+        } else if (std::strcmp(argv[i], "--min-time-ms") == 0 && i + 1 < argc) {
+            options.min_time_ms = std::max(1.0, std::atof(argv[++i]));
+        } else if (std::strcmp(argv[i], "--quick") == 0) {
+            quick = true;
+            options.min_time_ms = 5.0;
+            options.trials = 3;
+        } else {
+            std::fprintf(stderr, "Usage: %s [--output results.json] [--min-time-ms N] [--quick]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    radioform_dsp_enable_denormal_suppression();
+
+    radioform_kernel_info_t kernel = {};
+    radioform_dsp_engine_t* probe = radioform_dsp_create(48000);
+    radioform_dsp_get_kernel_info(probe, &kernel);
+    radioform_dsp_destroy(probe);
+
+    PerfCounters counters;
+    std::fprintf(stderr, "Radioform DSP %s, kernel set %s, perf counters %s\n",
+                 radioform_dsp_get_version(), kernel.kernel_set,
+                 counters.available() ? "on" : "unavailable");
+    std::fprintf(stderr, "%-12s %-12s %5s %-10s %6s %7s %-22s %10s %10s\n",
+                 "sweep", "api", "bands", "type", "frames", "rate", "flags", "ns/frame", "realtime");
+
+    const std::vector<BenchCase> cases = build_cases(quick);
+    std::vector<BenchResult> results;
+    for (const BenchCase& c : cases) {
+        results.push_back(run_case(c, options, counters));
+        const BenchResult& r = results.back();
+        std::string flags;
+        if (c.bypass) flags += "bypass ";
+        if (c.ramping) flags += "ramping ";
+        flags += c.limiter ? "limiter" : "no-limiter";
+        if (c.oversampling > 1) flags += " " + std::to_string(c.oversampling) + "x";
+        if (c.true_peak) flags += " true-peak";
+        if (c.loudness) flags += " loudness";
+        std::fprintf(stderr, "%-12s %-12s %5u %-10s %6u %7u %-22s %10.2f %9.0fx\n",
+                     c.sweep, c.api == Api::Interleaved ? "interleaved" : "planar", c.num_bands,
+                     kFilterTypeNames[c.filter_type], c.buffer_frames, c.sample_rate, flags.c_str(),
+                     r.ns_per_frame, r.realtime_factor);
+    }
+
+    // Per half-band stage: what each doubling of the limiter rate adds
+    for (Api api : {Api::Interleaved, Api::Planar}) {
+        double previous = -1.0;
+        uint32_t previous_factor = 1;
+        for (size_t i = 0; i < cases.size(); i++) {
+            const BenchCase& c = cases[i];
+            if (std::strcmp(c.sweep, "oversampling") != 0 || c.api != api) {
+                continue;
+            }
+            if (previous >= 0.0) {
+                std::fprintf(stderr, "oversampling stage %ux->%ux (%s): %+.2f ns/frame\n",
+                             previous_factor, c.oversampling,
+                             api == Api::Interleaved ? "interleaved" : "planar",
+                             results[i].ns_per_frame - previous);
+            }
+            previous = results[i].ns_per_frame;
+            previous_factor = c.oversampling;
+        }
+    }
+
+    FILE* out = output_path ? std::fopen(output_path, "w") : stdout;
+    if (!out) {
+        std::fprintf(stderr, "Error: Cannot create %s\n", output_path);
+        return 1;
+    }
+    write_json(out, cases, results, kernel, counters.available());
+    if (out != stdout) {
+        std::fclose(out);
+    }
+    return 0;
+}
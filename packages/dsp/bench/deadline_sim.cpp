@@ -0,0 +1,276 @@
+/**
+ * @file deadline_sim.cpp
+ * @brief Realtime callback deadline simulator
+ *
+ * Drives an engine the way a CoreAudio IO thread does: one callback per
+ * buffer period, woken at absolute deadlines, for buffer sizes from 32 to
+ * 4096 frames. A second thread acts as the UI: slider automation on gains,
+ * frequency, Q and preamp every few milliseconds, and a preset change
+ * every half second.
+ *
+ * Each callback's execution time goes into a histogram, reported as
+ * p50/p99/p99.9/max against the buffer deadline, together with deadline
+ * misses, wake-up jitter and the engine's smoothed cpu_load_percent (which
+ * hides exactly these spikes). Runs headless; on Linux the IO thread asks
+ * for SCHED_FIFO and carries on without it if that is not permitted.
+ *
+ * Usage: radioform_dsp_deadline_sim [--seconds S] [--sample-rate HZ]
+ *                                   [--free-run] [--output results.json]
+ */
+
+#include "radioform_dsp.h"
+#include "latency_histogram.h"
+
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+const uint32_t kBufferSizes[] = {32, 64, 128, 256, 512, 1024, 2048, 4096};
+
+struct SimOptions {
+    double seconds = 2.0;
+    uint32_t sample_rate = 48000;
+    bool free_run = false;  // Back-to-back callbacks instead of waiting for each period
+};
+
+struct SimResult {
+    uint32_t buffer_frames;
+    double deadline_us;
+    LatencyHistogram exec;    // Callback execution time
+    LatencyHistogram wakeup;  // Lateness of each wake-up against its period start
+    uint64_t misses = 0;      // Callbacks that finished after their deadline
+    uint64_t parameter_updates = 0;
+    uint64_t preset_changes = 0;
+    float cpu_load_percent = 0.0f;
+};
+
+void make_presets(std::vector<radioform_preset_t>& presets) {
+    const radioform_filter_type_t types[] = {
+        RADIOFORM_FILTER_PEAK, RADIOFORM_FILTER_LOW_SHELF, RADIOFORM_FILTER_HIGH_SHELF
+    };
+    for (int p = 0; p < 3; p++) {
+        radioform_preset_t preset;
+        radioform_dsp_preset_init_flat(&preset);
+        preset.num_bands = 10;
+        for (uint32_t b = 0; b < preset.num_bands; b++) {
+            preset.bands[b].frequency_hz = 31.25f * static_cast<float>(1u << b);
+            preset.bands[b].gain_db = static_cast<float>((static_cast<int>(b) + p) % 5) * 2.0f - 4.0f;
+            preset.bands[b].q_factor = 0.7f + 0.2f * static_cast<float>(p);
+            preset.bands[b].type = (b == 0) ? RADIOFORM_FILTER_LOW_SHELF
+                                 : (b == 9) ? RADIOFORM_FILTER_HIGH_SHELF : RADIOFORM_FILTER_PEAK;
+            preset.bands[b].enabled = true;
+        }
+        preset.bands[4].type = types[p];
+        preset.preamp_db = -3.0f;
+        preset.limiter_enabled = true;
+        presets.push_back(preset);
+    }
+}
+
+void request_realtime_priority() {
+#if defined(__linux__)
+    sched_param param;
+    param.sched_priority = sched_get_priority_max(SCHED_FIFO);
+    pthread_setschedparam(pthread_self(), SCHED_FIFO, &param);  // Best effort
+#endif
+}
+
+/**
+ * @brief UI thread: slider automation and periodic preset changes
+ */
+void run_parameter_thread(radioform_dsp_engine_t* engine, const std::vector<radioform_preset_t>& presets,
+                          const std::atomic<bool>& running, SimResult& result) {
+    constexpr auto kAutomationInterval = std::chrono::milliseconds(5);
+    constexpr int kUpdatesPerPreset = 100;  // 500 ms
+
+    size_t next_preset = 1;
+    for (uint64_t step = 0; running.load(std::memory_order_relaxed); step++) {
+        const float phase = static_cast<float>(step) * 0.05f;
+        radioform_dsp_update_band_gain(engine, 2, 6.0f * std::sin(phase));
+        radioform_dsp_update_band_frequency(engine, 5, 1000.0f * std::pow(2.0f, std::sin(phase * 0.7f)));
+        radioform_dsp_update_band_q(engine, 6, 1.0f + 0.5f * std::sin(phase * 1.3f));
+        radioform_dsp_update_preamp(engine, -3.0f + std::sin(phase * 0.3f));
+        result.parameter_updates += 4;
+
+        if (step % kUpdatesPerPreset == kUpdatesPerPreset - 1) {
+            radioform_dsp_apply_preset(engine, &presets[next_preset]);
+            next_preset = (next_preset + 1) % presets.size();
+            result.preset_changes++;
+        }
+        std::this_thread::sleep_for(kAutomationInterval);
+    }
+}
+
+void simulate(uint32_t buffer_frames, const SimOptions& options,
+              const std::vector<radioform_preset_t>& presets, SimResult& result) {
+    result.buffer_frames = buffer_frames;
+    const double period_s = static_cast<double>(buffer_frames) / options.sample_rate;
+    result.deadline_us = period_s * 1e6;
+    const auto period = std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(period_s));
+
+    radioform_dsp_engine_t* engine = radioform_dsp_create(options.sample_rate);
+    radioform_dsp_apply_preset(engine, &presets[0]);
+
+    // Device-like input: 10 s of noise played in a loop
+    const size_t loop_frames = static_cast<size_t>(options.sample_rate) * 10;
+    std::vector<float> input(loop_frames * 2);
+    std::mt19937 rng(7);
+    std::uniform_real_distribution<float> dist(-0.3f, 0.3f);
+    for (float& sample : input) {
+        sample = dist(rng);
+    }
+    std::vector<float> output(static_cast<size_t>(buffer_frames) * 2);
+
+    std::atomic<bool> running{true};
+    std::thread ui_thread(run_parameter_thread, engine, std::cref(presets), std::cref(running),
+                          std::ref(result));
+
+    const uint64_t num_callbacks = static_cast<uint64_t>(options.seconds / period_s);
+    size_t position = 0;
+    std::thread io_thread([&] {
+        request_realtime_priority();
+        radioform_dsp_enable_denormal_suppression();
+
+        auto period_start = Clock::now();
+        for (uint64_t i = 0; i < num_callbacks; i++) {
+            if (!options.free_run) {
+                std::this_thread::sleep_until(period_start);
+            }
+            const auto start = Clock::now();
+            if (!options.free_run) {
+                result.wakeup.record(static_cast<uint64_t>(
+                    std::chrono::duration_cast<std::chrono::nanoseconds>(start - period_start).count()));
+            }
+
+            if (position + buffer_frames > loop_frames) {
+                position = 0;
+            }
+            radioform_dsp_process_interleaved(engine, input.data() + position * 2, output.data(), buffer_frames);
+            position += buffer_frames;
+
+            const auto end = Clock::now();
+            result.exec.record(static_cast<uint64_t>(
+                std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count()));
+
+            // The output was due at the end of this period
+            const auto deadline = (options.free_run ? start : period_start) + period;
+            if (end > deadline) {
+                result.misses++;
+            }
+            period_start += period;
+        }
+    });
+
+    io_thread.join();
+    running.store(false);
+    ui_thread.join();
+
+    radioform_stats_t stats;
+    radioform_dsp_get_stats(engine, &stats);
+    result.cpu_load_percent = stats.cpu_load_percent;
+    radioform_dsp_destroy(engine);
+}
+
+double us(uint64_t ns) { return static_cast<double>(ns) / 1000.0; }
+
+// Only sample rates radioform_dsp_create() accepts
+bool parse_sample_rate(const char* text, uint32_t& sample_rate) {
+    const long value = std::atol(text);
+    if (value < 8000 || value > 384000) {
+        return false;
+    }
+    sample_rate = static_cast<uint32_t>(value);
+    return true;
+}
+
+void write_json(FILE* out, const SimOptions& options, const std::vector<SimResult>& results) {
+    std::fprintf(out, "{\n");
+    std::fprintf(out, "  \"library_version\": \"%s\",\n", radioform_dsp_get_version());
+    std::fprintf(out, "  \"sample_rate\": %u,\n", options.sample_rate);
+    std::fprintf(out, "  \"seconds_per_buffer_size\": %.1f,\n", options.seconds);
+    std::fprintf(out, "  \"free_run\": %s,\n", options.free_run ? "true" : "false");
+    std::fprintf(out, "  \"results\": [\n");
+    for (size_t i = 0; i < results.size(); i++) {
+        const SimResult& r = results[i];
+        std::fprintf(out,
+            "    {\"buffer_frames\": %u, \"deadline_us\": %.1f, \"callbacks\": %llu, "
+            "\"p50_us\": %.2f, \"p99_us\": %.2f, \"p999_us\": %.2f, \"max_us\": %.2f, "
+            "\"misses\": %llu, \"wakeup_p99_us\": %.2f, \"wakeup_max_us\": %.2f, "
+            "\"cpu_load_percent\": %.2f, \"parameter_updates\": %llu, \"preset_changes\": %llu}%s\n",
+            r.buffer_frames, r.deadline_us, static_cast<unsigned long long>(r.exec.count()),
+            us(r.exec.percentile(50)), us(r.exec.percentile(99)), us(r.exec.percentile(99.9)),
+            us(r.exec.max()), static_cast<unsigned long long>(r.misses),
+            us(r.wakeup.percentile(99)), us(r.wakeup.max()), r.cpu_load_percent,
+            static_cast<unsigned long long>(r.parameter_updates),
+            static_cast<unsigned long long>(r.preset_changes),
+            i + 1 < results.size() ? "," : "");
+    }
+    std::fprintf(out, "  ]\n}\n");
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    SimOptions options;
+    const char* output_path = nullptr;
+
+    for (int i = 1; i < argc; i++) {
+        if (std::strcmp(argv[i], "--seconds") == 0 && i + 1 < argc) {
+            options.seconds = std::max(0.1, std::atof(argv[++i]));
+        } else if (std::strcmp(argv[i], "--sample-rate") == 0 && i + 1 < argc &&
+                   parse_sample_rate(argv[++i], options.sample_rate)) {
+        } else if (std::strcmp(argv[i], "--free-run") == 0) {
+            options.free_run = true;
+        } else if (std::strcmp(argv[i], "--output") == 0 && i + 1 < argc) {
+            output_path = argv[++i];
+        } else {
+            std::fprintf(stderr, "Usage: %s [--seconds S] [--sample-rate HZ (8000-384000)] "
+                                 "[--free-run] [--output results.json]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    std::vector<radioform_preset_t> presets;
+    make_presets(presets);
+
+    std::fprintf(stderr, "%6s %10s %9s %9s %9s %9s %7s %10s %8s\n",
+                 "frames", "deadline", "p50", "p99", "p99.9", "max", "misses", "wake p99", "cpu %");
+
+    std::vector<SimResult> results(sizeof(kBufferSizes) / sizeof(kBufferSizes[0]));
+    for (size_t i = 0; i < results.size(); i++) {
+        simulate(kBufferSizes[i], options, presets, results[i]);
+        const SimResult& r = results[i];
+        std::fprintf(stderr, "%6u %8.1fus %7.1fus %7.1fus %7.1fus %7.1fus %7llu %8.1fus %8.2f\n",
+                     r.buffer_frames, r.deadline_us, us(r.exec.percentile(50)),
+                     us(r.exec.percentile(99)), us(r.exec.percentile(99.9)), us(r.exec.max()),
+                     static_cast<unsigned long long>(r.misses), us(r.wakeup.percentile(99)),
+                     r.cpu_load_percent);
+    }
+
+    FILE* out = output_path ? std::fopen(output_path, "w") : stdout;
+    if (!out) {
+        std::fprintf(stderr, "Error: Cannot create %s\n", output_path);
+        return 1;
+    }
+    write_json(out, options, results);
+    if (out != stdout) {
+        std::fclose(out);
+    }
+    return 0;
+}
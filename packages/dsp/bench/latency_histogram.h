@@ -0,0 +1,70 @@
+/**
+ * @file latency_histogram.h
+ * @brief Fixed-size log-linear histogram of durations (nanoseconds)
+ *
+ * 32 linear sub-buckets per power of two, so percentiles are within ~3% of
+ * the true value over the full uint64_t range. record() does not allocate
+ * and is cheap enough to call from a simulated audio callback.
+ */
+
+#ifndef RADIOFORM_BENCH_LATENCY_HISTOGRAM_H
+#define RADIOFORM_BENCH_LATENCY_HISTOGRAM_H
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+
+class LatencyHistogram {
+public:
+    static constexpr int kSubBits = 5;
+    static constexpr uint64_t kSubBuckets = 1u << kSubBits;
+    static constexpr int kNumBuckets = 64 * kSubBuckets;
+
+    void record(uint64_t ns) {
+        counts_[index(ns)]++;
+        total_++;
+        max_ = std::max(max_, ns);
+    }
+
+    uint64_t count() const { return total_; }
+    uint64_t max() const { return max_; }
+
+    /**
+     * @brief Value at percentile p (0-100): upper edge of its bucket, capped at max()
+     */
+    uint64_t percentile(double p) const {
+        if (total_ == 0) return 0;
+        const uint64_t rank = std::max<uint64_t>(1, static_cast<uint64_t>(
+            std::ceil(p / 100.0 * static_cast<double>(total_))));
+        uint64_t seen = 0;
+        for (int i = 0; i < kNumBuckets; i++) {
+            seen += counts_[i];
+            if (seen >= rank) {
+                return std::min(upperEdge(i), max_);
+            }
+        }
+        return max_;
+    }
+
+private:
+    static int index(uint64_t v) {
+        if (v < kSubBuckets) return static_cast<int>(v);
+        const int msb = 63 - __builtin_clzll(v);
+        const int shift = msb - kSubBits;
+        return (shift + 1) * static_cast<int>(kSubBuckets) +
+               static_cast<int>((v >> shift) - kSubBuckets);
+    }
+
+    static uint64_t upperEdge(int i) {
+        if (i < static_cast<int>(kSubBuckets)) return static_cast<uint64_t>(i);
+        const int shift = i / static_cast<int>(kSubBuckets) - 1;
+        const uint64_t sub = static_cast<uint64_t>(i) % kSubBuckets + kSubBuckets;
+        return ((sub + 1) << shift) - 1;
+    }
+
+    uint64_t counts_[kNumBuckets] = {};
+    uint64_t total_ = 0;
+    uint64_t max_ = 0;
+};
+
+#endif // RADIOFORM_BENCH_LATENCY_HISTOGRAM_H
@@ -0,0 +1,110 @@
+/**
+ * @file perf_counters.h
+ * @brief Hardware counters around a benchmark run (Linux perf_event_open)
+ *
+ * Counts cycles, instructions, cache misses and branch misses of the
+ * calling thread as one group. Where perf_event_open is unavailable (other
+ * platforms, containers, perf_event_paranoid too high) available() is false
+ * and the benchmark reports timing only.
+ */
+
+#ifndef RADIOFORM_BENCH_PERF_COUNTERS_H
+#define RADIOFORM_BENCH_PERF_COUNTERS_H
+
+#include <cstdint>
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <cstring>
+#endif
+
+struct PerfSample {
+    uint64_t cycles = 0;
+    uint64_t instructions = 0;
+    uint64_t cache_misses = 0;
+    uint64_t branch_misses = 0;
+};
+
+class PerfCounters {
+public:
+    static constexpr int kNumCounters = 4;
+
+    PerfCounters() {
+#if defined(__linux__)
+        const uint64_t configs[kNumCounters] = {
+            PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS,
+            PERF_COUNT_HW_CACHE_MISSES, PERF_COUNT_HW_BRANCH_MISSES
+        };
+        for (int i = 0; i < kNumCounters; i++) {
+            perf_event_attr attr;
+            std::memset(&attr, 0, sizeof(attr));
+            attr.size = sizeof(attr);
+            attr.type = PERF_TYPE_HARDWARE;
+            attr.config = configs[i];
+            attr.disabled = (i == 0) ? 1 : 0;  // The leader starts and stops the group
+            attr.exclude_kernel = 1;
+            attr.exclude_hv = 1;
+            attr.read_format = PERF_FORMAT_GROUP;
+            fds_[i] = static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1,
+                                               i == 0 ? -1 : fds_[0], 0));
+            if (fds_[i] < 0) {
+                close();
+                return;
+            }
+        }
+        available_ = true;
+#endif
+    }
+
+    ~PerfCounters() { close(); }
+
+    PerfCounters(const PerfCounters&) = delete;
+    PerfCounters& operator=(const PerfCounters&) = delete;
+
+    bool available() const { return available_; }
+
+    void start() {
+#if defined(__linux__)
+        if (!available_) return;
+        ioctl(fds_[0], PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+        ioctl(fds_[0], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+#endif
+    }
+
+    PerfSample stop() {
+        PerfSample sample;
+#if defined(__linux__)
+        if (!available_) return sample;
+        ioctl(fds_[0], PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+        uint64_t values[1 + kNumCounters] = {};  // nr, then one value per counter
+        if (read(fds_[0], values, sizeof(values)) == static_cast<ssize_t>(sizeof(values))) {
+            sample.cycles = values[1];
+            sample.instructions = values[2];
+            sample.cache_misses = values[3];
+            sample.branch_misses = values[4];
+        }
+#endif
+        return sample;
+    }
+
+private:
+    void close() {
+#if defined(__linux__)
+        for (int& fd : fds_) {
+            if (fd >= 0) {
+                ::close(fd);
+                fd = -1;
+            }
+        }
+#endif
+        available_ = false;
+    }
+
+    int fds_[kNumCounters] = {-1, -1, -1, -1};
+    bool available_ = false;
+};
+
+#endif // RADIOFORM_BENCH_PERF_COUNTERS_H
@@ -7,7 +7,9 @@
  *
  * Thread Safety:
  * - Engine creation/destruction: NOT thread-safe (call from main thread)
- * - Parameter updates: Thread-safe (can call from any thread)
+ * - Preset apply: Lock-free swap, safe while audio is processing
+ * - Parameter updates: Lock-free, from one control thread at a time; they
+ *   take effect at the start of the next process call
  * - Process function: Realtime-safe (call only from audio thread)
  *
  * Realtime Safety:
@@ -30,6 +32,11 @@ extern "C" {
  */
 typedef struct radioform_dsp_engine radioform_dsp_engine_t;
 
+/**
+ * @brief Opaque handle to a group of engines processed together
+ */
+typedef struct radioform_dsp_engine_group radioform_dsp_engine_group_t;
+
 // ============================================================================
 // Engine Lifecycle
 // ============================================================================
@@ -45,6 +52,33 @@ typedef struct radioform_dsp_engine radioform_dsp_engine_t;
  */
 radioform_dsp_engine_t* radioform_dsp_create(uint32_t sample_rate);
 
+/**
+ * @brief Create a DSP engine for a given channel count
+ *
+ * Every channel runs the same EQ, preamp, DC blocker and limiter with its
+ * own filter state. Stereo engines are identical to radioform_dsp_create();
+ * other counts (mono, quad, 5.1, 7.1, ...) process all channels of a frame
+ * side by side in SIMD lanes. The parallel EQ mode is stereo-only.
+ *
+ * @param sample_rate Sample rate in Hz
+ * @param num_channels Channels per frame (1 to RADIOFORM_MAX_CHANNELS)
+ * @return Pointer to engine instance, or NULL on failure
+ *
+ * @note This function allocates memory. Do NOT call from audio thread.
+ */
+radioform_dsp_engine_t* radioform_dsp_create_with_channels(
+    uint32_t sample_rate,
+    uint32_t num_channels
+);
+
+/**
+ * @brief Get the channel count an engine was created with
+ *
+ * @param engine Engine instance
+ * @return Channels per frame, or 0 if engine is NULL
+ */
+uint32_t radioform_dsp_get_num_channels(const radioform_dsp_engine_t* engine);
+
 /**
  * @brief Destroy a DSP engine instance
  *
@@ -85,15 +119,16 @@ radioform_error_t radioform_dsp_set_sample_rate(
 // ============================================================================
 
 /**
- * @brief Process stereo audio (interleaved format)
+ * @brief Process interleaved audio
  *
  * @param engine Engine instance (must not be NULL)
  * @param input Interleaved input buffer [L0, R0, L1, R1, ...]
  * @param output Interleaved output buffer [L0, R0, L1, R1, ...]
- * @param num_frames Number of stereo frames to process
+ * @param num_frames Number of frames to process
  *
  * @note REALTIME-SAFE: No heap allocations or locks in the processing path
- * @note Buffers must be at least num_frames * 2 samples in size
+ * @note Buffers must be at least num_frames * channels samples in size,
+ *       where channels is radioform_dsp_get_num_channels() (2 by default)
  * @note Input and output may point to the same buffer (in-place processing)
  */
 void radioform_dsp_process_interleaved(
@@ -116,6 +151,8 @@ void radioform_dsp_process_interleaved(
  * @note REALTIME-SAFE: No heap allocations or locks in the processing path
  * @note Buffers must be at least num_frames samples in size
  * @note Input and output may point to the same buffers (in-place processing)
+ * @note Stereo engines only; other engines copy the input through (use
+ *       radioform_dsp_process_channels())
  */
 void radioform_dsp_process_planar(
     radioform_dsp_engine_t* engine,
@@ -126,6 +163,25 @@ void radioform_dsp_process_planar(
     uint32_t num_frames
 );
 
+/**
+ * @brief Process planar audio with any channel count
+ *
+ * @param engine Engine instance (must not be NULL)
+ * @param inputs One input buffer per channel (radioform_dsp_get_num_channels())
+ * @param outputs One output buffer per channel
+ * @param num_frames Number of frames to process per channel
+ *
+ * @note REALTIME-SAFE: No heap allocations or locks in the processing path
+ * @note Input and output may point to the same buffers (in-place processing)
+ * @note The peak statistics follow channels 0 and 1 (mono reports channel 0 twice)
+ */
+void radioform_dsp_process_channels(
+    radioform_dsp_engine_t* engine,
+    const float* const* inputs,
+    float* const* outputs,
+    uint32_t num_frames
+);
+
 // ============================================================================
 // Preset Management (NOT realtime-safe)
 // ============================================================================
@@ -138,8 +194,11 @@ void radioform_dsp_process_planar(
  * @return RADIOFORM_OK on success, error code otherwise
  *
  * @note NOT realtime-safe (recalculates filter coefficients)
+ * @note Safe while audio is processing: the new configuration is swapped in
+ *       whole at the start of the next process call, without locks or
+ *       allocation on the audio thread
  * @note Band coefficients are applied immediately; preamp changes follow smoother settings
- * @note Call this from UI thread, not audio thread
+ * @note Call this from UI thread (the same one that sends parameter updates), not audio thread
  */
 radioform_error_t radioform_dsp_apply_preset(
     radioform_dsp_engine_t* engine,
@@ -175,6 +234,155 @@ void radioform_dsp_preset_init_flat(radioform_preset_t* preset);
  */
 radioform_error_t radioform_dsp_preset_validate(const radioform_preset_t* preset);
 
+// ============================================================================
+// Processing Mode (NOT realtime-safe)
+// ============================================================================
+
+/**
+ * @brief Choose how the EQ bands are executed
+ *
+ * RADIOFORM_EQ_MODE_PARALLEL converts the band cascade into an equivalent
+ * parallel sum of second-order sections plus a direct term whenever a preset
+ * is applied. The sections run side by side in SIMD lanes. If the conversion
+ * is numerically ill-conditioned (e.g. two bands with the same poles) the
+ * engine keeps running the cascade; see radioform_dsp_get_active_eq_mode().
+ *
+ * @param engine Engine instance (must not be NULL)
+ * @param mode Requested mode
+ * @return RADIOFORM_OK on success, error code otherwise
+ *
+ * @note NOT realtime-safe (re-applies the current preset)
+ * @note Switching structure clears the EQ filter history
+ */
+radioform_error_t radioform_dsp_set_eq_mode(
+    radioform_dsp_engine_t* engine,
+    radioform_eq_mode_t mode
+);
+
+/**
+ * @brief Get the requested EQ mode
+ *
+ * @param engine Engine instance (must not be NULL)
+ * @return Mode last passed to radioform_dsp_set_eq_mode()
+ */
+radioform_eq_mode_t radioform_dsp_get_eq_mode(const radioform_dsp_engine_t* engine);
+
+/**
+ * @brief Get the EQ mode actually running
+ *
+ * @param engine Engine instance (must not be NULL)
+ * @return RADIOFORM_EQ_MODE_CASCADE if parallel mode was requested but the
+ *         conversion was rejected; re-evaluated on every preset apply
+ */
+radioform_eq_mode_t radioform_dsp_get_active_eq_mode(const radioform_dsp_engine_t* engine);
+
+/**
+ * @brief Choose the filter structure of a band slot
+ *
+ * RADIOFORM_TOPOLOGY_AUTO (the default) picks per preset apply by
+ * frequency, see radioform_dsp_get_band_topology(). RADIOFORM_TOPOLOGY_SVF
+ * pins the band to the state-variable filter whatever its frequency: its
+ * edits ramp through g = tan(pi f / fs), k = 1 / Q and the output mix, and
+ * every intermediate filter is stable, which suits fast automation and
+ * dynamic EQ. RADIOFORM_TOPOLOGY_BIQUAD pins it to the biquad chain. The
+ * choice stays with the slot across presets.
+ *
+ * @param engine Engine instance (must not be NULL)
+ * @param band_index Band slot (0 to RADIOFORM_MAX_BANDS-1)
+ * @param topology Requested structure
+ * @return RADIOFORM_OK on success, error code otherwise
+ *
+ * @note NOT realtime-safe (re-applies the current preset)
+ * @note Switching a band's structure clears its filter history
+ */
+radioform_error_t radioform_dsp_set_band_topology(
+    radioform_dsp_engine_t* engine,
+    uint32_t band_index,
+    radioform_filter_topology_t topology
+);
+
+/**
+ * @brief Get the filter structure a band runs on
+ *
+ * Unless set with radioform_dsp_set_band_topology(), chosen per band
+ * whenever a preset is applied: bands whose frequency is below 0.1% of the
+ * sample rate (e.g. 150 Hz at 192 kHz) run as a state-variable filter, whose
+ * coefficients keep their precision there; all others run as biquads. The
+ * frequency response is the same either way.
+ *
+ * @param engine Engine instance (must not be NULL)
+ * @param band_index Band index (0 to num_bands-1)
+ * @return RADIOFORM_TOPOLOGY_BIQUAD for disabled or out-of-range bands
+ */
+radioform_filter_topology_t radioform_dsp_get_band_topology(
+    const radioform_dsp_engine_t* engine,
+    uint32_t band_index
+);
+
+/**
+ * @brief Choose how the limiter works (when the preset enables it)
+ *
+ * RADIOFORM_LIMITER_MODE_LOOKAHEAD delays the output by the lookahead plus
+ * 6 frames and ramps the gain down over the lookahead ahead of each peak,
+ * so the output's 4x oversampled true peak stays at the preset's
+ * limiter_threshold_db without clipping the waveform; the gain recovers
+ * with the release time constant. All channels share one gain.
+ *
+ * @param engine Engine instance (must not be NULL)
+ * @param mode Limiter mode
+ * @param lookahead_ms Lookahead, 1 to 5 ms (lookahead mode)
+ * @param release_ms Release time constant, 1 to 1000 ms (lookahead mode)
+ * @return RADIOFORM_OK on success, error code otherwise
+ *
+ * @note NOT realtime-safe (re-applies the current preset)
+ * @note Changing the lookahead clears the limiter's delay line
+ */
+radioform_error_t radioform_dsp_set_limiter_mode(
+    radioform_dsp_engine_t* engine,
+    radioform_limiter_mode_t mode,
+    float lookahead_ms,
+    float release_ms
+);
+
+/**
+ * @brief Run the soft limiter oversampled (when the preset enables it)
+ *
+ * The soft limiter's waveshaper runs at 2x, 4x or 8x the sample rate between
+ * half-band FIR interpolation and decimation, so the harmonics it creates
+ * above Nyquist are filtered instead of aliasing back into the audio band.
+ * The EQ stays at the base rate. Adds 23 (2x), 29 (4x) or 30 (8x) frames of
+ * latency. The lookahead limiter is not affected.
+ *
+ * Removing those harmonics also removes some of the flattening, so on
+ * heavily limited wideband material the output peaks can land a few dB
+ * above limiter_threshold_db; use the lookahead mode for a hard ceiling.
+ *
+ * @param engine Engine instance (must not be NULL)
+ * @param factor 1 (off, the default), 2, 4 or 8
+ * @return RADIOFORM_OK on success, error code otherwise
+ *
+ * @note NOT realtime-safe (re-applies the current preset)
+ * @note Changing the factor clears the oversampling filters
+ */
+radioform_error_t radioform_dsp_set_limiter_oversampling(
+    radioform_dsp_engine_t* engine,
+    uint32_t factor
+);
+
+/**
+ * @brief Get the processing latency in frames
+ *
+ * Non-zero while the lookahead or oversampled limiter is enabled by the
+ * preset; follows radioform_dsp_set_limiter_mode(),
+ * radioform_dsp_set_limiter_oversampling(), preset applies and sample rate
+ * changes. It is the latency of the configuration being rendered, so a
+ * change shows once the next process call has swapped it in.
+ *
+ * @param engine Engine instance (must not be NULL)
+ * @return Frames by which the output lags the input
+ */
+uint32_t radioform_dsp_get_latency_frames(const radioform_dsp_engine_t* engine);
+
 // ============================================================================
 // Realtime Parameter Updates (Lock-free)
 // ============================================================================
@@ -205,9 +413,13 @@ bool radioform_dsp_get_bypass(const radioform_dsp_engine_t* engine);
  * @param band_index Band index (0 to num_bands-1)
  * @param gain_db New gain in dB (-12.0 to +12.0)
  *
- * @note REALTIME-SAFE: Queues parameter change, applied with smoothing
- * @note Safe to call from UI thread while audio is processing
+ * @note REALTIME-SAFE: Designs the coefficients on the calling thread and
+ *       queues them; the next process call starts ramping to them
+ * @note Safe to call from UI thread while audio is processing (one
+ *       updating thread at a time)
  * @note Changes are applied over ~10ms to avoid zipper noise
+ * @note Several updates to a band between two process calls coalesce: only
+ *       the latest is applied
  */
 void radioform_dsp_update_band_gain(
     radioform_dsp_engine_t* engine,
@@ -277,6 +489,86 @@ void radioform_dsp_get_stats(
     radioform_stats_t* stats
 );
 
+/**
+ * @brief Enable true-peak metering of the output (REALTIME-SAFE)
+ *
+ * Meters the first two output channels with the ITU-R BS.1770-4 Annex 2
+ * 4x interpolator and reports dBTP and the number of frames above 0 dBTP in
+ * radioform_stats_t. Off by default; costs a few ns per frame while on.
+ *
+ * @param engine Engine instance (must not be NULL)
+ * @param enabled true to meter, false to stop (true-peak stats read -120 dBTP)
+ *
+ * @note REALTIME-SAFE: Uses atomic operation, safe to call from any thread
+ * @note The over count keeps accumulating across on/off switches; it is
+ *       cleared by radioform_dsp_reset()
+ */
+void radioform_dsp_set_true_peak_metering(radioform_dsp_engine_t* engine, bool enabled);
+
+/**
+ * @brief Enable loudness metering of the output (REALTIME-SAFE)
+ *
+ * K-weighted BS.1770-4 loudness over all channels (5.1 and 7.1 in
+ * L R C LFE Ls Rs [Lb Rb] order weight the surrounds 1.41 and skip the
+ * LFE). Switching on starts a new measurement. Off by default; costs a few
+ * ns per frame while on. Bypassed buffers are not metered.
+ *
+ * @param engine Engine instance (must not be NULL)
+ * @param enabled true to meter, false to stop (readings go to -120 LUFS)
+ *
+ * @note REALTIME-SAFE: Uses atomic operation, safe to call from any thread
+ */
+void radioform_dsp_set_loudness_metering(radioform_dsp_engine_t* engine, bool enabled);
+
+/**
+ * @brief Start a new integrated loudness measurement (REALTIME-SAFE)
+ *
+ * Clears the momentary and short-term windows as well. Takes effect at the
+ * start of the next buffer.
+ *
+ * @param engine Engine instance (must not be NULL)
+ *
+ * @note REALTIME-SAFE: Uses atomic operation, safe to call from any thread
+ */
+void radioform_dsp_reset_loudness(radioform_dsp_engine_t* engine);
+
+/**
+ * @brief Get the momentary, short-term and integrated loudness
+ *
+ * Updated every 100 ms of audio. The integrated reading gates its 400 ms
+ * windows at -70 LUFS, then at 10 LU below the mean of those that passed.
+ * It is kept as a fixed-size histogram, so it costs the same however long
+ * the programme runs.
+ *
+ * @param engine Engine instance (must not be NULL)
+ * @param loudness Pointer to readings struct to fill (must not be NULL)
+ * @return RADIOFORM_OK on success, error code otherwise
+ *
+ * @note Safe to call from any thread (reads atomic values)
+ */
+radioform_error_t radioform_dsp_get_loudness(
+    const radioform_dsp_engine_t* engine,
+    radioform_loudness_t* loudness
+);
+
+/**
+ * @brief Get the kernel set selected for this CPU
+ *
+ * Chosen in radioform_dsp_create() from the CPU features detected at
+ * runtime (e.g. AVX2/FMA on x86, NEON on ARM); the build-target kernels are
+ * the fallback.
+ *
+ * @param engine Engine instance (must not be NULL)
+ * @param info Pointer to info struct to fill (must not be NULL)
+ * @return RADIOFORM_OK on success, error code otherwise
+ *
+ * @note Safe to call from any thread (the selection never changes)
+ */
+radioform_error_t radioform_dsp_get_kernel_info(
+    const radioform_dsp_engine_t* engine,
+    radioform_kernel_info_t* info
+);
+
 /**
  * @brief Get library version string
  *
@@ -284,6 +576,185 @@ void radioform_dsp_get_stats(
  */
 const char* radioform_dsp_get_version(void);
 
+// ============================================================================
+// Spectrum Analysis
+// ============================================================================
+
+/**
+ * @brief Default analyzer settings
+ *
+ * 4096-point FFT, 64 bins from 20 Hz to 20 kHz, 200 ms averaging, peaks
+ * held for 1 s and then falling at 20 dB/s.
+ *
+ * @param config Pointer to config struct to initialize (must not be NULL)
+ */
+void radioform_dsp_spectrum_config_init_default(radioform_spectrum_config_t* config);
+
+/**
+ * @brief Tap the output for the spectrum analyzer (REALTIME-SAFE)
+ *
+ * While on, the audio thread copies each processed buffer (first two
+ * channels) into a wait-free ring; all FFT work happens in
+ * radioform_dsp_analyze_spectrum(). Off by default. Bypassed buffers are
+ * not tapped.
+ *
+ * @param engine Engine instance (must not be NULL)
+ * @param enabled true to tap, false to stop
+ *
+ * @note REALTIME-SAFE: Uses atomic operation, safe to call from any thread
+ */
+void radioform_dsp_set_spectrum_tap(radioform_dsp_engine_t* engine, bool enabled);
+
+/**
+ * @brief Configure the spectrum analyzer
+ *
+ * Clears the averages and held peaks. The engine starts with the defaults
+ * (clamped to the sample rate); after radioform_dsp_set_sample_rate() the
+ * analyzer keeps its settings, with the top bin edge lowered to the new
+ * Nyquist frequency if needed.
+ *
+ * @param engine Engine instance (must not be NULL)
+ * @param config Settings (must not be NULL)
+ * @return RADIOFORM_OK, or RADIOFORM_ERROR_INVALID_PARAM for settings out of range
+ *
+ * @note Call from the thread that calls radioform_dsp_analyze_spectrum()
+ */
+radioform_error_t radioform_dsp_configure_spectrum(
+    radioform_dsp_engine_t* engine,
+    const radioform_spectrum_config_t* config
+);
+
+/**
+ * @brief Analyze the tapped output and get the current spectrum
+ *
+ * Runs a Hann-windowed FFT for every half FFT size of audio queued since
+ * the last call (mono downmix), then reports log-frequency bins: the
+ * largest FFT bin in each, or the level interpolated at its centre for
+ * bins narrower than the FFT resolution. Call it at the UI refresh rate;
+ * audio queued for longer than ~340 ms (at 48 kHz) is dropped and counted.
+ *
+ * @param engine Engine instance (must not be NULL)
+ * @param spectrum Pointer to spectrum struct to fill (must not be NULL)
+ * @return RADIOFORM_OK on success, error code otherwise
+ *
+ * @note NOT realtime-safe: call from one non-audio thread (e.g. a UI timer)
+ */
+radioform_error_t radioform_dsp_analyze_spectrum(
+    radioform_dsp_engine_t* engine,
+    radioform_spectrum_t* spectrum
+);
+
+// ============================================================================
+// Engine Groups
+// ============================================================================
+
+/**
+ * @brief Create a group of independent stereo engines
+ *
+ * A group owns up to RADIOFORM_MAX_GROUP_ENGINES engines (e.g. one per
+ * output device or per stream of a mixer) and processes all of their
+ * buffers in one call, one engine per SIMD lane. For small buffers this is
+ * much cheaper than calling several engines one after another. Each member
+ * has its own preset, bypass and statistics. A preset identical to another
+ * member's reuses that member's design, which is copied into the new lane.
+ *
+ * Members run the cascade form (preamp, EQ, DC blocker, limiter) with the
+ * same per-band topology choice as a stereo engine. Band edits are applied
+ * with radioform_dsp_engine_group_apply_preset() (no coefficient ramps);
+ * the preamp is smoothed.
+ *
+ * @param sample_rate Sample rate in Hz, shared by all members
+ * @param num_engines Members (1 to RADIOFORM_MAX_GROUP_ENGINES), flat at creation
+ * @return Pointer to group instance, or NULL on failure
+ *
+ * @note This function allocates memory. Do NOT call from audio thread.
+ */
+radioform_dsp_engine_group_t* radioform_dsp_engine_group_create(
+    uint32_t sample_rate,
+    uint32_t num_engines
+);
+
+/**
+ * @brief Destroy an engine group
+ *
+ * @param group Group instance to destroy
+ */
+void radioform_dsp_engine_group_destroy(radioform_dsp_engine_group_t* group);
+
+/**
+ * @brief Reset the filter state of every member
+ *
+ * @note Not realtime-safe with concurrent processing.
+ */
+void radioform_dsp_engine_group_reset(radioform_dsp_engine_group_t* group);
+
+/**
+ * @brief Get the number of engines in a group
+ *
+ * @return Members, or 0 if group is NULL
+ */
+uint32_t radioform_dsp_engine_group_get_num_engines(
+    const radioform_dsp_engine_group_t* group
+);
+
+/**
+ * @brief Apply a preset to one member
+ *
+ * @param group Group instance (must not be NULL)
+ * @param engine_index Member index (0 to num_engines-1)
+ * @param preset Preset to apply (must not be NULL)
+ * @return RADIOFORM_OK on success, error code otherwise
+ *
+ * @note NOT realtime-safe (designs filter coefficients)
+ * @note Safe while the group is processing: the new configuration is swapped
+ *       in whole at the start of the next process call, as with
+ *       radioform_dsp_apply_preset(). Call from one control thread at a time.
+ */
+radioform_error_t radioform_dsp_engine_group_apply_preset(
+    radioform_dsp_engine_group_t* group,
+    uint32_t engine_index,
+    const radioform_preset_t* preset
+);
+
+/**
+ * @brief Bypass one member (REALTIME-SAFE)
+ *
+ * A bypassed member's output is its input, bit for bit.
+ */
+void radioform_dsp_engine_group_set_bypass(
+    radioform_dsp_engine_group_t* group,
+    uint32_t engine_index,
+    bool bypass
+);
+
+/**
+ * @brief Process one interleaved stereo buffer per member (REALTIME-SAFE)
+ *
+ * @param group Group instance (must not be NULL)
+ * @param inputs num_engines interleaved stereo inputs
+ * @param outputs num_engines interleaved stereo outputs (may equal inputs)
+ * @param num_frames Frames in every buffer
+ */
+void radioform_dsp_engine_group_process_interleaved(
+    radioform_dsp_engine_group_t* group,
+    const float* const* inputs,
+    float* const* outputs,
+    uint32_t num_frames
+);
+
+/**
+ * @brief Get one member's statistics
+ *
+ * cpu_load_percent is the load of the whole group.
+ *
+ * @note Safe to call from any thread (reads atomic counters)
+ */
+void radioform_dsp_engine_group_get_stats(
+    const radioform_dsp_engine_group_t* group,
+    uint32_t engine_index,
+    radioform_stats_t* stats
+);
+
 // ============================================================================
 // Performance Optimizations
 // ============================================================================
@@ -22,6 +22,21 @@ extern "C" {
  */
 #define RADIOFORM_MAX_BANDS 10
 
+/**
+ * @brief Maximum number of channels per engine (7.1, matches RF_MAX_CHANNELS)
+ */
+#define RADIOFORM_MAX_CHANNELS 8
+
+/**
+ * @brief Maximum number of engines in an engine group
+ */
+#define RADIOFORM_MAX_GROUP_ENGINES 8
+
+/**
+ * @brief Maximum number of log-frequency bins in a spectrum
+ */
+#define RADIOFORM_MAX_SPECTRUM_BINS 256
+
 /**
  * @brief Filter types for EQ bands
  */
@@ -35,6 +50,31 @@ typedef enum {
     RADIOFORM_FILTER_BAND_PASS      // Band-pass filter
 } radioform_filter_type_t;
 
+/**
+ * @brief EQ filter structure
+ */
+typedef enum {
+    RADIOFORM_EQ_MODE_CASCADE = 0,  // Bands run one after another (default)
+    RADIOFORM_EQ_MODE_PARALLEL      // Bands rewritten as a parallel sum of sections
+} radioform_eq_mode_t;
+
+/**
+ * @brief Filter structure of a single band
+ */
+typedef enum {
+    RADIOFORM_TOPOLOGY_BIQUAD = 0,  // Single-precision biquad (vectorized chain)
+    RADIOFORM_TOPOLOGY_SVF,         // Trapezoidal state-variable filter (low f/fs)
+    RADIOFORM_TOPOLOGY_AUTO         // Requested only: chosen by frequency (default)
+} radioform_filter_topology_t;
+
+/**
+ * @brief How the output limiter works
+ */
+typedef enum {
+    RADIOFORM_LIMITER_MODE_SOFT = 0,   // Soft-knee waveshaper, no latency (default)
+    RADIOFORM_LIMITER_MODE_LOOKAHEAD   // True-peak brickwall with lookahead (adds latency)
+} radioform_limiter_mode_t;
+
 /**
  * @brief Configuration for a single EQ band
  */
@@ -81,8 +121,72 @@ typedef struct {
     uint32_t sample_rate;           // Current sample rate
     float peak_left_db;             // Current peak level left channel (dBFS)
     float peak_right_db;            // Current peak level right channel (dBFS)
+    uint64_t coeff_cache_hits;      // Band designs served from the coefficient cache
+    uint64_t coeff_cache_misses;    // Band designs computed (and then cached)
+    float true_peak_left_db;        // True peak left channel (dBTP; -120 while metering is off)
+    float true_peak_right_db;       // True peak right channel (dBTP)
+    uint64_t true_peak_overs;       // Frames above 0 dBTP, summed over both channels
 } radioform_stats_t;
 
+/**
+ * @brief Loudness readings (ITU-R BS.1770-4, EBU R 128)
+ *
+ * LUFS; -120 while metering is off, during silence, and (integrated) until
+ * a 400 ms window passes the gates.
+ */
+typedef struct {
+    float momentary_lufs;           // Last 400 ms
+    float short_term_lufs;          // Last 3 s
+    float integrated_lufs;          // Gated, since metering started or was last reset
+} radioform_loudness_t;
+
+/**
+ * @brief Spectrum analyzer settings
+ */
+typedef struct {
+    uint32_t fft_size;              // Power of two, 256 to 8192 (50% overlap)
+    uint32_t num_bins;              // Log-spaced bins (1 to RADIOFORM_MAX_SPECTRUM_BINS)
+    float min_frequency_hz;         // Lower edge of the first bin (> 0)
+    float max_frequency_hz;         // Upper edge of the last bin (<= sample_rate / 2)
+    float averaging_ms;             // Averaging time constant (0: latest FFT only)
+    float peak_hold_ms;             // How long a peak is held before it falls
+    float peak_fall_db_per_s;       // Fall rate after the hold
+} radioform_spectrum_config_t;
+
+/**
+ * @brief Spectrum of the output (dB; a full-scale sine reads 0, floor -120)
+ */
+typedef struct {
+    uint32_t num_bins;
+    float frequency_hz[RADIOFORM_MAX_SPECTRUM_BINS];  // Geometric centre of each bin
+    float magnitude_db[RADIOFORM_MAX_SPECTRUM_BINS];  // Averaged level
+    float peak_db[RADIOFORM_MAX_SPECTRUM_BINS];       // Held peak level
+    uint64_t frames_analyzed;       // Frames analyzed since the last configuration
+    uint64_t frames_dropped;        // Frames the tap could not queue (analysis fell behind)
+} radioform_spectrum_t;
+
+/**
+ * @brief CPU features detected at engine creation (bitmask)
+ */
+typedef enum {
+    RADIOFORM_CPU_SSE2    = 1 << 0,
+    RADIOFORM_CPU_AVX     = 1 << 1,
+    RADIOFORM_CPU_AVX2    = 1 << 2,
+    RADIOFORM_CPU_FMA     = 1 << 3,
+    RADIOFORM_CPU_AVX512F = 1 << 4,
+    RADIOFORM_CPU_NEON    = 1 << 5,
+    RADIOFORM_CPU_SVE     = 1 << 6
+} radioform_cpu_feature_t;
+
+/**
+ * @brief Kernel set bound to an engine (for diagnostics)
+ */
+typedef struct {
+    const char* kernel_set;         // e.g. "avx2+fma", "sse2", "neon" (static string)
+    uint32_t cpu_features;          // Detected radioform_cpu_feature_t bits
+    uint32_t vector_width;          // Float lanes per vector in the planar kernels
+} radioform_kernel_info_t;
+
 #ifdef __cplusplus
 }
 #endif
@@ -7,13 +7,45 @@
 #define RADIOFORM_BIQUAD_H
 
 #include "radioform_types.h"
+#include <algorithm>
 #include <cmath>
+#include <cstdint>
 #include <cstring>
 
 namespace radioform {
 
 static constexpr float PI = 3.14159265358979323846f;
 
+// Coefficient ramps hold each step for this many frames (see Biquad::stepRamp)
+static constexpr uint32_t kRampBlockFrames = 32;
+
+/**
+ * @brief Number of steps for a ramp of transition_samples frames
+ */
+inline int ramp_step_count(int transition_samples) {
+    const int block = static_cast<int>(kRampBlockFrames);
+    return transition_samples <= 0 ? 0 : (transition_samples + block - 1) / block;
+}
+
+/**
+ * @brief Interpolate a biquad denominator through stable filters only
+ *
+ * Works on the reflection (lattice) coefficients k2 = a2, k1 = a1 / (1 + a2).
+ * A biquad is stable exactly when |k1| < 1 and |k2| < 1; that region is a
+ * square, so every point between two stable endpoints is stable as well.
+ */
+inline void interpolate_poles(
+    float from_a1, float from_a2, float to_a1, float to_a2, float t,
+    float& a1, float& a2
+) {
+    const float from_k1 = from_a1 / (1.0f + from_a2);
+    const float to_k1 = to_a1 / (1.0f + to_a2);
+    const float k1 = from_k1 + (to_k1 - from_k1) * t;
+    const float k2 = from_a2 + (to_a2 - from_a2) * t;
+    a1 = k1 * (1.0f + k2);
+    a2 = k2;
+}
+
 /**
  * @brief Biquad filter coefficients
  */
@@ -49,7 +81,10 @@ public:
     void reset() {
         state_left_ = {};
         state_right_ = {};
-        transition_remaining_ = 0;
+        if (ramp_remaining_ > 0) {
+            coeffs_ = target_coeffs_;
+            ramp_remaining_ = 0;
+        }
     }
 
     /**
@@ -61,57 +96,95 @@ public:
         coeffs_.b2 = 0.0f;
         coeffs_.a1 = 0.0f;
         coeffs_.a2 = 0.0f;
-        transition_remaining_ = 0;
+        ramp_remaining_ = 0;
     }
 
     /**
      * @brief Set coefficients from band configuration (instant, no smoothing)
      */
     void setCoeffs(const radioform_band_t& band, float sample_rate) {
-        BiquadCoeffs c = calculateCoeffs(band, sample_rate);
+        setCoeffs(calculateCoeffs(band, sample_rate));
+    }
+
+    /**
+     * @brief Set precomputed coefficients (instant, flat if not finite)
+     */
+    void setCoeffs(const BiquadCoeffs& c) {
         if (isFinite(c)) {
             coeffs_ = c;
         } else {
             setCoeffsFlat();
         }
-        transition_remaining_ = 0;
+        ramp_remaining_ = 0;
     }
 
     /**
-     * @brief Set coefficients with linear interpolation to prevent zipper noise
+     * @brief Ramp coefficients to a new band configuration
      *
-     * Linearly interpolates from current coefficients to target over
-     * transition_samples. Zero overhead once transition completes.
+     * The ramp moves in steps: coefficients are held for kRampBlockFrames
+     * frames and stepped between blocks by stepRamp(), so processing always
+     * runs on fixed coefficients. The numerator is interpolated linearly and
+     * the denominator with interpolate_poles(), so every step is a stable
+     * filter. The first step is taken immediately.
      *
      * @param band Band configuration
      * @param sample_rate Sample rate in Hz
-     * @param transition_samples Number of samples to interpolate over (~10ms)
+     * @param transition_samples Ramp length in frames (~10ms)
      */
     void setCoeffsSmooth(const radioform_band_t& band, float sample_rate, int transition_samples) {
-        BiquadCoeffs c = calculateCoeffs(band, sample_rate);
+        setCoeffsSmooth(calculateCoeffs(band, sample_rate), transition_samples);
+    }
+
+    /**
+     * @brief Ramp to precomputed coefficients (e.g. designed on another thread)
+     */
+    void setCoeffsSmooth(const BiquadCoeffs& c, int transition_samples) {
         if (!isFinite(c)) {
             setCoeffsFlat();
             return;
         }
         target_coeffs_ = c;
+        ramp_start_ = coeffs_;
+        ramp_steps_ = std::max(ramp_step_count(transition_samples), 1);
+        ramp_remaining_ = ramp_steps_;
+        stepRamp();
+    }
 
-        if (transition_samples <= 0) {
+    /**
+     * @brief Move an active ramp to its next step
+     *
+     * Called by the owner once every kRampBlockFrames frames; the last step
+     * lands exactly on the target.
+     */
+    void stepRamp() {
+        if (ramp_remaining_ <= 0) {
+            return;
+        }
+        if (--ramp_remaining_ == 0) {
             coeffs_ = target_coeffs_;
-            transition_remaining_ = 0;
             return;
         }
 
-        const float inv_n = 1.0f / static_cast<float>(transition_samples);
-        coeffs_delta_.b0 = (target_coeffs_.b0 - coeffs_.b0) * inv_n;
-        coeffs_delta_.b1 = (target_coeffs_.b1 - coeffs_.b1) * inv_n;
-        coeffs_delta_.b2 = (target_coeffs_.b2 - coeffs_.b2) * inv_n;
-        coeffs_delta_.a1 = (target_coeffs_.a1 - coeffs_.a1) * inv_n;
-        coeffs_delta_.a2 = (target_coeffs_.a2 - coeffs_.a2) * inv_n;
-        transition_remaining_ = transition_samples;
+        const float t = static_cast<float>(ramp_steps_ - ramp_remaining_) /
+                        static_cast<float>(ramp_steps_);
+        BiquadCoeffs c;
+        c.b0 = ramp_start_.b0 + (target_coeffs_.b0 - ramp_start_.b0) * t;
+        c.b1 = ramp_start_.b1 + (target_coeffs_.b1 - ramp_start_.b1) * t;
+        c.b2 = ramp_start_.b2 + (target_coeffs_.b2 - ramp_start_.b2) * t;
+        interpolate_poles(ramp_start_.a1, ramp_start_.a2, target_coeffs_.a1, target_coeffs_.a2, t,
+                          c.a1, c.a2);
+        coeffs_ = isFinite(c) ? c : target_coeffs_;
     }
 
+    /**
+     * @brief Steps left in the active ramp (0 = fixed coefficients)
+     */
+    int rampStepsRemaining() const { return ramp_remaining_; }
+
     /**
      * @brief Process one sample (stereo)
+     *
+     * Both channels use the same coefficients.
      */
     inline void processSample(float in_l, float in_r, float* out_l, float* out_r) {
         *out_l = processSampleMono(in_l, state_left_);
@@ -132,6 +205,14 @@ public:
         }
     }
 
+    // ------------------------------------------------------------------------
+    // State access for the vectorized kernels (kernels_impl.h)
+    // ------------------------------------------------------------------------
+
+    const BiquadCoeffs& coeffs() const { return coeffs_; }
+    BiquadState& stateLeft() { return state_left_; }
+    BiquadState& stateRight() { return state_right_; }
+
     /**
      * @brief Check if all coefficients are finite (not NaN or Inf)
      */
@@ -140,41 +221,6 @@ public:
             && std::isfinite(c.a1) && std::isfinite(c.a2);
     }
 
-private:
-    /**
-     * @brief Process one sample (mono) using Direct Form 2 Transposed
-     *
-     * During coefficient transitions, linearly interpolates coefficients
-     * per sample to prevent zipper noise. Zero overhead when stable.
-     */
-    inline float processSampleMono(float input, BiquadState& state) {
-        // Interpolate coefficients during transition (branch predicted not-taken when stable)
-        if (transition_remaining_ > 0) {
-            coeffs_.b0 += coeffs_delta_.b0;
-            coeffs_.b1 += coeffs_delta_.b1;
-            coeffs_.b2 += coeffs_delta_.b2;
-            coeffs_.a1 += coeffs_delta_.a1;
-            coeffs_.a2 += coeffs_delta_.a2;
-            if (--transition_remaining_ == 0) {
-                // Snap to target to prevent float drift
-                coeffs_ = target_coeffs_;
-            }
-        }
-
-        float output = coeffs_.b0 * input + state.z1;
-        state.z1 = coeffs_.b1 * input - coeffs_.a1 * output + state.z2;
-        state.z2 = coeffs_.b2 * input - coeffs_.a2 * output;
-
-        // Protect against NaN/Inf from filter state blowup
-        if (!std::isfinite(output)) {
-            state.z1 = 0.0f;
-            state.z2 = 0.0f;
-            return input;
-        }
-
-        return output;
-    }
-
     /**
      * @brief Calculate biquad coefficients from band parameters
      *
@@ -183,7 +229,7 @@ private:
      * high-frequency bandwidth cramping.
      * https://www.w3.org/TR/audio-eq-cookbook/
      */
-    BiquadCoeffs calculateCoeffs(const radioform_band_t& band, float sample_rate) {
+    static BiquadCoeffs calculateCoeffs(const radioform_band_t& band, float sample_rate) {
         BiquadCoeffs c;
 
         const float freq = band.frequency_hz;
@@ -297,12 +343,33 @@ private:
         return c;
     }
 
+private:
+    /**
+     * @brief Process one sample (mono) using Direct Form 2 Transposed
+     */
+    inline float processSampleMono(float input, BiquadState& state) {
+        float output = coeffs_.b0 * input + state.z1;
+        state.z1 = coeffs_.b1 * input - coeffs_.a1 * output + state.z2;
+        state.z2 = coeffs_.b2 * input - coeffs_.a2 * output;
+
+        // Protect against NaN/Inf from filter state blowup
+        if (!std::isfinite(output)) {
+            state.z1 = 0.0f;
+            state.z2 = 0.0f;
+            return input;
+        }
+
+        return output;
+    }
+
+    // Per-sample data first, ramp endpoints (touched once per step) after
     BiquadCoeffs coeffs_;
-    BiquadCoeffs target_coeffs_;
-    BiquadCoeffs coeffs_delta_;
-    int transition_remaining_ = 0;
     BiquadState state_left_;
     BiquadState state_right_;
+    BiquadCoeffs target_coeffs_;
+    BiquadCoeffs ramp_start_;
+    int ramp_steps_ = 0;
+    int ramp_remaining_ = 0;
 };
 
 } // namespace radioform
@@ -0,0 +1,133 @@
+/**
+ * @file biquad_bank.h
+ * @brief Packed biquad cascade in structure-of-arrays form
+ *
+ * The engine designs and ramps coefficients with one Biquad per band, but
+ * the audio thread only touches this bank: coefficients and filter state of
+ * the enabled bands, packed in processing order, one cache-line-aligned
+ * array per field. A stereo cascade is nine cache lines (two more per
+ * extra channel) that the kernels read directly instead of following a
+ * pointer per band.
+ */
+
+#ifndef RADIOFORM_BIQUAD_BANK_H
+#define RADIOFORM_BIQUAD_BANK_H
+
+#include "radioform_types.h"
+#include "biquad.h"
+#include "cpu_util.h"
+
+#include <cmath>
+#include <cstdint>
+
+namespace radioform {
+
+/**
+ * @brief Coefficients and per-channel state of up to RADIOFORM_MAX_BANDS sections
+ *
+ * Section k of the cascade is index k of every array; state is indexed
+ * [channel][section] with channel 0 = left, 1 = right for stereo engines.
+ * The stereo kernels only touch the first two channel rows.
+ */
+class BiquadBank {
+public:
+    // One cache line of floats per field
+    static constexpr uint32_t kCapacity = kCacheLineSize / sizeof(float);
+    static_assert(RADIOFORM_MAX_BANDS <= kCapacity, "bank fields must fit one cache line");
+    static constexpr uint32_t kMaxChannels = RADIOFORM_MAX_CHANNELS;
+
+    /**
+     * @brief Initialize to an empty cascade
+     */
+    void init() {
+        const BiquadCoeffs flat = {1.0f, 0.0f, 0.0f, 0.0f, 0.0f};
+        for (uint32_t k = 0; k < kCapacity; k++) {
+            setCoeffs(k, flat);
+        }
+        num_sections_ = 0;
+        reset();
+    }
+
+    /**
+     * @brief Clear all filter state
+     */
+    void reset() {
+        for (uint32_t ch = 0; ch < kMaxChannels; ch++) {
+            for (uint32_t k = 0; k < kCapacity; k++) {
+                z1_[ch][k] = 0.0f;
+                z2_[ch][k] = 0.0f;
+            }
+        }
+    }
+
+    uint32_t numSections() const { return num_sections_; }
+    void setNumSections(uint32_t num_sections) { num_sections_ = num_sections; }
+
+    void setCoeffs(uint32_t k, const BiquadCoeffs& c) {
+        b0_[k] = c.b0;
+        b1_[k] = c.b1;
+        b2_[k] = c.b2;
+        a1_[k] = c.a1;
+        a2_[k] = c.a2;
+    }
+
+    BiquadCoeffs coeffs(uint32_t k) const {
+        return {b0_[k], b1_[k], b2_[k], a1_[k], a2_[k]};
+    }
+
+    BiquadState state(uint32_t channel, uint32_t k) const {
+        return {z1_[channel][k], z2_[channel][k]};
+    }
+
+    void setState(uint32_t channel, uint32_t k, const BiquadState& state) {
+        z1_[channel][k] = state.z1;
+        z2_[channel][k] = state.z2;
+    }
+
+    /**
+     * @brief Run one section over planar stereo buffers in place
+     *
+     * Same arithmetic and NaN policy as Biquad::processBuffer().
+     */
+    void processSection(uint32_t k, float* left, float* right, uint32_t num_frames) {
+        const BiquadCoeffs c = coeffs(k);
+        BiquadState state_left = state(0, k);
+        BiquadState state_right = state(1, k);
+        for (uint32_t i = 0; i < num_frames; i++) {
+            left[i] = processSample(c, state_left, left[i]);
+            right[i] = processSample(c, state_right, right[i]);
+        }
+        setState(0, k, state_left);
+        setState(1, k, state_right);
+    }
+
+    // Field arrays, read and written back by the kernels
+    alignas(kCacheLineSize) float b0_[kCapacity];
+    alignas(kCacheLineSize) float b1_[kCapacity];
+    alignas(kCacheLineSize) float b2_[kCapacity];
+    alignas(kCacheLineSize) float a1_[kCapacity];
+    alignas(kCacheLineSize) float a2_[kCapacity];
+    alignas(kCacheLineSize) float z1_[kMaxChannels][kCapacity];
+    alignas(kCacheLineSize) float z2_[kMaxChannels][kCapacity];
+
+private:
+    static float processSample(const BiquadCoeffs& c, BiquadState& state, float input) {
+        const float output = c.b0 * input + state.z1;
+        state.z1 = c.b1 * input - c.a1 * output + state.z2;
+        state.z2 = c.b2 * input - c.a2 * output;
+
+        // Protect against NaN/Inf from filter state blowup
+        if (!std::isfinite(output)) {
+            state.z1 = 0.0f;
+            state.z2 = 0.0f;
+            return input;
+        }
+        return output;
+    }
+
+    uint32_t num_sections_ = 0;
+};
+
+} // namespace radioform
+
+#endif // RADIOFORM_BIQUAD_BANK_H
@@ -0,0 +1,153 @@
+/**
+ * @file biquad_design.cpp
+ * @brief Batch biquad coefficient design
+ *
+ * Compiled without associative math (see CMakeLists.txt) for the range
+ * reductions in fast_math.h.
+ */
+
+#include "biquad_design.h"
+#include "fast_math.h"
+
+#include <algorithm>
+
+namespace radioform {
+
+namespace {
+
+using simd::f32x4;
+using simd::m32x4;
+
+// log2(10) / 40: A = 10^(gain_db / 40) = 2^(gain_db * kGainToLog2A)
+constexpr float kGainToLog2A = 3.32192809488736234787f / 40.0f;
+
+inline m32x4 is_type(f32x4 type, radioform_filter_type_t t) {
+    return simd::cmp_le(simd::abs(type - simd::set1(static_cast<float>(t))), simd::set1(0.5f));
+}
+
+// Up to this many bands are designed per pass, each stage running over all
+// of their vectors before the next so the vectors' dependency chains overlap
+constexpr uint32_t kMaxBatch = 16;
+constexpr uint32_t kMaxVectors = kMaxBatch / 4;
+
+/**
+ * @brief Design up to kMaxBatch bands
+ */
+void design_batch(const radioform_band_t* bands, uint32_t count, float sample_rate,
+                  BiquadCoeffs* coeffs) {
+    using namespace simd;
+
+    const f32x4 one = set1(1.0f);
+    const f32x4 half = set1(0.5f);
+    const f32x4 two = set1(2.0f);
+
+    // Unused lanes of the last vector design a harmless 1 kHz / Q 1 peak
+    const uint32_t num_vectors = (count + 3) / 4;
+    radioform_band_t tail[4];
+    for (uint32_t i = 0; i < 4; i++) {
+        const uint32_t index = (num_vectors - 1) * 4 + i;
+        tail[i] = index < count ? bands[index]
+                                : radioform_band_t{1000.0f, 0.0f, 1.0f, RADIOFORM_FILTER_PEAK, false};
+    }
+
+    // Transcendentals
+    const f32x4 w_scale = set1(2.0f * PI / sample_rate);
+    const f32x4 gain_scale = set1(0.5f * kGainToLog2A);
+    f32x4 w0[kMaxVectors], sin_w0[kMaxVectors], cos_w0[kMaxVectors];
+    f32x4 sqrt_A[kMaxVectors], inv_A[kMaxVectors], inv_q[kMaxVectors], type[kMaxVectors];
+    for (uint32_t v = 0; v < num_vectors; v++) {
+        const radioform_band_t* b = (v + 1 < num_vectors) ? bands + v * 4 : tail;
+        w0[v] = set(b[0].frequency_hz, b[1].frequency_hz, b[2].frequency_hz, b[3].frequency_hz) * w_scale;
+        inv_q[v] = one / set(b[0].q_factor, b[1].q_factor, b[2].q_factor, b[3].q_factor);
+        type[v] = set(static_cast<float>(b[0].type), static_cast<float>(b[1].type),
+                      static_cast<float>(b[2].type), static_cast<float>(b[3].type));
+        const f32x4 half_log2_A = set(b[0].gain_db, b[1].gain_db, b[2].gain_db, b[3].gain_db) * gain_scale;
+
+        fast_math::sincos(w0[v], sin_w0[v], cos_w0[v]);
+        // A = 10^(gain / 40); shelves also need sqrt(A) = 10^(gain / 80)
+        sqrt_A[v] = fast_math::exp2(half_log2_A);
+        const f32x4 inv_sqrt_A = fast_math::exp2(zero() - half_log2_A);
+        inv_A[v] = inv_sqrt_A * inv_sqrt_A;
+    }
+
+    // Per-type numerator and denominator, selected per lane
+    for (uint32_t v = 0; v < num_vectors; v++) {
+        const f32x4 t = type[v];
+        const f32x4 s = sin_w0[v];
+        const f32x4 c = cos_w0[v];
+        const f32x4 A = sqrt_A[v] * sqrt_A[v];
+
+        // alpha = sin(w0) / (2 Q warp), warp = w0 / sin(w0) above w0 = 0.01
+        const f32x4 unwarp = select(cmp_le(set1(0.01f), w0[v]), s / w0[v], one);
+        const f32x4 alpha = s * unwarp * inv_q[v] * half;
+        const f32x4 minus_two_cos = zero() - two * c;
+
+        // LP / HP / notch / band-pass share the denominator 1 + alpha, -2 cos, 1 - alpha
+        const m32x4 low_pass = is_type(t, RADIOFORM_FILTER_LOW_PASS);
+        const m32x4 high_pass = is_type(t, RADIOFORM_FILTER_HIGH_PASS);
+        const m32x4 notch = is_type(t, RADIOFORM_FILTER_NOTCH);
+        const f32x4 lp_b0 = (one - c) * half;
+        const f32x4 hp_b0 = (one + c) * half;
+        f32x4 b0 = select(low_pass, lp_b0, select(high_pass, hp_b0, select(notch, one, alpha)));
+        f32x4 b1 = select(low_pass, one - c,
+                   select(high_pass, zero() - (one + c), select(notch, minus_two_cos, zero())));
+        f32x4 b2 = select(low_pass, lp_b0, select(high_pass, hp_b0, select(notch, one, zero() - alpha)));
+        f32x4 a0 = one + alpha;
+        f32x4 a1 = minus_two_cos;
+        f32x4 a2 = one - alpha;
+
+        // Peak
+        const m32x4 peak = is_type(t, RADIOFORM_FILTER_PEAK);
+        const f32x4 alpha_times_A = alpha * A;
+        const f32x4 alpha_over_A = alpha * inv_A[v];
+        b0 = select(peak, one + alpha_times_A, b0);
+        b2 = select(peak, one - alpha_times_A, b2);
+        b1 = select(peak, minus_two_cos, b1);
+        a0 = select(peak, one + alpha_over_A, a0);
+        a2 = select(peak, one - alpha_over_A, a2);
+
+        // Shelves: the high shelf is the low shelf with cos(w0) negated and
+        // b1 / a1 negated
+        const m32x4 shelf = cmp_le(abs(t - set1(1.5f)), half);  // Low or high shelf
+        const m32x4 high_shelf = is_type(t, RADIOFORM_FILTER_HIGH_SHELF);
+        const f32x4 sc = select(high_shelf, zero() - c, c);
+        const f32x4 sign = select(high_shelf, zero() - one, one);
+        const f32x4 beta_sin = sqrt_A[v] * inv_q[v] * s;
+        const f32x4 ap1 = A + one;
+        const f32x4 am1 = A - one;
+        const f32x4 n = ap1 - am1 * sc;
+        const f32x4 d = ap1 + am1 * sc;
+        b0 = select(shelf, A * (n + beta_sin), b0);
+        b1 = select(shelf, sign * two * A * (am1 - ap1 * sc), b1);
+        b2 = select(shelf, A * (n - beta_sin), b2);
+        a0 = select(shelf, d + beta_sin, a0);
+        a1 = select(shelf, zero() - sign * two * (am1 + ap1 * sc), a1);
+        a2 = select(shelf, d - beta_sin, a2);
+
+        // Unknown types fall back to flat
+        const m32x4 known = cmp_le(abs(t - set1(3.0f)), set1(3.5f));
+        const f32x4 inv_a0 = one / a0;
+        alignas(16) float out[5][4];
+        store(out[0], select(known, b0 * inv_a0, one));
+        store(out[1], select(known, b1 * inv_a0, zero()));
+        store(out[2], select(known, b2 * inv_a0, zero()));
+        store(out[3], select(known, a1 * inv_a0, zero()));
+        store(out[4], select(known, a2 * inv_a0, zero()));
+
+        const uint32_t lanes = std::min(4u, count - v * 4);
+        for (uint32_t i = 0; i < lanes; i++) {
+            coeffs[v * 4 + i] = {out[0][i], out[1][i], out[2][i], out[3][i], out[4][i]};
+        }
+    }
+}
+
+} // namespace
+
+void design_biquads(const radioform_band_t* bands, uint32_t count, float sample_rate,
+                    BiquadCoeffs* coeffs) {
+    for (uint32_t first = 0; first < count; first += kMaxBatch) {
+        design_batch(bands + first, std::min(kMaxBatch, count - first), sample_rate, coeffs + first);
+    }
+}
+
+} // namespace radioform
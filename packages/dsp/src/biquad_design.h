@@ -0,0 +1,36 @@
+/**
+ * @file biquad_design.h
+ * @brief Batch biquad coefficient design in SIMD lanes
+ *
+ * Same formulas as Biquad::calculateCoeffs(), four bands per vector: the
+ * transcendentals (sin/cos of w0, the shelf and peak gains) come from the
+ * polynomials in fast_math.h instead of libm, and each band takes one
+ * divide. Used wherever the engine designs coefficients (preset apply,
+ * realtime updates, sample-rate changes).
+ */
+
+#ifndef RADIOFORM_BIQUAD_DESIGN_H
+#define RADIOFORM_BIQUAD_DESIGN_H
+
+#include "biquad.h"
+
+namespace radioform {
+
+/**
+ * @brief Design coefficients for several bands at once
+ *
+ * Results match Biquad::calculateCoeffs() to within a few float ulps of
+ * its own rounding. Disabled bands are designed like enabled ones; callers
+ * decide what to do with them.
+ *
+ * @param bands Band configurations
+ * @param count Number of bands
+ * @param sample_rate Sample rate in Hz
+ * @param coeffs Receives count coefficient sets
+ */
+void design_biquads(const radioform_band_t* bands, uint32_t count, float sample_rate,
+                    BiquadCoeffs* coeffs);
+
+} // namespace radioform
+
+#endif // RADIOFORM_BIQUAD_DESIGN_H
@@ -0,0 +1,98 @@
+/**
+ * @file block_iir.h
+ * @brief Block state-space (look-ahead) form of the biquad cascade
+ *
+ * A TDF2 biquad is the state-space system
+ *
+ *   s[n+1] = A s[n] + B x[n],   y[n] = C s[n] + D x[n]
+ *
+ * with s = (z1, z2). Unrolled over a block of kBlockSize samples, the block's
+ * outputs are one matrix-vector product of the incoming state and inputs:
+ *
+ *   Y = O s + T X     (O = rows C A^n, T = lower-triangular impulse response)
+ *
+ * Each output lane is an independent sum of products, so a whole block is a
+ * handful of vector multiply-adds. Only the state hand-off between blocks is
+ * serial, and it is rebuilt from the last two outputs exactly like the
+ * per-sample recursion would. Used by the planar path for long buffers; the
+ * kernel is process_block_cascade() in kernels_impl.h.
+ */
+
+#ifndef RADIOFORM_BLOCK_IIR_H
+#define RADIOFORM_BLOCK_IIR_H
+
+#include "biquad.h"
+
+#include <cstdint>
+#include <cstring>
+
+namespace radioform {
+
+/**
+ * @brief Precomputed block matrices of one biquad section
+ */
+class BlockBiquad {
+public:
+    static constexpr uint32_t kBlockSize = 4;
+
+    /**
+     * @brief Recompute the block matrices if the coefficients changed
+     *
+     * @note REALTIME-SAFE: A few dozen flops, no allocations
+     */
+    void update(const BiquadCoeffs& c) {
+        if (valid_ && std::memcmp(&c, &coeffs_, sizeof(BiquadCoeffs)) == 0) {
+            return;
+        }
+        coeffs_ = c;
+        computeMatrices();
+        valid_ = true;
+    }
+
+    const BiquadCoeffs& coeffs() const { return coeffs_; }
+
+    // Block output Y[n] = z1 * from_z1[n] + z2 * from_z2[n] + sum_k X[k] * from_x[k][n]
+    alignas(16) float from_z1[kBlockSize];
+    alignas(16) float from_z2[kBlockSize];
+    alignas(16) float from_x[kBlockSize][kBlockSize];
+
+private:
+    void computeMatrices() {
+        const double b0 = coeffs_.b0;
+        const double a1 = coeffs_.a1;
+        const double a2 = coeffs_.a2;
+        const double gain_z1 = coeffs_.b1 - a1 * b0;  // B = (b1 - a1 b0, b2 - a2 b0)
+        const double gain_z2 = coeffs_.b2 - a2 * b0;
+
+        // Rows C A^n, with C = (1, 0) and A = [[-a1, 1], [-a2, 0]]
+        double row[kBlockSize][2];
+        row[0][0] = 1.0;
+        row[0][1] = 0.0;
+        for (uint32_t n = 1; n < kBlockSize; n++) {
+            row[n][0] = -a1 * row[n - 1][0] - a2 * row[n - 1][1];
+            row[n][1] = row[n - 1][0];
+        }
+
+        // Impulse response h[0] = D, h[n] = C A^(n-1) B
+        double h[kBlockSize];
+        h[0] = b0;
+        for (uint32_t n = 1; n < kBlockSize; n++) {
+            h[n] = row[n - 1][0] * gain_z1 + row[n - 1][1] * gain_z2;
+        }
+
+        for (uint32_t n = 0; n < kBlockSize; n++) {
+            from_z1[n] = static_cast<float>(row[n][0]);
+            from_z2[n] = static_cast<float>(row[n][1]);
+            for (uint32_t k = 0; k < kBlockSize; k++) {
+                from_x[k][n] = n >= k ? static_cast<float>(h[n - k]) : 0.0f;
+            }
+        }
+    }
+
+    BiquadCoeffs coeffs_ = {};
+    bool valid_ = false;
+};
+
+} // namespace radioform
+
+#endif // RADIOFORM_BLOCK_IIR_H
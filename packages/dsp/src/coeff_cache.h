@@ -0,0 +1,167 @@
+/**
+ * @file coeff_cache.h
+ * @brief Fixed-capacity cache of designed biquad coefficients
+ *
+ * Slider automation and preset toggling keep asking for the same designs.
+ * Bands are keyed by type, sample rate and their parameters quantized to
+ * 0.01 Hz, 0.001 dB and 0.0001 Q, and designed from the quantized values,
+ * so a cached design is exactly what a fresh one would be. Entries live in
+ * a fixed array with a hashed index and are evicted by CLOCK (second
+ * chance); nothing is allocated after construction.
+ *
+ * Used from the control thread only; the hit/miss counters may be read from
+ * any thread.
+ */
+
+#ifndef RADIOFORM_COEFF_CACHE_H
+#define RADIOFORM_COEFF_CACHE_H
+
+#include "radioform_types.h"
+#include "biquad.h"
+
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+
+namespace radioform {
+
+/**
+ * @brief Quantized band design parameters
+ */
+struct CoeffKey {
+    uint32_t type;
+    uint32_t sample_rate;
+    int32_t frequency;  // 0.01 Hz
+    int32_t gain;       // 0.001 dB
+    int32_t q;          // 0.0001
+
+    bool operator==(const CoeffKey& other) const {
+        return type == other.type && sample_rate == other.sample_rate && frequency == other.frequency &&
+               gain == other.gain && q == other.q;
+    }
+};
+
+class CoefficientCache {
+public:
+    static constexpr uint32_t kCapacity = 128;  // Eight full presets and change
+
+    static CoeffKey quantize(const radioform_band_t& band, uint32_t sample_rate) {
+        return {static_cast<uint32_t>(band.type), sample_rate,
+                static_cast<int32_t>(std::lround(band.frequency_hz * kFrequencyScale)),
+                static_cast<int32_t>(std::lround(band.gain_db * kGainScale)),
+                static_cast<int32_t>(std::lround(band.q_factor * kQScale))};
+    }
+
+    /**
+     * @brief Band with the key's parameters, to design a missed entry from
+     */
+    static radioform_band_t dequantize(const CoeffKey& key) {
+        radioform_band_t band;
+        band.frequency_hz = static_cast<float>(key.frequency) / kFrequencyScale;
+        band.gain_db = static_cast<float>(key.gain) / kGainScale;
+        band.q_factor = static_cast<float>(key.q) / kQScale;
+        band.type = static_cast<radioform_filter_type_t>(key.type);
+        band.enabled = true;
+        return band;
+    }
+
+    CoefficientCache() {
+        for (uint32_t i = 0; i < kNumBuckets; i++) {
+            buckets_[i] = kEmpty;
+        }
+    }
+
+    /**
+     * @brief Cached design for key, or nullptr (counted as a hit or a miss)
+     */
+    const BiquadCoeffs* find(const CoeffKey& key) {
+        for (uint32_t i = buckets_[bucket(key)]; i != kEmpty; i = entries_[i].next) {
+            if (entries_[i].key == key) {
+                entries_[i].referenced = true;
+                hits_.fetch_add(1, std::memory_order_relaxed);
+                return &entries_[i].coeffs;
+            }
+        }
+        misses_.fetch_add(1, std::memory_order_relaxed);
+        return nullptr;
+    }
+
+    /**
+     * @brief Add a design, evicting the first entry the clock hand finds unreferenced
+     */
+    void insert(const CoeffKey& key, const BiquadCoeffs& coeffs) {
+        const uint32_t b = bucket(key);
+        for (uint32_t i = buckets_[b]; i != kEmpty; i = entries_[i].next) {
+            if (entries_[i].key == key) {
+                entries_[i].coeffs = coeffs;
+                return;
+            }
+        }
+
+        uint32_t slot;
+        if (size_ < kCapacity) {
+            slot = size_++;
+        } else {
+            while (entries_[hand_].referenced) {
+                entries_[hand_].referenced = false;
+                hand_ = (hand_ + 1) % kCapacity;
+            }
+            slot = hand_;
+            hand_ = (hand_ + 1) % kCapacity;
+            unlink(slot);
+        }
+
+        Entry& entry = entries_[slot];
+        entry.key = key;
+        entry.coeffs = coeffs;
+        entry.referenced = false;
+        entry.next = buckets_[b];
+        buckets_[b] = static_cast<uint16_t>(slot);
+    }
+
+    uint64_t hits() const { return hits_.load(std::memory_order_relaxed); }
+    uint64_t misses() const { return misses_.load(std::memory_order_relaxed); }
+
+private:
+    static constexpr float kFrequencyScale = 100.0f;
+    static constexpr float kGainScale = 1000.0f;
+    static constexpr float kQScale = 10000.0f;
+    static constexpr uint32_t kNumBuckets = 2 * kCapacity;
+    static constexpr uint16_t kEmpty = 0xFFFF;
+    static_assert((kNumBuckets & (kNumBuckets - 1)) == 0, "bucket count must be a power of two");
+
+    struct Entry {
+        CoeffKey key;
+        BiquadCoeffs coeffs;
+        bool referenced;  // Set on a hit, cleared as the clock hand passes
+        uint16_t next;    // Next entry in the same bucket
+    };
+
+    static uint32_t bucket(const CoeffKey& key) {
+        uint32_t h = key.type * 0x9E3779B1u;
+        h = (h ^ key.sample_rate) * 0x85EBCA6Bu;
+        h = (h ^ static_cast<uint32_t>(key.frequency)) * 0xC2B2AE35u;
+        h = (h ^ static_cast<uint32_t>(key.gain)) * 0x27D4EB2Fu;
+        h = (h ^ static_cast<uint32_t>(key.q)) * 0x165667B1u;
+        return (h ^ (h >> 15)) & (kNumBuckets - 1);
+    }
+
+    void unlink(uint32_t slot) {
+        uint16_t* link = &buckets_[bucket(entries_[slot].key)];
+        while (*link != slot) {
+            link = &entries_[*link].next;
+        }
+        *link = entries_[slot].next;
+    }
+
+    Entry entries_[kCapacity] = {};
+    uint16_t buckets_[kNumBuckets];
+    uint32_t size_ = 0;
+    uint32_t hand_ = 0;
+    std::atomic<uint64_t> hits_{0};
+    std::atomic<uint64_t> misses_{0};
+};
+
+} // namespace radioform
+
+#endif // RADIOFORM_COEFF_CACHE_H
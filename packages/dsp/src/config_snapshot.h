@@ -0,0 +1,131 @@
+/**
+ * @file config_snapshot.h
+ * @brief Double-buffered engine configuration, swapped in by the audio thread
+ *
+ * A preset apply designs the complete configuration (coefficients, band
+ * packing, parallel form, preamp and limiter settings) into an EngineConfig
+ * on the control thread and publishes it with one pointer store. The audio
+ * thread takes it at the start of its next buffer and copies it into its
+ * filters; it never waits and never sees a half-written configuration.
+ */
+
+#ifndef RADIOFORM_CONFIG_SNAPSHOT_H
+#define RADIOFORM_CONFIG_SNAPSHOT_H
+
+#include "radioform_types.h"
+#include "biquad.h"
+#include "svf.h"
+#include "parallel_eq.h"
+
+#include <atomic>
+#include <cstdint>
+
+namespace radioform {
+
+/**
+ * @brief Two snapshot slots handed from one producer to one consumer
+ *
+ * At most one slot is published and not yet taken. Reclamation is by epoch:
+ * the audio thread retires the slot it held when it takes a newer one, and
+ * the control thread learns that from pending_ having been emptied. A
+ * snapshot that was published but not taken yet is withdrawn and rewritten,
+ * so neither side ever waits for the other (a stopped audio thread included).
+ */
+template <typename T>
+class SnapshotExchange {
+public:
+    // ------------------------------------------------------------------------
+    // Control thread
+    // ------------------------------------------------------------------------
+
+    /**
+     * @brief Slot to build the next snapshot in (not visible to the audio thread)
+     */
+    T& acquire() {
+        T* withdrawn = pending_.exchange(nullptr, std::memory_order_acq_rel);
+        if (withdrawn) {
+            building_ = withdrawn;
+        } else {
+            // The last published snapshot was taken; the one before it is retired
+            if (latest_) {
+                audio_slot_ = latest_;
+            }
+            building_ = (audio_slot_ == &slots_[0]) ? &slots_[1] : &slots_[0];
+        }
+        latest_ = nullptr;
+        return *building_;
+    }
+
+    /**
+     * @brief Hand the slot returned by acquire() to the audio thread
+     */
+    void publish() {
+        latest_ = building_;
+        pending_.store(building_, std::memory_order_release);
+    }
+
+    /**
+     * @brief Most recently published snapshot (nullptr while one is being built)
+     */
+    const T* latest() const { return latest_; }
+
+    // ------------------------------------------------------------------------
+    // Audio thread
+    // ------------------------------------------------------------------------
+
+    /**
+     * @brief Newly published snapshot, or nullptr if there is none
+     *
+     * The returned snapshot stays valid until the next take() returns a newer one.
+     */
+    const T* take() {
+        if (!pending_.load(std::memory_order_relaxed)) {
+            return nullptr;
+        }
+        return pending_.exchange(nullptr, std::memory_order_acq_rel);
+    }
+
+private:
+    T slots_[2] = {};
+    std::atomic<T*> pending_{nullptr};
+    T* audio_slot_ = nullptr;  // Control thread's view: slot the audio thread holds
+    T* building_ = nullptr;
+    T* latest_ = nullptr;
+};
+
+/**
+ * @brief Complete engine configuration designed by one preset apply
+ */
+struct EngineConfig {
+    uint32_t epoch;  // Queued parameter updates must match it
+    uint32_t num_bands;
+
+    // Per band: structure, and coefficients for both structures
+    // (disabled bands are flat biquads)
+    radioform_filter_topology_t topology[RADIOFORM_MAX_BANDS];
+    BiquadCoeffs biquad[RADIOFORM_MAX_BANDS];
+    SvfCoeffs svf[RADIOFORM_MAX_BANDS];
+
+    // Enabled bands in processing order, split by structure
+    uint32_t packed_bands[RADIOFORM_MAX_BANDS];
+    uint32_t num_sections;
+    uint32_t svf_band_indices[RADIOFORM_MAX_BANDS];
+    uint32_t num_svf_bands;
+
+    // Parallel form of the packed bands (parallel mode, when accepted)
+    bool parallel;
+    ParallelDesign parallel_design;
+
+    float preamp_gain;
+    bool limiter_enabled;
+    float limiter_threshold_db;
+    radioform_limiter_mode_t limiter_mode;
+    uint32_t limiter_oversampling;      // Soft mode: 1, 2, 4 or 8
+    uint32_t limiter_lookahead_frames;  // Lookahead mode
+    float limiter_release_frames;
+    uint32_t latency_frames;            // Output delay of the limiter stage
+};
+
+} // namespace radioform
+
+#endif // RADIOFORM_CONFIG_SNAPSHOT_H
@@ -16,6 +16,15 @@
 
 namespace radioform {
 
+/**
+ * @brief Cache line size assumed for data layout
+ *
+ * 64 bytes on current x86 and most ARM cores. Apple silicon uses 128-byte
+ * lines; 64-byte separation still keeps hot and cold data apart there, it
+ * only halves the false-sharing guard.
+ */
+static constexpr uint32_t kCacheLineSize = 64;
+
 /**
  * @brief Enable denormal (subnormal) suppression for performance
  *
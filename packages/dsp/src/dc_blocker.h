@@ -9,6 +9,8 @@
 #ifndef RADIOFORM_DC_BLOCKER_H
 #define RADIOFORM_DC_BLOCKER_H
 
+#include "radioform_types.h"
+
 #include <cstdint>
 #include <cmath>
 
@@ -88,6 +90,17 @@ public:
         }
     }
 
+    /**
+     * @brief Filter coefficient (for vectorized kernels)
+     */
+    float coefficient() const { return coeff_; }
+
+    /**
+     * @brief Access filter state (for vectorized kernels)
+     */
+    float& inputState() { return x_prev_; }
+    float& outputState() { return y_prev_; }
+
 private:
     float coeff_ = 0.9993f;  // ~5Hz @ 48kHz
     float x_prev_ = 0.0f;    // Previous input
@@ -125,11 +138,39 @@ public:
         }
     }
 
+    DCBlocker& left() { return left_; }
+    DCBlocker& right() { return right_; }
+
 private:
     DCBlocker left_;
     DCBlocker right_;
 };
 
+/**
+ * @brief DC blocker for up to RADIOFORM_MAX_CHANNELS channels
+ *
+ * Used by multichannel engines; the kernel reads each channel's state.
+ */
+class MultichannelDCBlocker {
+public:
+    void init(float sample_rate, float cutoff_hz = 5.0f) {
+        for (DCBlocker& dc : channels_) {
+            dc.init(sample_rate, cutoff_hz);
+        }
+    }
+
+    void reset() {
+        for (DCBlocker& dc : channels_) {
+            dc.reset();
+        }
+    }
+
+    DCBlocker& channel(uint32_t index) { return channels_[index]; }
+
+private:
+    DCBlocker channels_[RADIOFORM_MAX_CHANNELS];
+};
+
 } // namespace radioform
 
 #endif // RADIOFORM_DC_BLOCKER_H
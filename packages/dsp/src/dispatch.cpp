@@ -0,0 +1,104 @@
+/**
+ * @file dispatch.cpp
+ * @brief CPU feature detection and kernel table selection
+ */
+
+#include "dispatch.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+    #if defined(__GNUC__) || defined(__clang__)
+        #include <cpuid.h>
+    #endif
+#elif defined(__aarch64__) && defined(__linux__)
+    #include <sys/auxv.h>
+#endif
+
+namespace radioform {
+
+namespace {
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+
+// XCR0: SSE and AVX register state (bits 1-2), AVX-512 state (bits 5-7)
+constexpr uint64_t kXcr0AvxState = 0x6;
+constexpr uint64_t kXcr0Avx512State = 0xE0;
+
+uint64_t read_xcr0() {
+    uint32_t eax, edx;
+    __asm__ __volatile__("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+    return (static_cast<uint64_t>(edx) << 32) | eax;
+}
+
+uint32_t detect_x86_features() {
+    unsigned int eax, ebx, ecx, edx;
+    if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx)) {
+        return 0;
+    }
+
+    uint32_t features = 0;
+    if (edx & (1u << 26)) features |= RADIOFORM_CPU_SSE2;
+
+    // AVX state must be enabled by the OS, not just supported by the CPU
+    const bool osxsave = (ecx & (1u << 27)) != 0;
+    const uint64_t xcr0 = osxsave ? read_xcr0() : 0;
+    const bool avx_state = (xcr0 & kXcr0AvxState) == kXcr0AvxState;
+    const bool avx512_state = avx_state && (xcr0 & kXcr0Avx512State) == kXcr0Avx512State;
+
+    if (!avx_state) {
+        return features;
+    }
+    if (ecx & (1u << 28)) features |= RADIOFORM_CPU_AVX;
+    if (ecx & (1u << 12)) features |= RADIOFORM_CPU_FMA;
+
+    if (__get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx)) {
+        if (ebx & (1u << 5)) features |= RADIOFORM_CPU_AVX2;
+        if (avx512_state && (ebx & (1u << 16))) features |= RADIOFORM_CPU_AVX512F;
+    }
+    return features;
+}
+
+#endif
+
+} // namespace
+
+uint32_t detect_cpu_features() {
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+    return detect_x86_features();
+#elif defined(__aarch64__) || defined(_M_ARM64)
+    // NEON (Advanced SIMD) is mandatory on AArch64
+    uint32_t features = RADIOFORM_CPU_NEON;
+    #if defined(__linux__) && defined(HWCAP_SVE)
+        if (getauxval(AT_HWCAP) & HWCAP_SVE) features |= RADIOFORM_CPU_SVE;
+    #endif
+    return features;
+#else
+    return 0;
+#endif
+}
+
+uint32_t supported_kernel_tables(uint32_t features, const KernelTable** tables, uint32_t max_tables) {
+    const KernelTable* const candidates[] = {
+        &baseline::kKernelTable,
+#if RADIOFORM_HAVE_AVX2_KERNELS
+        &avx2::kKernelTable,
+#endif
+    };
+
+    uint32_t count = 0;
+    for (const KernelTable* table : candidates) {
+        const bool runnable = (features & table->required_features) == table->required_features;
+        if (runnable && count < max_tables) {
+            tables[count++] = table;
+        }
+    }
+    return count;
+}
+
+const KernelTable& select_kernel_table(uint32_t features) {
+    // Candidates are ordered from least to most capable
+    const KernelTable* tables[4];
+    const uint32_t count = supported_kernel_tables(features, tables, 4);
+    return count > 0 ? *tables[count - 1] : baseline::kKernelTable;
+}
+
+} // namespace radioform
@@ -0,0 +1,96 @@
+/**
+ * @file dispatch.h
+ * @brief Runtime CPU feature detection and kernel tables
+ *
+ * Every vector kernel is compiled once per instruction set, each copy in its
+ * own translation unit and namespace (kernels_baseline.cpp, kernels_avx2.cpp;
+ * the code is shared through kernels_impl.h). Each copy exports a
+ * KernelTable. radioform_dsp_create() detects the CPU's features and binds
+ * the best table the CPU can run; the baseline table (the library's build
+ * target: SSE2, NEON or scalar) is always available.
+ */
+
+#ifndef RADIOFORM_DISPATCH_H
+#define RADIOFORM_DISPATCH_H
+
+#include "radioform_types.h"
+#include "stereo_kernel.h"
+#include "multichannel_kernel.h"
+#include "engine_group.h"
+#include "block_iir.h"
+
+#include <cstdint>
+
+// AVX2 kernels need GCC/Clang target attributes
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+    #define RADIOFORM_HAVE_AVX2_KERNELS 1
+#else
+    #define RADIOFORM_HAVE_AVX2_KERNELS 0
+#endif
+
+namespace radioform {
+
+/**
+ * @brief Function pointers for one instruction set
+ *
+ * All tables compute the same results up to rounding (the AVX2 set fuses
+ * multiply-adds).
+ */
+struct KernelTable {
+    const char* name;            // Reported by radioform_dsp_get_kernel_info()
+    uint32_t vector_width;       // Float lanes per vector in the planar kernels
+    uint32_t required_features;  // radioform_cpu_feature_t bits
+
+    // Interleaved chain: kernels for a chain's structure, band count and limiter state
+    StereoKernels (*select_stereo)(const StereoChain& chain);
+
+    // Planar stages, in place
+    void (*parallel_eq)(ParallelEQ& eq, float* left, float* right, uint32_t num_frames);
+    void (*block_cascade)(
+        const BlockBiquad* sections, BiquadBank& bank,
+        float* left, float* right, uint32_t num_frames);
+    void (*dc_blocker)(StereoDCBlocker& dc, float* left, float* right, uint32_t num_frames);
+    void (*limiter)(const SoftLimiter& limiter, float* left, float* right, uint32_t num_frames);
+
+    // Planar peak meter (linear)
+    StereoPeak (*peak)(const float* left, const float* right, uint32_t num_frames);
+
+    // Whole chain on padded frames, channels in lanes (engines with != 2 channels)
+    MultichannelKernelFn multichannel;
+
+    // Engine groups: transposed block, one engine per lane
+    GroupKernelFn group;
+};
+
+namespace baseline {
+extern const KernelTable kKernelTable;
+}
+
+#if RADIOFORM_HAVE_AVX2_KERNELS
+namespace avx2 {
+extern const KernelTable kKernelTable;
+}
+#endif
+
+/**
+ * @brief Detect CPU features (radioform_cpu_feature_t bits)
+ *
+ * Only reports features the OS has enabled (e.g. AVX needs XSAVE support).
+ */
+uint32_t detect_cpu_features();
+
+/**
+ * @brief Best kernel table for a feature set
+ */
+const KernelTable& select_kernel_table(uint32_t features);
+
+/**
+ * @brief All kernel tables runnable with a feature set, baseline first
+ *
+ * @return Number of tables written (at most max_tables)
+ */
+uint32_t supported_kernel_tables(uint32_t features, const KernelTable** tables, uint32_t max_tables);
+
+} // namespace radioform
+
+#endif // RADIOFORM_DISPATCH_H
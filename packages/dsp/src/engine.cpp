@@ -8,11 +8,29 @@
 
 #include "radioform_dsp.h"
 #include "biquad.h"
+#include "biquad_bank.h"
+#include "biquad_design.h"
+#include "coeff_cache.h"
+#include "svf.h"
 #include "smoothing.h"
 #include "limiter.h"
+#include "lookahead_limiter.h"
+#include "oversampler.h"
+#include "true_peak.h"
+#include "loudness_meter.h"
+#include "spectrum_analyzer.h"
 #include "dc_blocker.h"
 #include "cpu_util.h"
-
+#include "parallel_eq.h"
+#include "block_iir.h"
+#include "stereo_kernel.h"
+#include "multichannel_kernel.h"
+#include "dispatch.h"
+#include "parameter_queue.h"
+#include "config_snapshot.h"
+
+#include <algorithm>
+#include <cstdint>
 #include <cstring>
 #include <cmath>
 #include <atomic>
@@ -21,56 +39,231 @@
 
 using namespace radioform;
 
+// Planar buffers at least this long run the cascade in block state-space form
+static constexpr uint32_t kBlockIIRMinFrames = 64;
+
+// Planar sub-block length: 2 KB of stereo samples, so every stage after the
+// first reads from L1. A multiple of the block IIR / DC blocker step (4), so
+// their block boundaries do not depend on the sub-block split.
+static constexpr uint32_t kPlanarBlockFrames = 256;
+static_assert(kPlanarBlockFrames % BlockBiquad::kBlockSize == 0,
+              "sub-blocks must keep the block IIR alignment");
+
 // ============================================================================
 // Engine Internal Structure
 // ============================================================================
 
 struct radioform_dsp_engine {
+    // ------------------------------------------------------------------------
+    // Audio thread: read or written on every buffer
+    // ------------------------------------------------------------------------
+
     // Sample rate
     uint32_t sample_rate;
 
-    // EQ bands (each biquad handles stereo)
+    // Channels per frame (fixed at creation). Stereo engines run the stereo
+    // kernels; any other count runs the multichannel kernel.
+    uint32_t num_channels;
+
+    // Kernel set for this CPU (bound once, in radioform_dsp_create)
+    const KernelTable* kernels;
+
+    // Packed chain of enabled bands and the kernels for it
+    // (rebuilt by radioform_dsp_apply_preset)
+    StereoChain chain;
+    StereoKernels stereo_kernels;
+
+    // Coefficients and state of the packed bands (structure of arrays)
+    BiquadBank cascade;
+
+    // Per-band coefficient design and ramps; processing reads the cascade
     std::array<Biquad, RADIOFORM_MAX_BANDS> bands;
     uint32_t num_active_bands;
 
-    // Current preset configuration
-    radioform_preset_t current_preset;
+    // Filter structure of each band (from the installed configuration)
+    std::array<radioform_filter_topology_t, RADIOFORM_MAX_BANDS> topology;
+
+    // Epoch of the installed configuration
+    uint32_t active_epoch;
 
     // Parameter smoothing
     ParameterSmoother preamp_smoother;
 
-    // Coefficient interpolation duration in samples (~10ms)
-    int coeff_transition_samples;
+    // Fixed 1.0 gain: the preamp of the interleaved kernels when the preamp
+    // has already been applied ahead of the state-variable bands
+    ParameterSmoother unity_gain;
 
-    // Limiter
+    // Limiter: soft waveshaper (limiter_enabled, fused into the kernels), the
+    // soft waveshaper oversampled (oversampled_limiter) or lookahead
+    // (lookahead_enabled); the last two run their own pass after the kernels
     SoftLimiter limiter;
     bool limiter_enabled;
+    Oversampler oversampler;
+    bool oversampled_limiter;
+    LookaheadLimiter lookahead_limiter;
+    bool lookahead_enabled;
 
     // DC Blocker (prevents DC offset buildup)
     StereoDCBlocker dc_blocker;
 
-    // Bypass (atomic for lock-free realtime control)
-    std::atomic<bool> bypass;
+    // True-peak meter on the output (true_peak_active: running since the
+    // last time it was switched on)
+    TruePeakMeter true_peak_meter;
+    bool true_peak_active;
+
+    // Loudness meter on the output (same switch-on rule as the true-peak meter)
+    LoudnessMeter loudness_meter;
+    bool loudness_active;
+
+    // Frames since the last coefficient ramp step. All ramps share this
+    // clock, so buffers only need splitting at one set of step boundaries.
+    uint32_t ramp_phase;
+
+    // Band index of each cascade section (used when ramps step)
+    uint32_t packed_bands[RADIOFORM_MAX_BANDS];
+
+    // Low-frequency bands on the state-variable topology, run ahead of the
+    // packed chain (indexed by band; svf_band_indices lists the active ones)
+    std::array<StateVariableFilter, RADIOFORM_MAX_BANDS> svf_bands;
+    uint32_t svf_band_indices[RADIOFORM_MAX_BANDS];
+    uint32_t num_svf_bands;
+
+    // Block matrices for the packed bands (planar path, long buffers)
+    std::array<BlockBiquad, RADIOFORM_MAX_BANDS> block_sections;
+
+    // Parallel-form filter bank (chain.parallel says whether it is in use)
+    ParallelEQ parallel_eq;
+
+    // Multichannel engines: chain, per-channel DC blockers and the padded
+    // block the kernel works on (channel lanes past num_channels stay zero)
+    MultichannelChain channel_chain;
+    MultichannelDCBlocker channel_dc;
+    alignas(kCacheLineSize) float channel_frames[kPlanarBlockFrames * kFrameStride];
+
+    // ------------------------------------------------------------------------
+    // Control thread: configuration, touched when parameters change
+    // ------------------------------------------------------------------------
+
+    // Detected CPU features (radioform_dsp_get_kernel_info)
+    uint32_t cpu_features;
+
+    // Current preset configuration (realtime edits included)
+    radioform_preset_t current_preset;
+
+    // Epoch of the last configuration designed. Queued updates carry the
+    // epoch they were designed for; the audio thread drops those made for a
+    // configuration it has since replaced.
+    uint32_t config_epoch;
+
+    // Latest coefficients designed for each biquad band, and whether the
+    // parallel form is in use, as the control thread last left them (the
+    // parallel design is converted from these, not from the audio side)
+    BiquadCoeffs control_coeffs[RADIOFORM_MAX_BANDS];
+    bool control_parallel;
+
+    // Coefficient interpolation duration in samples (~10ms)
+    int coeff_transition_samples;
+
+    // Requested EQ structure, and per band slot (RADIOFORM_TOPOLOGY_AUTO:
+    // svf_preferred() decides)
+    radioform_eq_mode_t eq_mode;
+    radioform_filter_topology_t requested_topology[RADIOFORM_MAX_BANDS];
+
+    // Requested limiter mode, oversampling (soft mode) and lookahead timing
+    radioform_limiter_mode_t limiter_mode;
+    uint32_t limiter_oversampling;
+    float limiter_lookahead_ms;
+    float limiter_release_ms;
+
+    // Designs of recently used band settings (hit/miss counts are in the stats)
+    CoefficientCache coeff_cache;
+
+    // ------------------------------------------------------------------------
+    // Analysis thread: radioform_dsp_analyze_spectrum()
+    // ------------------------------------------------------------------------
+
+    SpectrumAnalyzer spectrum_analyzer;
+
+    // ------------------------------------------------------------------------
+    // Shared with the UI thread: one cache line each, so polling the stats
+    // never pulls in a line the audio thread is writing anything else to
+    // ------------------------------------------------------------------------
+
+    // Preset configurations and realtime parameter updates, both taken by
+    // the audio thread at the start of each buffer
+    alignas(kCacheLineSize) SnapshotExchange<EngineConfig> config_exchange;
+    alignas(kCacheLineSize) ParameterQueue parameter_queue;
+
+    // Bypass and output metering (atomic for lock-free realtime control)
+    alignas(kCacheLineSize) std::atomic<bool> bypass;
+    std::atomic<bool> true_peak_enabled;
+    std::atomic<bool> loudness_enabled;
+    std::atomic<bool> loudness_reset_requested;
+    std::atomic<bool> spectrum_tap_enabled;
+
+    // Output frames for the spectrum analyzer (audio thread to analysis thread)
+    alignas(kCacheLineSize) SpectrumTap spectrum_tap;
 
     // Statistics
-    std::atomic<uint64_t> frames_processed;
-    std::atomic<uint32_t> underrun_count;
-    std::atomic<float> cpu_load_percent;  // CPU load as percentage (0-100)
-    std::atomic<float> peak_left;         // Peak level left channel (linear, 0-1+)
-    std::atomic<float> peak_right;        // Peak level right channel (linear, 0-1+)
+    alignas(kCacheLineSize) std::atomic<uint64_t> frames_processed;
+    alignas(kCacheLineSize) std::atomic<uint32_t> underrun_count;
+    alignas(kCacheLineSize) std::atomic<float> cpu_load_percent;  // CPU load as percentage (0-100)
+    alignas(kCacheLineSize) std::atomic<float> peak_left;         // Peak level left channel (linear, 0-1+)
+    alignas(kCacheLineSize) std::atomic<float> peak_right;        // Peak level right channel (linear, 0-1+)
+    alignas(kCacheLineSize) std::atomic<float> true_peak_left;    // True peak left channel (linear)
+    alignas(kCacheLineSize) std::atomic<float> true_peak_right;   // True peak right channel (linear)
+    alignas(kCacheLineSize) std::atomic<uint64_t> true_peak_overs; // Channel frames over 0 dBTP
+
+    // Latency of the installed configuration (set when the audio thread installs it)
+    alignas(kCacheLineSize) std::atomic<uint32_t> latency_frames;
+
+    // Loudness readings (LUFS), published together every 100 ms of audio
+    alignas(kCacheLineSize) std::atomic<float> loudness_momentary;
+    std::atomic<float> loudness_short_term;
+    std::atomic<float> loudness_integrated;
 
     // Constructor
-    radioform_dsp_engine(uint32_t sr)
+    radioform_dsp_engine(uint32_t sr, uint32_t channels)
         : sample_rate(sr)
+        , num_channels(channels)
+        , kernels(nullptr)
         , num_active_bands(0)
+        , active_epoch(0)
         , limiter_enabled(true)
+        , oversampled_limiter(false)
+        , lookahead_enabled(false)
+        , true_peak_active(false)
+        , loudness_active(false)
+        , ramp_phase(0)
+        , num_svf_bands(0)
+        , cpu_features(detect_cpu_features())
+        , config_epoch(0)
+        , control_parallel(false)
+        , eq_mode(RADIOFORM_EQ_MODE_CASCADE)
+        , limiter_mode(RADIOFORM_LIMITER_MODE_SOFT)
+        , limiter_oversampling(1)
+        , limiter_lookahead_ms(2.0f)
+        , limiter_release_ms(100.0f)
         , bypass(false)
+        , true_peak_enabled(false)
+        , loudness_enabled(false)
+        , loudness_reset_requested(false)
+        , spectrum_tap_enabled(false)
         , frames_processed(0)
         , underrun_count(0)
         , cpu_load_percent(0.0f)
         , peak_left(0.0f)
         , peak_right(0.0f)
+        , true_peak_left(0.0f)
+        , true_peak_right(0.0f)
+        , true_peak_overs(0)
+        , latency_frames(0)
+        , loudness_momentary(LoudnessMeter::kFloorLufs)
+        , loudness_short_term(LoudnessMeter::kFloorLufs)
+        , loudness_integrated(LoudnessMeter::kFloorLufs)
     {
+        kernels = &select_kernel_table(cpu_features);
+
         // Enable denormal suppression for performance
         // This prevents denormal numbers from causing slowdowns
         enable_denormal_suppression();
@@ -82,38 +275,629 @@ struct radioform_dsp_engine {
         for (auto& bq : bands) {
             bq.init();
         }
+        for (auto& svf : svf_bands) {
+            svf.init();
+        }
+        topology.fill(RADIOFORM_TOPOLOGY_BIQUAD);
+        std::fill(requested_topology, requested_topology + RADIOFORM_MAX_BANDS, RADIOFORM_TOPOLOGY_AUTO);
+        cascade.init();
 
         // Initialize smoothers
         preamp_smoother.init(static_cast<float>(sample_rate), 10.0f); // 10ms ramp
         preamp_smoother.setValue(1.0f); // 0dB = gain of 1.0
+        unity_gain.init(static_cast<float>(sample_rate), 10.0f);
+        unity_gain.setValue(1.0f);
 
         // Coefficient transition duration: ~10ms worth of samples
         coeff_transition_samples = static_cast<int>(sample_rate * 0.01f);
 
         // Initialize limiter
         limiter.init(-0.1f); // -0.1 dB threshold
+        oversampler.init();
+        lookahead_limiter.init(num_channels);
 
         // Initialize DC blocker (5Hz high-pass)
         dc_blocker.init(static_cast<float>(sample_rate), 5.0f);
+        channel_dc.init(static_cast<float>(sample_rate), 5.0f);
+        std::memset(channel_frames, 0, sizeof(channel_frames));
+
+        // K-weighting for the output loudness meter
+        loudness_meter.init(static_cast<float>(sample_rate), num_channels);
+
+        // Spectrum analyzer defaults (its tap stays off until requested)
+        radioform_spectrum_config_t spectrum_config;
+        radioform_dsp_spectrum_config_init_default(&spectrum_config);
+        configureSpectrum(spectrum_config);
+
+        // Cascade until a parallel design is requested and accepted
+        parallel_eq.init();
+        chain.parallel = nullptr;
+
+        // No audio thread yet: install the first configuration directly
+        publishConfig();
+        installConfig(*config_exchange.take());
+    }
+
+    /**
+     * @brief Configure the analyzer for the current sample rate (analysis thread)
+     *
+     * Bins above the Nyquist frequency are brought down to it; settings that
+     * are still out of range fall back to the defaults.
+     */
+    void configureSpectrum(radioform_spectrum_config_t config) {
+        const float sr = static_cast<float>(sample_rate);
+        config.max_frequency_hz = std::min(config.max_frequency_hz, 0.5f * sr);
+        if (!SpectrumAnalyzer::validate(config, sr)) {
+            radioform_dsp_spectrum_config_init_default(&config);
+            config.max_frequency_hz = std::min(config.max_frequency_hz, 0.5f * sr);
+        }
+        spectrum_analyzer.configure(config, sr);
+    }
+
+    /**
+     * @brief Design the configuration for current_preset and publish it (control thread)
+     *
+     * Bands pinned to the state-variable topology, and unpinned bands far
+     * below the sample rate (svf_preferred()), run as SVFs; the rest are
+     * packed into the biquad chain. Parallel
+     * mode falls back to the cascade when the conversion is rejected (and on
+     * engines that are not stereo).
+     */
+    void publishConfig() {
+        EngineConfig& config = config_exchange.acquire();
+        const float sr = static_cast<float>(sample_rate);
+
+        config.epoch = ++config_epoch;
+        config.num_bands = current_preset.num_bands;
+        config.num_sections = 0;
+        config.num_svf_bands = 0;
+
+        radioform_band_t enabled_bands[RADIOFORM_MAX_BANDS];
+        uint32_t num_enabled = 0;
+        for (uint32_t band = 0; band < config.num_bands; band++) {
+            if (current_preset.bands[band].enabled) {
+                enabled_bands[num_enabled++] = current_preset.bands[band];
+            }
+        }
+        BiquadCoeffs designed[RADIOFORM_MAX_BANDS];
+        designBiquads(enabled_bands, num_enabled, designed);
+
+        for (uint32_t band = 0, k = 0; band < config.num_bands; band++) {
+            const radioform_band_t& band_config = current_preset.bands[band];
+            config.topology[band] = RADIOFORM_TOPOLOGY_BIQUAD;
+            if (!band_config.enabled) {
+                config.biquad[band] = {1.0f, 0.0f, 0.0f, 0.0f, 0.0f};
+                continue;
+            }
+
+            config.biquad[band] = designed[k++];
+            const bool svf = requested_topology[band] == RADIOFORM_TOPOLOGY_AUTO
+                ? svf_preferred(band_config, sr)
+                : requested_topology[band] == RADIOFORM_TOPOLOGY_SVF;
+            if (svf) {
+                config.topology[band] = RADIOFORM_TOPOLOGY_SVF;
+                config.svf[band] = StateVariableFilter::calculateCoeffs(band_config, sr);
+                config.svf_band_indices[config.num_svf_bands++] = band;
+            } else {
+                config.packed_bands[config.num_sections++] = band;
+            }
+        }
+
+        BiquadCoeffs packed[RADIOFORM_MAX_BANDS];
+        for (uint32_t k = 0; k < config.num_sections; k++) {
+            packed[k] = config.biquad[config.packed_bands[k]];
+        }
+        config.parallel = num_channels == 2 && eq_mode == RADIOFORM_EQ_MODE_PARALLEL &&
+            design_parallel(packed, config.num_sections, config.parallel_design);
+
+        config.preamp_gain = db_to_gain(current_preset.preamp_db);
+        config.limiter_enabled = current_preset.limiter_enabled;
+        config.limiter_threshold_db = current_preset.limiter_threshold_db;
+        config.limiter_mode = limiter_mode;
+        config.limiter_oversampling = limiter_oversampling;
+        config.limiter_lookahead_frames = static_cast<uint32_t>(
+            std::lround(limiter_lookahead_ms * 0.001f * static_cast<float>(sample_rate)));
+        config.limiter_release_frames = limiter_release_ms * 0.001f * static_cast<float>(sample_rate);
+        if (!config.limiter_enabled) {
+            config.latency_frames = 0;
+        } else if (limiter_mode == RADIOFORM_LIMITER_MODE_LOOKAHEAD) {
+            config.latency_frames = config.limiter_lookahead_frames + LookaheadLimiter::kDetectorDelay;
+        } else {
+            config.latency_frames = static_cast<uint32_t>(
+                std::lround(Oversampler::latencyFrames(limiter_oversampling)));
+        }
+
+        std::copy(config.biquad, config.biquad + config.num_bands, control_coeffs);
+        control_parallel = config.parallel;
+
+        config_exchange.publish();
+    }
+
+    /**
+     * @brief Switch the filters over to a new configuration (audio thread)
+     *
+     * Coefficients change instantly. Filter state follows its band when the
+     * packing changes, and a band that changes topology starts from cleared
+     * state. Copies only; nothing is designed or allocated here.
+     */
+    void installConfig(const EngineConfig& config) {
+        BiquadState state[RADIOFORM_MAX_CHANNELS][RADIOFORM_MAX_BANDS] = {};
+        for (uint32_t k = 0; k < cascade.numSections(); k++) {
+            for (uint32_t ch = 0; ch < num_channels; ch++) {
+                state[ch][packed_bands[k]] = cascade.state(ch, k);
+            }
+        }
+
+        for (uint32_t band = 0; band < config.num_bands; band++) {
+            bands[band].setCoeffs(config.biquad[band]);
+            if (config.topology[band] == RADIOFORM_TOPOLOGY_SVF) {
+                if (topology[band] != RADIOFORM_TOPOLOGY_SVF) {
+                    svf_bands[band].reset();
+                }
+                svf_bands[band].setCoeffs(config.svf[band]);
+            } else if (topology[band] != RADIOFORM_TOPOLOGY_BIQUAD) {
+                for (uint32_t ch = 0; ch < num_channels; ch++) {
+                    state[ch][band] = {};
+                }
+            }
+            topology[band] = config.topology[band];
+        }
+        num_active_bands = config.num_bands;
+
+        for (uint32_t k = 0; k < config.num_sections; k++) {
+            packed_bands[k] = config.packed_bands[k];
+            for (uint32_t ch = 0; ch < num_channels; ch++) {
+                cascade.setState(ch, k, state[ch][packed_bands[k]]);
+            }
+        }
+        cascade.setNumSections(config.num_sections);
+        syncCascadeCoeffs();
+
+        num_svf_bands = config.num_svf_bands;
+        std::copy(config.svf_band_indices, config.svf_band_indices + num_svf_bands, svf_band_indices);
+
+        preamp_smoother.setTarget(config.preamp_gain);
+        const bool lookahead = config.limiter_mode == RADIOFORM_LIMITER_MODE_LOOKAHEAD;
+        const bool soft = config.limiter_enabled && !lookahead;
+        if (soft) {
+            limiter.setThreshold(config.limiter_threshold_db);
+        }
+        const bool oversampled = soft && config.limiter_oversampling > 1;
+        if (oversampled && (!oversampled_limiter || oversampler.factor() != config.limiter_oversampling)) {
+            oversampler.setFactor(config.limiter_oversampling);  // Clears the filter state
+        }
+        limiter_enabled = soft && !oversampled;
+        oversampled_limiter = oversampled;
+        const bool was_lookahead = lookahead_enabled;
+        lookahead_enabled = config.limiter_enabled && lookahead;
+        if (lookahead_enabled) {
+            lookahead_limiter.configure(config.limiter_lookahead_frames, config.limiter_release_frames,
+                                        config.limiter_threshold_db);
+            if (!was_lookahead) {
+                lookahead_limiter.reset();  // Nothing stale in the delay line
+            }
+        }
+
+        chain.cascade = &cascade;
+        chain.preamp = &preamp_smoother;
+        chain.dc_blocker = &dc_blocker;
+        chain.limiter = limiter_enabled ? &limiter : nullptr;
+
+        channel_chain.num_channels = num_channels;
+        for (uint32_t i = 0; i < num_svf_bands; i++) {
+            channel_chain.svf[i] = &svf_bands[svf_band_indices[i]];
+        }
+        channel_chain.num_svf = num_svf_bands;
+        channel_chain.cascade = &cascade;
+        channel_chain.preamp = &preamp_smoother;
+        channel_chain.dc_blocker = &channel_dc;
+        channel_chain.limiter = chain.limiter;
+
+        if (config.parallel) {
+            parallel_eq.setDesign(config.parallel_design);
+        }
+        setParallelActive(config.parallel);
+
+        updateBlockSections();
+        active_epoch = config.epoch;
+        latency_frames.store(config.latency_frames, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Copy the packed bands' current coefficients into the cascade
+     */
+    void syncCascadeCoeffs() {
+        for (uint32_t k = 0; k < cascade.numSections(); k++) {
+            cascade.setCoeffs(k, bands[packed_bands[k]].coeffs());
+        }
+    }
+
+    /**
+     * @brief Bring block matrices in line with the packed bands' coefficients
+     *
+     * Cheap when nothing changed; only sections whose coefficients moved
+     * (e.g. after a ramp) are recomputed.
+     */
+    void updateBlockSections() {
+        for (uint32_t k = 0; k < cascade.numSections(); k++) {
+            block_sections[k].update(cascade.coeffs(k));
+        }
+    }
+
+    /**
+     * @brief Whether the active EQ structure's coefficients are ramping
+     */
+    bool coeffsRamping() const {
+        for (uint32_t i = 0; i < num_svf_bands; i++) {
+            if (svf_bands[svf_band_indices[i]].rampStepsRemaining() > 0) {
+                return true;
+            }
+        }
+        if (chain.parallel) {
+            return parallel_eq.rampStepsRemaining() > 0;
+        }
+        for (uint32_t k = 0; k < cascade.numSections(); k++) {
+            if (bands[packed_bands[k]].rampStepsRemaining() > 0) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /**
+     * @brief Frames the coefficients stay fixed for (unbounded when not ramping)
+     */
+    uint32_t framesUntilRampStep() const {
+        return coeffsRamping() ? kRampBlockFrames - ramp_phase : UINT32_MAX;
+    }
+
+    /**
+     * @brief Advance the ramp clock past processed frames
+     *
+     * Callers never process across a step boundary (framesUntilRampStep()).
+     *
+     * @return true if the ramps stepped (coefficients changed)
+     */
+    bool advanceRamps(uint32_t num_frames) {
+        if (!coeffsRamping()) {
+            return false;
+        }
+        ramp_phase += num_frames;
+        if (ramp_phase < kRampBlockFrames) {
+            return false;
+        }
+        ramp_phase = 0;
+
+        for (uint32_t i = 0; i < num_svf_bands; i++) {
+            svf_bands[svf_band_indices[i]].stepRamp();
+        }
+        if (chain.parallel) {
+            parallel_eq.stepRamp();
+        } else {
+            for (uint32_t k = 0; k < cascade.numSections(); k++) {
+                bands[packed_bands[k]].stepRamp();
+            }
+            syncCascadeCoeffs();
+        }
+        return true;
+    }
+
+    /**
+     * @brief Switch between cascade and parallel processing
+     *
+     * The structure being switched to starts from cleared filter history;
+     * the other one's state does not describe it.
+     */
+    void setParallelActive(bool active) {
+        ParallelEQ* target = active ? &parallel_eq : nullptr;
+        if (chain.parallel != target) {
+            if (active) {
+                parallel_eq.reset();
+            } else {
+                cascade.reset();
+            }
+            chain.parallel = target;
+        }
+        stereo_kernels = kernels->select_stereo(chain);
+    }
+
+    /**
+     * @brief Run the state-variable bands on a planar block, in place
+     */
+    void processSvfPlanar(float* left, float* right, uint32_t num_frames) {
+        for (uint32_t i = 0; i < num_svf_bands; i++) {
+            svf_bands[svf_band_indices[i]].processPlanar(left, right, num_frames);
+        }
+    }
+
+    /**
+     * @brief Apply the preamp and run the state-variable bands on an
+     * interleaved block, in place
+     *
+     * Same order as the planar path; the packed chain then runs at unity gain.
+     */
+    void processSvfInterleaved(float* data, uint32_t num_frames) {
+        if (preamp_smoother.isStable()) {
+            const float gain = preamp_smoother.getCurrent();
+            for (uint32_t i = 0; i < num_frames * 2; i++) {
+                data[i] *= gain;
+            }
+        } else {
+            for (uint32_t i = 0; i < num_frames; i++) {
+                const float gain = preamp_smoother.next();
+                data[i * 2] *= gain;
+                data[i * 2 + 1] *= gain;
+            }
+        }
+        for (uint32_t i = 0; i < num_svf_bands; i++) {
+            svf_bands[svf_band_indices[i]].processInterleaved(data, num_frames);
+        }
+    }
+
+    /**
+     * @brief Run the soft limiter on one channel at the oversampled rate
+     *
+     * Only the waveshaper runs at the higher rate; everything before it is
+     * linear and stays at the base rate.
+     *
+     * @return Peak level of the channel's output
+     */
+    float limitOversampled(uint32_t channel, float* data, uint32_t stride, uint32_t num_frames) {
+        return oversampler.processChannel(channel, data, stride, num_frames,
+            [this](float* samples, uint32_t count) {
+                // Memoryless, so the two halves can run as the planar
+                // kernel's left and right (count is even above 1x)
+                const uint32_t half = count / 2;
+                kernels->limiter(limiter, samples, samples + half, half);
+            });
+    }
+
+    /**
+     * @brief Run every planar stage on one sub-block
+     *
+     * preamp_stable and block_cascade are decided once per buffer by the caller.
+     *
+     * @return Peak levels of the sub-block's output
+     */
+    StereoPeak processPlanarBlock(
+        const float* input_left, const float* input_right,
+        float* output_left, float* output_right,
+        uint32_t num_frames, bool preamp_stable, bool block_cascade
+    ) {
+        // Copy input to output first (we'll process in-place)
+        if (input_left != output_left) {
+            std::memcpy(output_left, input_left, num_frames * sizeof(float));
+        }
+        if (input_right != output_right) {
+            std::memcpy(output_right, input_right, num_frames * sizeof(float));
+        }
+
+        // Apply preamp (skip smoother ticks when stable)
+        if (preamp_stable) {
+            const float gain = preamp_smoother.getCurrent();
+            for (uint32_t i = 0; i < num_frames; i++) {
+                output_left[i] *= gain;
+                output_right[i] *= gain;
+            }
+        } else {
+            for (uint32_t i = 0; i < num_frames; i++) {
+                const float preamp_gain = preamp_smoother.next();
+                output_left[i] *= preamp_gain;
+                output_right[i] *= preamp_gain;
+            }
+        }
+
+        // Low-frequency bands on the state-variable topology
+        processSvfPlanar(output_left, output_right, num_frames);
+
+        // Process through enabled EQ bands (packed at preset time)
+        if (chain.parallel) {
+            kernels->parallel_eq(*chain.parallel, output_left, output_right, num_frames);
+        } else if (block_cascade) {
+            // Long buffer on fixed coefficients: block state-space form
+            kernels->block_cascade(
+                block_sections.data(), cascade, output_left, output_right, num_frames
+            );
+        } else {
+            for (uint32_t k = 0; k < cascade.numSections(); k++) {
+                // Each section processes both channels
+                cascade.processSection(k, output_left, output_right, num_frames);
+            }
+        }
+
+        // Remove DC offset (prevents buildup from cascaded filters)
+        kernels->dc_blocker(dc_blocker, output_left, output_right, num_frames);
+
+        // Apply limiter if enabled
+        if (limiter_enabled) {
+            kernels->limiter(limiter, output_left, output_right, num_frames);
+        } else if (oversampled_limiter) {
+            return {limitOversampled(0, output_left, 1, num_frames),
+                    limitOversampled(1, output_right, 1, num_frames)};
+        } else if (lookahead_enabled) {
+            float peaks[2] = {};
+            lookahead_limiter.processPlanar(output_left, output_right, num_frames, peaks);
+            return {peaks[0], peaks[1]};
+        }
+
+        return kernels->peak(output_left, output_right, num_frames);
+    }
+
+    /**
+     * @brief Design biquad bands, through the coefficient cache (control thread)
+     *
+     * Bands are designed from their quantized parameters, so cached and fresh
+     * designs agree exactly; the misses are designed together in one batch.
+     *
+     * @param count At most RADIOFORM_MAX_BANDS
+     */
+    void designBiquads(const radioform_band_t* bands, uint32_t count, BiquadCoeffs* coeffs) {
+        CoeffKey miss_keys[RADIOFORM_MAX_BANDS];
+        radioform_band_t miss_bands[RADIOFORM_MAX_BANDS];
+        uint32_t miss_index[RADIOFORM_MAX_BANDS];
+        uint32_t num_misses = 0;
+        for (uint32_t i = 0; i < count; i++) {
+            const CoeffKey key = CoefficientCache::quantize(bands[i], sample_rate);
+            if (const BiquadCoeffs* cached = coeff_cache.find(key)) {
+                coeffs[i] = *cached;
+            } else {
+                miss_keys[num_misses] = key;
+                miss_bands[num_misses] = CoefficientCache::dequantize(key);
+                miss_index[num_misses++] = i;
+            }
+        }
+
+        BiquadCoeffs designed[RADIOFORM_MAX_BANDS];
+        design_biquads(miss_bands, num_misses, static_cast<float>(sample_rate), designed);
+        for (uint32_t k = 0; k < num_misses; k++) {
+            coeffs[miss_index[k]] = designed[k];
+            coeff_cache.insert(miss_keys[k], designed[k]);
+        }
+    }
+
+    /**
+     * @brief Design a realtime band edit and queue it (control thread)
+     *
+     * current_preset is already updated. The band keeps its topology until
+     * the next preset apply. In parallel mode the whole parallel form is
+     * redesigned here too, so the audio thread only copies the result.
+     */
+    void postBandUpdate(uint32_t band_index) {
+        const radioform_band_t& band = current_preset.bands[band_index];
+        const EngineConfig& config = *config_exchange.latest();
+        const float sr = static_cast<float>(sample_rate);
+
+        BandUpdate& update = parameter_queue.band(band_index);
+        update.epoch = config_epoch;
+        update.topology = config.topology[band_index];
+        if (update.topology == RADIOFORM_TOPOLOGY_SVF) {
+            update.svf = StateVariableFilter::calculateCoeffs(band, sr);
+        } else {
+            designBiquads(&band, 1, &update.biquad);
+            control_coeffs[band_index] = update.biquad;
+        }
+        parameter_queue.publish(band_index);
+
+        if (!control_parallel || update.topology == RADIOFORM_TOPOLOGY_SVF) {
+            return;
+        }
+
+        BiquadCoeffs coeffs[RADIOFORM_MAX_BANDS];
+        for (uint32_t k = 0; k < config.num_sections; k++) {
+            coeffs[k] = control_coeffs[config.packed_bands[k]];
+        }
+        ParallelUpdate& parallel = parameter_queue.parallel();
+        parallel.epoch = config_epoch;
+        parallel.valid = design_parallel(coeffs, config.num_sections, parallel.design);
+        parameter_queue.publish(ParameterQueue::kParallelTarget);
+
+        // A rejected conversion drops to the cascade until the next preset apply
+        control_parallel = parallel.valid;
+    }
+
+    /**
+     * @brief Whether a queued update belongs to the installed configuration
+     *
+     * Updates for an older configuration are dropped. An update for a newer
+     * one means its snapshot was published after our take(); it was
+     * published before the update was queued, so the queue's acquire has
+     * made it visible. Install it and apply the update on top.
+     */
+    bool catchUpTo(uint32_t epoch) {
+        if (static_cast<int32_t>(epoch - active_epoch) > 0) {
+            if (const EngineConfig* config = config_exchange.take()) {
+                installConfig(*config);
+            }
+        }
+        return epoch == active_epoch;
+    }
+
+    /**
+     * @brief Install a newly published configuration, then apply queued
+     *        parameter updates (audio thread, start of a buffer)
+     *
+     * State-variable bands and cascade bands ramp their own coefficients.
+     * Parallel: the biquad only stores coefficients and the parallel sections
+     * ramp instead. Either way the ramp is stepped by advanceRamps().
+     */
+    void applyParameterUpdates() {
+        if (const EngineConfig* config = config_exchange.take()) {
+            installConfig(*config);
+        }
+
+        parameter_queue.drain(
+            [this](uint32_t band_index, const BandUpdate& update) {
+                if (!catchUpTo(update.epoch)) {
+                    return;
+                }
+                // A ramp starting from rest gets a full first step
+                if (!coeffsRamping()) {
+                    ramp_phase = 0;
+                }
+                if (update.topology == RADIOFORM_TOPOLOGY_SVF) {
+                    svf_bands[band_index].setCoeffsSmooth(update.svf, coeff_transition_samples);
+                } else if (!chain.parallel) {
+                    bands[band_index].setCoeffsSmooth(update.biquad, coeff_transition_samples);
+                    syncCascadeCoeffs();
+                } else {
+                    bands[band_index].setCoeffs(update.biquad);
+                    syncCascadeCoeffs();
+                }
+            },
+            [this](const PreampUpdate& update) {
+                if (catchUpTo(update.epoch)) {
+                    preamp_smoother.setTarget(update.gain);
+                }
+            },
+            [this](const ParallelUpdate& update) {
+                if (!catchUpTo(update.epoch) || !chain.parallel) {
+                    return;
+                }
+                if (!update.valid) {
+                    setParallelActive(false);
+                    return;
+                }
+                if (!coeffsRamping()) {
+                    ramp_phase = 0;
+                }
+                parallel_eq.setDesignSmooth(update.design, coeff_transition_samples);
+            });
     }
 };
 
+static_assert(alignof(radioform_dsp_engine) >= kCacheLineSize,
+              "engine must be cache-line aligned for the hot/cold split to hold");
+
 // ============================================================================
 // Engine Lifecycle
 // ============================================================================
 
 radioform_dsp_engine_t* radioform_dsp_create(uint32_t sample_rate) {
+    return radioform_dsp_create_with_channels(sample_rate, 2);
+}
+
+radioform_dsp_engine_t* radioform_dsp_create_with_channels(
+    uint32_t sample_rate,
+    uint32_t num_channels
+) {
     if (sample_rate < 8000 || sample_rate > 384000) {
         return nullptr; // Invalid sample rate
     }
+    if (num_channels < 1 || num_channels > RADIOFORM_MAX_CHANNELS) {
+        return nullptr;
+    }
 
     try {
-        return new radioform_dsp_engine(sample_rate);
+        return new radioform_dsp_engine(sample_rate, num_channels);
     } catch (...) {
         return nullptr;
     }
 }
 
+uint32_t radioform_dsp_get_num_channels(const radioform_dsp_engine_t* engine) {
+    return engine ? engine->num_channels : 0;
+}
+
 void radioform_dsp_destroy(radioform_dsp_engine_t* engine) {
     if (engine) {
         delete engine;
@@ -123,17 +907,34 @@ void radioform_dsp_destroy(radioform_dsp_engine_t* engine) {
 void radioform_dsp_reset(radioform_dsp_engine_t* engine) {
     if (!engine) return;
 
-    // Reset all filter state
+    // Reset all filter state (finishes any coefficient ramp)
     for (auto& bq : engine->bands) {
         bq.reset();
     }
+    engine->syncCascadeCoeffs();
+    engine->cascade.reset();
 
-    // Reset DC blocker
+    for (auto& svf : engine->svf_bands) {
+        svf.reset();
+    }
+
+    // Reset parallel-form sections
+    engine->parallel_eq.reset();
+
+    // Reset DC blockers
     engine->dc_blocker.reset();
+    engine->channel_dc.reset();
+
+    // Clear the lookahead delay line and the oversampling filters
+    engine->lookahead_limiter.reset();
+    engine->oversampler.reset();
 
-    // Reset statistics
+    // Reset statistics (the output meters restart with their next buffer)
     engine->frames_processed.store(0);
     engine->underrun_count.store(0);
+    engine->true_peak_overs.store(0);
+    engine->true_peak_active = false;
+    engine->loudness_active = false;
 }
 
 radioform_error_t radioform_dsp_set_sample_rate(
@@ -155,6 +956,11 @@ radioform_error_t radioform_dsp_set_sample_rate(
 
     // Reinitialize DC blocker with new sample rate
     engine->dc_blocker.init(static_cast<float>(sample_rate), 5.0f);
+    engine->channel_dc.init(static_cast<float>(sample_rate), 5.0f);
+
+    // Redesign the K-weighting (a new measurement starts with the next buffer)
+    engine->loudness_meter.init(static_cast<float>(sample_rate), engine->num_channels);
+    engine->loudness_active = false;
 
     // Recalculate filter coefficients
     return radioform_dsp_apply_preset(engine, &engine->current_preset);
@@ -164,79 +970,127 @@ radioform_error_t radioform_dsp_set_sample_rate(
 // Audio Processing (REALTIME-SAFE)
 // ============================================================================
 
-void radioform_dsp_process_interleaved(
+/**
+ * @brief Decay the peak meters during bypass so they don't hold stale values
+ */
+static void decay_bypass_meters(radioform_dsp_engine_t* engine, uint32_t num_frames) {
+    constexpr float peak_decay_time_ms = 300.0f;
+    const float peak_decay_samples = peak_decay_time_ms * static_cast<float>(engine->sample_rate) / 1000.0f;
+    const float peak_decay = std::exp(-static_cast<float>(num_frames) / peak_decay_samples);
+    engine->peak_left.store(engine->peak_left.load(std::memory_order_relaxed) * peak_decay, std::memory_order_relaxed);
+    engine->peak_right.store(engine->peak_right.load(std::memory_order_relaxed) * peak_decay, std::memory_order_relaxed);
+    engine->true_peak_left.store(engine->true_peak_left.load(std::memory_order_relaxed) * peak_decay, std::memory_order_relaxed);
+    engine->true_peak_right.store(engine->true_peak_right.load(std::memory_order_relaxed) * peak_decay, std::memory_order_relaxed);
+
+    engine->frames_processed.fetch_add(num_frames, std::memory_order_relaxed);
+}
+
+/**
+ * @brief Meter the true peak of the first two output channels (when enabled)
+ *
+ * Same attack and decay as the sample peak meters. Mono engines meter their
+ * channel twice.
+ *
+ * @param left, right First sample of each channel; frames are stride floats apart
+ */
+static void meter_true_peak(
     radioform_dsp_engine_t* engine,
-    const float* input,
-    float* output,
+    const float* left,
+    const float* right,
+    uint32_t stride,
     uint32_t num_frames
 ) {
-    if (!engine || !input || !output || num_frames == 0) return;
-
-    // Start CPU timing
-    auto start_time = std::chrono::high_resolution_clock::now();
-
-    // Check bypass
-    if (engine->bypass.load(std::memory_order_relaxed)) {
-        // Passthrough
-        if (input != output) {
-            std::memcpy(output, input, num_frames * 2 * sizeof(float));
-        }
-
-        // Decay peak meters so they don't hold stale values
-        constexpr float peak_decay_time_ms = 300.0f;
-        const float peak_decay_samples = peak_decay_time_ms * static_cast<float>(engine->sample_rate) / 1000.0f;
-        const float peak_decay = std::exp(-static_cast<float>(num_frames) / peak_decay_samples);
-        engine->peak_left.store(engine->peak_left.load(std::memory_order_relaxed) * peak_decay, std::memory_order_relaxed);
-        engine->peak_right.store(engine->peak_right.load(std::memory_order_relaxed) * peak_decay, std::memory_order_relaxed);
-
-        engine->frames_processed.fetch_add(num_frames, std::memory_order_relaxed);
+    if (!engine->true_peak_enabled.load(std::memory_order_relaxed)) {
+        engine->true_peak_active = false;
         return;
     }
+    if (!engine->true_peak_active) {
+        // Nothing stale from before the meter was switched off
+        engine->true_peak_meter.reset();
+        engine->true_peak_left.store(0.0f, std::memory_order_relaxed);
+        engine->true_peak_right.store(0.0f, std::memory_order_relaxed);
+        engine->true_peak_active = true;
+    }
 
-    // Peak detection
-    float buffer_peak_left = 0.0f;
-    float buffer_peak_right = 0.0f;
-
-    // Check if preamp smoother has settled (skip per-sample ticks when stable)
-    const bool preamp_stable = engine->preamp_smoother.isStable();
-    const float preamp_gain_cached = preamp_stable ? engine->preamp_smoother.getCurrent() : 0.0f;
-
-    // Process each frame
-    for (uint32_t i = 0; i < num_frames; i++) {
-        // Deinterleave
-        float left = input[i * 2];
-        float right = input[i * 2 + 1];
+    uint32_t overs = 0;
+    const float block_left = engine->true_peak_meter.process(0, left, stride, num_frames, overs);
+    const float block_right = engine->true_peak_meter.process(1, right, stride, num_frames, overs);
 
-        // Apply preamp (skip smoother ticks when stable)
-        const float preamp_gain = preamp_stable ? preamp_gain_cached : engine->preamp_smoother.next();
-        left *= preamp_gain;
-        right *= preamp_gain;
-
-        // Process through EQ bands
-        for (uint32_t band = 0; band < engine->num_active_bands; band++) {
-            if (engine->current_preset.bands[band].enabled) {
-                // Each biquad processes both channels
-                engine->bands[band].processSample(left, right, &left, &right);
-            }
-        }
-
-        // Remove DC offset (prevents buildup from cascaded filters)
-        engine->dc_blocker.processStereo(left, right, &left, &right);
+    constexpr float peak_decay_time_ms = 300.0f;
+    const float peak_decay_samples = peak_decay_time_ms * static_cast<float>(engine->sample_rate) / 1000.0f;
+    const float peak_decay = std::exp(-static_cast<float>(num_frames) / peak_decay_samples);
+    engine->true_peak_left.store(
+        std::max(block_left, engine->true_peak_left.load(std::memory_order_relaxed) * peak_decay),
+        std::memory_order_relaxed);
+    engine->true_peak_right.store(
+        std::max(block_right, engine->true_peak_right.load(std::memory_order_relaxed) * peak_decay),
+        std::memory_order_relaxed);
+    if (overs > 0) {
+        engine->true_peak_overs.fetch_add(overs, std::memory_order_relaxed);
+    }
+}
 
-        // Apply limiter if enabled
-        if (engine->limiter_enabled) {
-            engine->limiter.processSampleStereo(&left, &right);
+/**
+ * @brief Meter the loudness of all output channels (when enabled)
+ *
+ * @param channels First sample of each channel; frames are stride floats apart
+ */
+static void meter_loudness(
+    radioform_dsp_engine_t* engine,
+    const float* const* channels,
+    uint32_t stride,
+    uint32_t num_frames
+) {
+    if (!engine->loudness_enabled.load(std::memory_order_relaxed)) {
+        if (engine->loudness_active) {
+            engine->loudness_momentary.store(LoudnessMeter::kFloorLufs, std::memory_order_relaxed);
+            engine->loudness_short_term.store(LoudnessMeter::kFloorLufs, std::memory_order_relaxed);
+            engine->loudness_integrated.store(LoudnessMeter::kFloorLufs, std::memory_order_relaxed);
+            engine->loudness_active = false;
         }
+        return;
+    }
+    if (engine->loudness_reset_requested.exchange(false, std::memory_order_relaxed)) {
+        engine->loudness_active = false;
+    }
+    if (!engine->loudness_active) {
+        engine->loudness_meter.reset();
+        engine->loudness_active = true;
+    }
 
-        // Track peak levels
-        buffer_peak_left = std::max(buffer_peak_left, std::abs(left));
-        buffer_peak_right = std::max(buffer_peak_right, std::abs(right));
+    engine->loudness_meter.process(channels, stride, num_frames);
+    engine->loudness_momentary.store(engine->loudness_meter.momentaryLufs(), std::memory_order_relaxed);
+    engine->loudness_short_term.store(engine->loudness_meter.shortTermLufs(), std::memory_order_relaxed);
+    engine->loudness_integrated.store(engine->loudness_meter.integratedLufs(), std::memory_order_relaxed);
+}
 
-        // Interleave output
-        output[i * 2] = left;
-        output[i * 2 + 1] = right;
+/**
+ * @brief Queue the first two output channels for the spectrum analyzer (when enabled)
+ *
+ * @param left, right First sample of each channel; frames are stride floats apart
+ */
+static void tap_spectrum(
+    radioform_dsp_engine_t* engine,
+    const float* left,
+    const float* right,
+    uint32_t stride,
+    uint32_t num_frames
+) {
+    if (engine->spectrum_tap_enabled.load(std::memory_order_relaxed)) {
+        engine->spectrum_tap.write(left, right, stride, num_frames);
     }
+}
 
+/**
+ * @brief Update peak meters, CPU load and frame count after a processed buffer
+ */
+static void finish_buffer(
+    radioform_dsp_engine_t* engine,
+    uint32_t num_frames,
+    float buffer_peak_left,
+    float buffer_peak_right,
+    std::chrono::high_resolution_clock::time_point start_time
+) {
     // Update peak meters with sample-rate-independent exponential decay
     // Decay time constant: 300ms (meter falls to ~37% of peak in 300ms)
     constexpr float peak_decay_time_ms = 300.0f;
@@ -276,6 +1130,153 @@ void radioform_dsp_process_interleaved(
     engine->frames_processed.fetch_add(num_frames, std::memory_order_relaxed);
 }
 
+/**
+ * @brief Run a non-stereo engine over a buffer, one padded block at a time
+ *
+ * @param load Copies frames [offset, offset + count) into the padded block
+ * @param save Copies them back out after processing
+ */
+template <typename Load, typename Save>
+static void process_channel_blocks(
+    radioform_dsp_engine_t* engine, uint32_t num_frames, Load load, Save save
+) {
+    auto start_time = std::chrono::high_resolution_clock::now();
+
+    // Meters follow the first two channels (mono reports its channel twice)
+    const uint32_t right = engine->num_channels > 1 ? 1 : 0;
+    const float* channel_ptrs[RADIOFORM_MAX_CHANNELS];
+    for (uint32_t ch = 0; ch < engine->num_channels; ch++) {
+        channel_ptrs[ch] = engine->channel_frames + ch;
+    }
+
+    // Oversampled and lookahead limiters run after the kernel and report
+    // their own peaks
+    float peaks[RADIOFORM_MAX_CHANNELS] = {};
+    float limited_peaks[RADIOFORM_MAX_CHANNELS] = {};
+    for (uint32_t offset = 0; offset < num_frames;) {
+        const uint32_t frames = std::min(
+            {kPlanarBlockFrames, num_frames - offset, engine->framesUntilRampStep()});
+        load(engine->channel_frames, offset, frames);
+        engine->kernels->multichannel(engine->channel_chain, engine->channel_frames, frames, peaks);
+        if (engine->oversampled_limiter) {
+            for (uint32_t ch = 0; ch < engine->num_channels; ch++) {
+                limited_peaks[ch] = std::max(limited_peaks[ch], engine->limitOversampled(
+                    ch, engine->channel_frames + ch, kFrameStride, frames));
+            }
+        } else if (engine->lookahead_enabled) {
+            engine->lookahead_limiter.processInterleaved(
+                engine->channel_frames, kFrameStride, frames, limited_peaks);
+        }
+        meter_true_peak(engine, engine->channel_frames, engine->channel_frames + right,
+                        kFrameStride, frames);
+        meter_loudness(engine, channel_ptrs, kFrameStride, frames);
+        tap_spectrum(engine, engine->channel_frames, engine->channel_frames + right,
+                     kFrameStride, frames);
+        save(engine->channel_frames, offset, frames);
+
+        engine->advanceRamps(frames);
+        offset += frames;
+    }
+
+    const float* meters =
+        (engine->oversampled_limiter || engine->lookahead_enabled) ? limited_peaks : peaks;
+    finish_buffer(engine, num_frames, meters[0], meters[right], start_time);
+}
+
+void radioform_dsp_process_interleaved(
+    radioform_dsp_engine_t* engine,
+    const float* input,
+    float* output,
+    uint32_t num_frames
+) {
+    if (!engine || !input || !output || num_frames == 0) return;
+
+    const uint32_t channels = engine->num_channels;
+
+    engine->applyParameterUpdates();
+
+    // Check bypass
+    if (engine->bypass.load(std::memory_order_relaxed)) {
+        // Passthrough
+        if (input != output) {
+            std::memcpy(output, input, num_frames * channels * sizeof(float));
+        }
+        decay_bypass_meters(engine, num_frames);
+        return;
+    }
+
+    if (channels != 2) {
+        process_channel_blocks(engine, num_frames,
+            [&](float* frames, uint32_t offset, uint32_t count) {
+                const float* src = input + static_cast<size_t>(offset) * channels;
+                for (uint32_t i = 0; i < count; i++) {
+                    for (uint32_t ch = 0; ch < channels; ch++) {
+                        frames[i * kFrameStride + ch] = src[i * channels + ch];
+                    }
+                }
+            },
+            [&](const float* frames, uint32_t offset, uint32_t count) {
+                float* dst = output + static_cast<size_t>(offset) * channels;
+                for (uint32_t i = 0; i < count; i++) {
+                    for (uint32_t ch = 0; ch < channels; ch++) {
+                        dst[i * channels + ch] = frames[i * kFrameStride + ch];
+                    }
+                }
+            });
+        return;
+    }
+
+    // Start CPU timing
+    auto start_time = std::chrono::high_resolution_clock::now();
+
+    // Preamp -> EQ -> DC blocker -> limiter -> peak, L/R in one register.
+    // Coefficient ramps step between calls, so the steady kernel keeps running
+    // during automation; the generic one is only needed for preamp ramps.
+    // With state-variable bands, the preamp and those bands run first, in
+    // place on the output, and the kernel follows at unity gain.
+    StereoChain post_svf = engine->chain;
+    post_svf.preamp = &engine->unity_gain;
+    float buffer_peak_left = 0.0f;
+    float buffer_peak_right = 0.0f;
+    for (uint32_t offset = 0; offset < num_frames;) {
+        const uint32_t frames = std::min(num_frames - offset, engine->framesUntilRampStep());
+        const float* block_input = input + offset * 2;
+        StereoPeak peak;
+        if (engine->num_svf_bands > 0) {
+            if (block_input != output + offset * 2) {
+                std::memcpy(output + offset * 2, block_input, frames * 2 * sizeof(float));
+            }
+            engine->processSvfInterleaved(output + offset * 2, frames);
+            peak = engine->stereo_kernels.steady(post_svf, output + offset * 2,
+                                                 output + offset * 2, frames);
+        } else {
+            const StereoKernelFn kernel = stereo_chain_ramping(engine->chain)
+                ? engine->stereo_kernels.ramping
+                : engine->stereo_kernels.steady;
+            peak = kernel(engine->chain, block_input, output + offset * 2, frames);
+        }
+        if (engine->oversampled_limiter) {
+            peak = {engine->limitOversampled(0, output + offset * 2, 2, frames),
+                    engine->limitOversampled(1, output + offset * 2 + 1, 2, frames)};
+        } else if (engine->lookahead_enabled) {
+            float peaks[2] = {};
+            engine->lookahead_limiter.processInterleaved(output + offset * 2, 2, frames, peaks);
+            peak = {peaks[0], peaks[1]};
+        }
+        buffer_peak_left = std::max(buffer_peak_left, peak.left);
+        buffer_peak_right = std::max(buffer_peak_right, peak.right);
+
+        engine->advanceRamps(frames);
+        offset += frames;
+    }
+
+    meter_true_peak(engine, output, output + 1, 2, num_frames);
+    const float* const output_channels[2] = {output, output + 1};
+    meter_loudness(engine, output_channels, 2, num_frames);
+    tap_spectrum(engine, output, output + 1, 2, num_frames);
+    finish_buffer(engine, num_frames, buffer_peak_left, buffer_peak_right, start_time);
+}
+
 void radioform_dsp_process_planar(
     radioform_dsp_engine_t* engine,
     const float* input_left,
@@ -288,11 +1289,10 @@ void radioform_dsp_process_planar(
         return;
     }
 
-    // Start CPU timing
-    auto start_time = std::chrono::high_resolution_clock::now();
+    engine->applyParameterUpdates();
 
-    // Check bypass
-    if (engine->bypass.load(std::memory_order_relaxed)) {
+    // Check bypass (engines with another channel count pass through)
+    if (engine->bypass.load(std::memory_order_relaxed) || engine->num_channels != 2) {
         // Passthrough
         if (input_left != output_left) {
             std::memcpy(output_left, input_left, num_frames * sizeof(float));
@@ -300,110 +1300,98 @@ void radioform_dsp_process_planar(
         if (input_right != output_right) {
             std::memcpy(output_right, input_right, num_frames * sizeof(float));
         }
-
-        // Decay peak meters so they don't hold stale values
-        constexpr float peak_decay_time_ms = 300.0f;
-        const float peak_decay_samples = peak_decay_time_ms * static_cast<float>(engine->sample_rate) / 1000.0f;
-        const float peak_decay = std::exp(-static_cast<float>(num_frames) / peak_decay_samples);
-        engine->peak_left.store(engine->peak_left.load(std::memory_order_relaxed) * peak_decay, std::memory_order_relaxed);
-        engine->peak_right.store(engine->peak_right.load(std::memory_order_relaxed) * peak_decay, std::memory_order_relaxed);
-
-        engine->frames_processed.fetch_add(num_frames, std::memory_order_relaxed);
+        decay_bypass_meters(engine, num_frames);
         return;
     }
 
-    // Copy input to output first (we'll process in-place)
-    if (input_left != output_left) {
-        std::memcpy(output_left, input_left, num_frames * sizeof(float));
-    }
-    if (input_right != output_right) {
-        std::memcpy(output_right, input_right, num_frames * sizeof(float));
-    }
+    // Start CPU timing
+    auto start_time = std::chrono::high_resolution_clock::now();
 
-    // Apply preamp (skip smoother ticks when stable)
+    // EQ structure and preamp mode are chosen once per buffer, so splitting
+    // it into sub-blocks gives the same samples as processing it whole
     const bool preamp_stable = engine->preamp_smoother.isStable();
-    if (preamp_stable) {
-        const float gain = engine->preamp_smoother.getCurrent();
-        for (uint32_t i = 0; i < num_frames; i++) {
-            output_left[i] *= gain;
-            output_right[i] *= gain;
-        }
-    } else {
-        for (uint32_t i = 0; i < num_frames; i++) {
-            const float preamp_gain = engine->preamp_smoother.next();
-            output_left[i] *= preamp_gain;
-            output_right[i] *= preamp_gain;
-        }
-    }
-
-    // Process through EQ bands
-    for (uint32_t band = 0; band < engine->num_active_bands; band++) {
-        if (engine->current_preset.bands[band].enabled) {
-            // Each biquad processes both channels
-            engine->bands[band].processBuffer(
-                output_left, output_right,
-                output_left, output_right,
-                num_frames
-            );
-        }
-    }
-
-    // Remove DC offset (prevents buildup from cascaded filters)
-    engine->dc_blocker.processBuffer(
-        output_left, output_right,
-        output_left, output_right,
-        num_frames
-    );
-
-    // Apply limiter if enabled
-    if (engine->limiter_enabled) {
-        engine->limiter.processBuffer(output_left, output_right, num_frames);
+    const bool block_cascade = !engine->chain.parallel && num_frames >= kBlockIIRMinFrames;
+    if (block_cascade) {
+        engine->updateBlockSections();
     }
 
-    // Peak detection
+    // All stages per L1-sized sub-block instead of one pass per stage. Sub-blocks
+    // also end at coefficient ramp steps, so each one runs on fixed coefficients.
     float buffer_peak_left = 0.0f;
     float buffer_peak_right = 0.0f;
-    for (uint32_t i = 0; i < num_frames; i++) {
-        buffer_peak_left = std::max(buffer_peak_left, std::abs(output_left[i]));
-        buffer_peak_right = std::max(buffer_peak_right, std::abs(output_right[i]));
+    for (uint32_t offset = 0; offset < num_frames;) {
+        const uint32_t block_frames = std::min(
+            {kPlanarBlockFrames, num_frames - offset, engine->framesUntilRampStep()});
+        const StereoPeak block_peak = engine->processPlanarBlock(
+            input_left + offset, input_right + offset,
+            output_left + offset, output_right + offset,
+            block_frames, preamp_stable, block_cascade
+        );
+        buffer_peak_left = std::max(buffer_peak_left, block_peak.left);
+        buffer_peak_right = std::max(buffer_peak_right, block_peak.right);
+
+        if (engine->advanceRamps(block_frames) && block_cascade) {
+            engine->updateBlockSections();
+        }
+        offset += block_frames;
     }
 
-    // Update peak meters with sample-rate-independent exponential decay
-    constexpr float peak_decay_time_ms = 300.0f;
-    const float peak_decay_samples = peak_decay_time_ms * static_cast<float>(engine->sample_rate) / 1000.0f;
-    const float peak_decay = std::exp(-static_cast<float>(num_frames) / peak_decay_samples);
-
-    float current_peak_left = engine->peak_left.load(std::memory_order_relaxed);
-    float current_peak_right = engine->peak_right.load(std::memory_order_relaxed);
-
-    // Attack: instant rise to new peak
-    // Decay: exponential fall (consistent regardless of buffer size)
-    float new_peak_left = std::max(buffer_peak_left, current_peak_left * peak_decay);
-    float new_peak_right = std::max(buffer_peak_right, current_peak_right * peak_decay);
+    meter_true_peak(engine, output_left, output_right, 1, num_frames);
+    const float* const output_channels[2] = {output_left, output_right};
+    meter_loudness(engine, output_channels, 1, num_frames);
+    tap_spectrum(engine, output_left, output_right, 1, num_frames);
+    finish_buffer(engine, num_frames, buffer_peak_left, buffer_peak_right, start_time);
+}
 
-    engine->peak_left.store(new_peak_left, std::memory_order_relaxed);
-    engine->peak_right.store(new_peak_right, std::memory_order_relaxed);
+void radioform_dsp_process_channels(
+    radioform_dsp_engine_t* engine,
+    const float* const* inputs,
+    float* const* outputs,
+    uint32_t num_frames
+) {
+    if (!engine || !inputs || !outputs || num_frames == 0) return;
 
-    // End CPU timing and calculate load
-    auto end_time = std::chrono::high_resolution_clock::now();
-    std::chrono::duration<double> elapsed = end_time - start_time;
+    const uint32_t channels = engine->num_channels;
+    for (uint32_t ch = 0; ch < channels; ch++) {
+        if (!inputs[ch] || !outputs[ch]) return;
+    }
 
-    // Calculate available time for this buffer (in seconds)
-    double available_time = static_cast<double>(num_frames) / static_cast<double>(engine->sample_rate);
+    // Stereo engines take the planar stereo path
+    if (channels == 2) {
+        radioform_dsp_process_planar(
+            engine, inputs[0], inputs[1], outputs[0], outputs[1], num_frames);
+        return;
+    }
 
-    // Calculate CPU load as percentage
-    float instant_load = static_cast<float>((elapsed.count() / available_time) * 100.0);
+    engine->applyParameterUpdates();
 
-    // Buffer-size-independent EMA: smoothing time constant ~500ms
-    constexpr float cpu_smooth_time_ms = 500.0f;
-    const float cpu_smooth_samples = cpu_smooth_time_ms * static_cast<float>(engine->sample_rate) / 1000.0f;
-    const float cpu_alpha = 1.0f - std::exp(-static_cast<float>(num_frames) / cpu_smooth_samples);
-    float current_load = engine->cpu_load_percent.load(std::memory_order_relaxed);
-    float smoothed_load = current_load + cpu_alpha * (instant_load - current_load);
-    engine->cpu_load_percent.store(smoothed_load, std::memory_order_relaxed);
+    if (engine->bypass.load(std::memory_order_relaxed)) {
+        for (uint32_t ch = 0; ch < channels; ch++) {
+            if (inputs[ch] != outputs[ch]) {
+                std::memcpy(outputs[ch], inputs[ch], num_frames * sizeof(float));
+            }
+        }
+        decay_bypass_meters(engine, num_frames);
+        return;
+    }
 
-    // Update statistics
-    engine->frames_processed.fetch_add(num_frames, std::memory_order_relaxed);
+    process_channel_blocks(engine, num_frames,
+        [&](float* frames, uint32_t offset, uint32_t count) {
+            for (uint32_t ch = 0; ch < channels; ch++) {
+                const float* src = inputs[ch] + offset;
+                for (uint32_t i = 0; i < count; i++) {
+                    frames[i * kFrameStride + ch] = src[i];
+                }
+            }
+        },
+        [&](const float* frames, uint32_t offset, uint32_t count) {
+            for (uint32_t ch = 0; ch < channels; ch++) {
+                float* dst = outputs[ch] + offset;
+                for (uint32_t i = 0; i < count; i++) {
+                    dst[i] = frames[i * kFrameStride + ch];
+                }
+            }
+        });
 }
 
 // ============================================================================
@@ -424,31 +1412,12 @@ radioform_error_t radioform_dsp_apply_preset(
         return err;
     }
 
-    // Copy preset
+    // Copy preset (updates queued for the previous one are dropped)
     std::memcpy(&engine->current_preset, preset, sizeof(radioform_preset_t));
-    engine->num_active_bands = preset->num_bands;
-
-    // Update filter coefficients and smoothers for each band
-    for (uint32_t i = 0; i < preset->num_bands; i++) {
-        const radioform_band_t& band = preset->bands[i];
-
-        if (band.enabled) {
-            // Instant coefficient set on preset load (no smoothing needed)
-            engine->bands[i].setCoeffs(band, static_cast<float>(engine->sample_rate));
-        } else {
-            engine->bands[i].setCoeffsFlat();
-        }
-    }
 
-    // Update preamp
-    float preamp_gain = db_to_gain(preset->preamp_db);
-    engine->preamp_smoother.setTarget(preamp_gain);
-
-    // Update limiter
-    engine->limiter_enabled = preset->limiter_enabled;
-    if (preset->limiter_enabled) {
-        engine->limiter.setThreshold(preset->limiter_threshold_db);
-    }
+    // Design every band, pack enabled bands and convert to parallel form if
+    // requested; the audio thread swaps it in at its next buffer
+    engine->publishConfig();
 
     return RADIOFORM_OK;
 }
@@ -465,6 +1434,101 @@ radioform_error_t radioform_dsp_get_preset(
     return RADIOFORM_OK;
 }
 
+// ============================================================================
+// Processing Mode (NOT realtime-safe)
+// ============================================================================
+
+radioform_error_t radioform_dsp_set_eq_mode(
+    radioform_dsp_engine_t* engine,
+    radioform_eq_mode_t mode
+) {
+    if (!engine) return RADIOFORM_ERROR_NULL_POINTER;
+    if (mode != RADIOFORM_EQ_MODE_CASCADE && mode != RADIOFORM_EQ_MODE_PARALLEL) {
+        return RADIOFORM_ERROR_INVALID_PARAM;
+    }
+
+    engine->eq_mode = mode;
+
+    // Recalculate coefficients (finishes any ramp) and convert if needed
+    return radioform_dsp_apply_preset(engine, &engine->current_preset);
+}
+
+radioform_eq_mode_t radioform_dsp_get_eq_mode(const radioform_dsp_engine_t* engine) {
+    return engine ? engine->eq_mode : RADIOFORM_EQ_MODE_CASCADE;
+}
+
+radioform_eq_mode_t radioform_dsp_get_active_eq_mode(const radioform_dsp_engine_t* engine) {
+    return (engine && engine->control_parallel)
+        ? RADIOFORM_EQ_MODE_PARALLEL
+        : RADIOFORM_EQ_MODE_CASCADE;
+}
+
+radioform_error_t radioform_dsp_set_band_topology(
+    radioform_dsp_engine_t* engine,
+    uint32_t band_index,
+    radioform_filter_topology_t topology
+) {
+    if (!engine) return RADIOFORM_ERROR_NULL_POINTER;
+    if (band_index >= RADIOFORM_MAX_BANDS ||
+        (topology != RADIOFORM_TOPOLOGY_BIQUAD && topology != RADIOFORM_TOPOLOGY_SVF &&
+         topology != RADIOFORM_TOPOLOGY_AUTO)) {
+        return RADIOFORM_ERROR_INVALID_PARAM;
+    }
+
+    engine->requested_topology[band_index] = topology;
+
+    // Repack the bands (finishes any ramp)
+    return radioform_dsp_apply_preset(engine, &engine->current_preset);
+}
+
+radioform_error_t radioform_dsp_set_limiter_mode(
+    radioform_dsp_engine_t* engine,
+    radioform_limiter_mode_t mode,
+    float lookahead_ms,
+    float release_ms
+) {
+    if (!engine) return RADIOFORM_ERROR_NULL_POINTER;
+    if ((mode != RADIOFORM_LIMITER_MODE_SOFT && mode != RADIOFORM_LIMITER_MODE_LOOKAHEAD) ||
+        !(lookahead_ms >= 1.0f && lookahead_ms <= 5.0f) ||
+        !(release_ms >= 1.0f && release_ms <= 1000.0f)) {
+        return RADIOFORM_ERROR_INVALID_PARAM;
+    }
+
+    engine->limiter_mode = mode;
+    engine->limiter_lookahead_ms = lookahead_ms;
+    engine->limiter_release_ms = release_ms;
+
+    return radioform_dsp_apply_preset(engine, &engine->current_preset);
+}
+
+radioform_error_t radioform_dsp_set_limiter_oversampling(
+    radioform_dsp_engine_t* engine,
+    uint32_t factor
+) {
+    if (!engine) return RADIOFORM_ERROR_NULL_POINTER;
+    if (factor != 1 && factor != 2 && factor != 4 && factor != 8) {
+        return RADIOFORM_ERROR_INVALID_PARAM;
+    }
+
+    engine->limiter_oversampling = factor;
+
+    return radioform_dsp_apply_preset(engine, &engine->current_preset);
+}
+
+uint32_t radioform_dsp_get_latency_frames(const radioform_dsp_engine_t* engine) {
+    return engine ? engine->latency_frames.load(std::memory_order_relaxed) : 0;
+}
+
+radioform_filter_topology_t radioform_dsp_get_band_topology(
+    const radioform_dsp_engine_t* engine,
+    uint32_t band_index
+) {
+    if (!engine || band_index >= engine->current_preset.num_bands) {
+        return RADIOFORM_TOPOLOGY_BIQUAD;
+    }
+    return engine->config_exchange.latest()->topology[band_index];
+}
+
 // ============================================================================
 // Realtime Parameter Updates (Lock-free)
 // ============================================================================
@@ -484,7 +1548,7 @@ void radioform_dsp_update_band_gain(
     uint32_t band_index,
     float gain_db
 ) {
-    if (!engine || band_index >= engine->num_active_bands) return;
+    if (!engine || band_index >= engine->current_preset.num_bands) return;
 
     // Clamp gain
     gain_db = std::max(-12.0f, std::min(12.0f, gain_db));
@@ -492,12 +1556,8 @@ void radioform_dsp_update_band_gain(
     // Update preset
     engine->current_preset.bands[band_index].gain_db = gain_db;
 
-    // Smoothly interpolate coefficients to prevent zipper noise
-    const radioform_band_t& band = engine->current_preset.bands[band_index];
-    engine->bands[band_index].setCoeffsSmooth(
-        band, static_cast<float>(engine->sample_rate),
-        engine->coeff_transition_samples
-    );
+    // Design on this thread; the audio thread ramps to it (no zipper noise)
+    engine->postBandUpdate(band_index);
 }
 
 void radioform_dsp_update_preamp(
@@ -512,9 +1572,11 @@ void radioform_dsp_update_preamp(
     // Update preset
     engine->current_preset.preamp_db = gain_db;
 
-    // Update smoother target
-    float target_gain = db_to_gain(gain_db);
-    engine->preamp_smoother.setTarget(target_gain);
+    // Queue the new smoother target
+    PreampUpdate& update = engine->parameter_queue.preamp();
+    update.epoch = engine->config_epoch;
+    update.gain = db_to_gain(gain_db);
+    engine->parameter_queue.publish(ParameterQueue::kPreampTarget);
 }
 
 void radioform_dsp_update_band_frequency(
@@ -522,7 +1584,7 @@ void radioform_dsp_update_band_frequency(
     uint32_t band_index,
     float frequency_hz
 ) {
-    if (!engine || band_index >= engine->num_active_bands) return;
+    if (!engine || band_index >= engine->current_preset.num_bands) return;
 
     // Clamp frequency
     frequency_hz = std::max(20.0f, std::min(20000.0f, frequency_hz));
@@ -530,12 +1592,8 @@ void radioform_dsp_update_band_frequency(
     // Update preset
     engine->current_preset.bands[band_index].frequency_hz = frequency_hz;
 
-    // Smoothly interpolate coefficients to prevent zipper noise
-    const radioform_band_t& band = engine->current_preset.bands[band_index];
-    engine->bands[band_index].setCoeffsSmooth(
-        band, static_cast<float>(engine->sample_rate),
-        engine->coeff_transition_samples
-    );
+    // Design on this thread; the audio thread ramps to it (no zipper noise)
+    engine->postBandUpdate(band_index);
 }
 
 void radioform_dsp_update_band_q(
@@ -543,7 +1601,7 @@ void radioform_dsp_update_band_q(
     uint32_t band_index,
     float q_factor
 ) {
-    if (!engine || band_index >= engine->num_active_bands) return;
+    if (!engine || band_index >= engine->current_preset.num_bands) return;
 
     // Clamp Q factor
     q_factor = std::max(0.1f, std::min(10.0f, q_factor));
@@ -551,12 +1609,8 @@ void radioform_dsp_update_band_q(
     // Update preset
     engine->current_preset.bands[band_index].q_factor = q_factor;
 
-    // Smoothly interpolate coefficients to prevent zipper noise
-    const radioform_band_t& band = engine->current_preset.bands[band_index];
-    engine->bands[band_index].setCoeffsSmooth(
-        band, static_cast<float>(engine->sample_rate),
-        engine->coeff_transition_samples
-    );
+    // Design on this thread; the audio thread ramps to it (no zipper noise)
+    engine->postBandUpdate(band_index);
 }
 
 // ============================================================================
@@ -587,6 +1641,113 @@ void radioform_dsp_get_stats(
     stats->peak_right_db = peak_right_linear > 0.0f
         ? std::max(20.0f * std::log10(peak_right_linear), min_db)
         : min_db;
+
+    stats->coeff_cache_hits = engine->coeff_cache.hits();
+    stats->coeff_cache_misses = engine->coeff_cache.misses();
+
+    const bool true_peak = engine->true_peak_enabled.load(std::memory_order_relaxed);
+    const float true_peak_left = true_peak ? engine->true_peak_left.load(std::memory_order_relaxed) : 0.0f;
+    const float true_peak_right = true_peak ? engine->true_peak_right.load(std::memory_order_relaxed) : 0.0f;
+    stats->true_peak_left_db = true_peak_left > 0.0f
+        ? std::max(20.0f * std::log10(true_peak_left), min_db)
+        : min_db;
+    stats->true_peak_right_db = true_peak_right > 0.0f
+        ? std::max(20.0f * std::log10(true_peak_right), min_db)
+        : min_db;
+    stats->true_peak_overs = engine->true_peak_overs.load(std::memory_order_relaxed);
+}
+
+void radioform_dsp_set_true_peak_metering(radioform_dsp_engine_t* engine, bool enabled) {
+    if (engine) {
+        engine->true_peak_enabled.store(enabled, std::memory_order_relaxed);
+    }
+}
+
+void radioform_dsp_set_loudness_metering(radioform_dsp_engine_t* engine, bool enabled) {
+    if (engine) {
+        engine->loudness_enabled.store(enabled, std::memory_order_relaxed);
+    }
+}
+
+void radioform_dsp_reset_loudness(radioform_dsp_engine_t* engine) {
+    if (engine) {
+        engine->loudness_reset_requested.store(true, std::memory_order_relaxed);
+    }
+}
+
+radioform_error_t radioform_dsp_get_loudness(
+    const radioform_dsp_engine_t* engine,
+    radioform_loudness_t* loudness
+) {
+    if (!engine || !loudness) return RADIOFORM_ERROR_NULL_POINTER;
+
+    const bool enabled = engine->loudness_enabled.load(std::memory_order_relaxed);
+    constexpr float floor = LoudnessMeter::kFloorLufs;
+    loudness->momentary_lufs = enabled ? engine->loudness_momentary.load(std::memory_order_relaxed) : floor;
+    loudness->short_term_lufs = enabled ? engine->loudness_short_term.load(std::memory_order_relaxed) : floor;
+    loudness->integrated_lufs = enabled ? engine->loudness_integrated.load(std::memory_order_relaxed) : floor;
+    return RADIOFORM_OK;
+}
+
+radioform_error_t radioform_dsp_get_kernel_info(
+    const radioform_dsp_engine_t* engine,
+    radioform_kernel_info_t* info
+) {
+    if (!engine || !info) return RADIOFORM_ERROR_NULL_POINTER;
+
+    info->kernel_set = engine->kernels->name;
+    info->cpu_features = engine->cpu_features;
+    info->vector_width = engine->kernels->vector_width;
+    return RADIOFORM_OK;
+}
+
+// ============================================================================
+// Spectrum Analysis
+// ============================================================================
+
+void radioform_dsp_spectrum_config_init_default(radioform_spectrum_config_t* config) {
+    if (!config) return;
+
+    config->fft_size = 4096;
+    config->num_bins = 64;
+    config->min_frequency_hz = 20.0f;
+    config->max_frequency_hz = 20000.0f;
+    config->averaging_ms = 200.0f;
+    config->peak_hold_ms = 1000.0f;
+    config->peak_fall_db_per_s = 20.0f;
+}
+
+void radioform_dsp_set_spectrum_tap(radioform_dsp_engine_t* engine, bool enabled) {
+    if (engine) {
+        engine->spectrum_tap_enabled.store(enabled, std::memory_order_relaxed);
+    }
+}
+
+radioform_error_t radioform_dsp_configure_spectrum(
+    radioform_dsp_engine_t* engine,
+    const radioform_spectrum_config_t* config
+) {
+    if (!engine || !config) return RADIOFORM_ERROR_NULL_POINTER;
+    if (!SpectrumAnalyzer::validate(*config, static_cast<float>(engine->sample_rate))) {
+        return RADIOFORM_ERROR_INVALID_PARAM;
+    }
+
+    engine->configureSpectrum(*config);
+    return RADIOFORM_OK;
+}
+
+radioform_error_t radioform_dsp_analyze_spectrum(
+    radioform_dsp_engine_t* engine,
+    radioform_spectrum_t* spectrum
+) {
+    if (!engine || !spectrum) return RADIOFORM_ERROR_NULL_POINTER;
+
+    // Bins follow a sample rate change on the next analysis
+    if (engine->spectrum_analyzer.sampleRate() != static_cast<float>(engine->sample_rate)) {
+        engine->configureSpectrum(engine->spectrum_analyzer.config());
+    }
+    engine->spectrum_analyzer.analyze(engine->spectrum_tap, *spectrum);
+    return RADIOFORM_OK;
 }
 
 // ============================================================================
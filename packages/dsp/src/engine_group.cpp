@@ -0,0 +1,541 @@
+/**
+ * @file engine_group.cpp
+ * @brief Engine groups: several stereo engines processed in SIMD lanes
+ *
+ * Implements the radioform_dsp_engine_group_* functions of radioform_dsp.h.
+ * Presets are designed here (per lane, into a GroupConfig that the audio
+ * thread swaps into GroupBank); processing transposes every engine's
+ * interleaved buffer into one block and runs the group kernel of the
+ * dispatch table on it.
+ */
+
+#include "radioform_dsp.h"
+#include "engine_group.h"
+#include "biquad.h"
+#include "biquad_design.h"
+#include "svf.h"
+#include "smoothing.h"
+#include "limiter.h"
+#include "dc_blocker.h"
+#include "cpu_util.h"
+#include "dispatch.h"
+#include "config_snapshot.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+
+using namespace radioform;
+
+namespace {
+
+/**
+ * @brief Which band each of a lane's sections holds
+ */
+struct LaneLayout {
+    uint32_t num_svf = 0;
+    uint32_t num_sections = 0;
+    uint32_t svf_band[RADIOFORM_MAX_BANDS];
+    uint32_t section_band[RADIOFORM_MAX_BANDS];
+};
+
+/**
+ * @brief Designed coefficients of every lane (GroupBank's configuration part)
+ *
+ * Built on the control thread and swapped in whole by the audio thread
+ * (SnapshotExchange), like a stereo engine's EngineConfig.
+ */
+struct GroupConfig {
+    uint32_t num_svf;
+    uint32_t num_sections;
+    float svf_gain[RADIOFORM_MAX_BANDS][3][kGroupLanes];
+    float svf_mix[RADIOFORM_MAX_BANDS][3][kGroupLanes];
+    float biquad[RADIOFORM_MAX_BANDS][5][kGroupLanes];
+    float preamp_target[kGroupLanes];
+    float limiter_knee[kGroupLanes];
+    float limiter_range[kGroupLanes];
+    float limiter_on[kGroupLanes];
+    LaneLayout layouts[kGroupLanes];
+};
+
+/**
+ * @brief Per-engine values read by other threads
+ */
+struct alignas(kCacheLineSize) MemberStats {
+    std::atomic<bool> bypass{false};
+    std::atomic<uint64_t> frames_processed{0};
+    std::atomic<float> peak_left{0.0f};
+    std::atomic<float> peak_right{0.0f};
+};
+
+bool same_preset(const radioform_preset_t& a, const radioform_preset_t& b) {
+    if (a.num_bands != b.num_bands || a.preamp_db != b.preamp_db ||
+        a.limiter_enabled != b.limiter_enabled || a.limiter_threshold_db != b.limiter_threshold_db) {
+        return false;
+    }
+    for (uint32_t i = 0; i < a.num_bands; i++) {
+        const radioform_band_t& x = a.bands[i];
+        const radioform_band_t& y = b.bands[i];
+        if (x.frequency_hz != y.frequency_hz || x.gain_db != y.gain_db ||
+            x.q_factor != y.q_factor || x.type != y.type || x.enabled != y.enabled) {
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace
+
+// ============================================================================
+// Group Internal Structure
+// ============================================================================
+
+struct radioform_dsp_engine_group {
+    // ------------------------------------------------------------------------
+    // Audio thread
+    // ------------------------------------------------------------------------
+
+    GroupBank bank;
+    const KernelTable* kernels;
+
+    // Layout of each lane's installed configuration (section state follows it)
+    std::array<LaneLayout, kGroupLanes> installed_layouts;
+
+    // Transposed block, [frame][channel][lane]; lanes past num_engines stay zero
+    alignas(kCacheLineSize) float block[kGroupBlockFrames * 2 * kGroupLanes];
+
+    // ------------------------------------------------------------------------
+    // Control thread
+    // ------------------------------------------------------------------------
+
+    uint32_t sample_rate;
+    std::array<radioform_preset_t, kGroupLanes> presets;
+    std::array<bool, kGroupLanes> has_preset;
+
+    // Configuration being designed, and its handover to the audio thread
+    GroupConfig design;
+    alignas(kCacheLineSize) SnapshotExchange<GroupConfig> config_exchange;
+
+    // ------------------------------------------------------------------------
+    // Shared with the UI thread
+    // ------------------------------------------------------------------------
+
+    std::array<MemberStats, kGroupLanes> stats;
+    alignas(kCacheLineSize) std::atomic<float> cpu_load_percent;
+
+    radioform_dsp_engine_group(uint32_t sr, uint32_t num_engines)
+        : kernels(&select_kernel_table(detect_cpu_features()))
+        , sample_rate(sr)
+        , cpu_load_percent(0.0f)
+    {
+        enable_denormal_suppression();
+
+        std::memset(&bank, 0, sizeof(bank));
+        design = GroupConfig{};
+        std::memset(block, 0, sizeof(block));
+        bank.num_engines = num_engines;
+        has_preset.fill(false);
+
+        for (uint32_t lane = 0; lane < kGroupLanes; lane++) {
+            for (uint32_t k = 0; k < RADIOFORM_MAX_BANDS; k++) {
+                setPassthrough(lane, k);
+            }
+        }
+        initSampleRate();
+
+        radioform_preset_t flat;
+        radioform_dsp_preset_init_flat(&flat);
+        for (uint32_t lane = 0; lane < num_engines; lane++) {
+            applyPreset(lane, flat);
+        }
+        installConfig(*config_exchange.take());
+        for (uint32_t lane = 0; lane < num_engines; lane++) {
+            bank.preamp_current[lane] = bank.preamp_target[lane];
+        }
+    }
+
+    /**
+     * @brief Sample-rate dependent coefficients of every lane
+     */
+    void initSampleRate() {
+        const float sr = static_cast<float>(sample_rate);
+
+        ParameterSmoother preamp;
+        preamp.init(sr, 10.0f);
+        DCBlocker dc;
+        dc.init(sr, 5.0f);
+
+        bank.dc_coeff = dc.coefficient();
+        for (uint32_t lane = 0; lane < kGroupLanes; lane++) {
+            bank.preamp_coeff[lane] = preamp.coefficient();
+            bank.preamp_velocity_coeff[lane] = preamp.velocityCoefficient();
+        }
+    }
+
+    /**
+     * @brief Make section slot k of a lane's design an identity (both kinds)
+     */
+    void setPassthrough(uint32_t lane, uint32_t k) {
+        const float svf_gain[3] = {1.0f, 0.0f, 0.0f};  // g = 0, k = 1
+        const float svf_mix[3] = {1.0f, 0.0f, 0.0f};
+        const float biquad[5] = {1.0f, 0.0f, 0.0f, 0.0f, 0.0f};
+        for (int c = 0; c < 3; c++) {
+            design.svf_gain[k][c][lane] = svf_gain[c];
+            design.svf_mix[k][c][lane] = svf_mix[c];
+        }
+        for (int c = 0; c < 5; c++) {
+            design.biquad[k][c][lane] = biquad[c];
+        }
+    }
+
+    void clearSvfState(uint32_t lane, uint32_t k) {
+        for (uint32_t ch = 0; ch < 2; ch++) {
+            bank.svf_ic1[k][ch][lane] = 0.0f;
+            bank.svf_ic2[k][ch][lane] = 0.0f;
+        }
+    }
+
+    void clearBiquadState(uint32_t lane, uint32_t k) {
+        for (uint32_t ch = 0; ch < 2; ch++) {
+            bank.z1[k][ch][lane] = 0.0f;
+            bank.z2[k][ch][lane] = 0.0f;
+        }
+    }
+
+    /**
+     * @brief Design a preset into one lane
+     *
+     * Bands are split by topology as in the engine (svf_preferred()). If
+     * another engine already runs an identical preset its designed lane is
+     * copied instead of redesigning it. The result is published for the
+     * audio thread (installConfig()).
+     */
+    void applyPreset(uint32_t lane, const radioform_preset_t& preset) {
+        const float sr = static_cast<float>(sample_rate);
+
+        int source = -1;
+        for (uint32_t other = 0; other < bank.num_engines; other++) {
+            if (other != lane && has_preset[other] && same_preset(presets[other], preset)) {
+                source = static_cast<int>(other);
+                break;
+            }
+        }
+
+        LaneLayout layout;
+        if (source >= 0) {
+            layout = design.layouts[source];
+            for (uint32_t k = 0; k < RADIOFORM_MAX_BANDS; k++) {
+                for (int c = 0; c < 3; c++) {
+                    design.svf_gain[k][c][lane] = design.svf_gain[k][c][source];
+                    design.svf_mix[k][c][lane] = design.svf_mix[k][c][source];
+                }
+                for (int c = 0; c < 5; c++) {
+                    design.biquad[k][c][lane] = design.biquad[k][c][source];
+                }
+            }
+        } else {
+            for (uint32_t k = 0; k < RADIOFORM_MAX_BANDS; k++) {
+                setPassthrough(lane, k);
+            }
+            BiquadCoeffs designed[RADIOFORM_MAX_BANDS];
+            design_biquads(preset.bands, preset.num_bands, sr, designed);
+            for (uint32_t band = 0; band < preset.num_bands; band++) {
+                const radioform_band_t& config = preset.bands[band];
+                if (!config.enabled) {
+                    continue;
+                }
+                if (svf_preferred(config, sr)) {
+                    StateVariableFilter svf;
+                    svf.init();
+                    svf.setCoeffs(config, sr);
+                    const uint32_t k = layout.num_svf++;
+                    layout.svf_band[k] = band;
+                    for (int c = 0; c < 3; c++) {
+                        design.svf_gain[k][c][lane] = svf.gains()[c];
+                    }
+                    design.svf_mix[k][0][lane] = svf.params().m0;
+                    design.svf_mix[k][1][lane] = svf.params().m1;
+                    design.svf_mix[k][2][lane] = svf.params().m2;
+                } else {
+                    Biquad bq;
+                    bq.init();
+                    bq.setCoeffs(designed[band]);
+                    const BiquadCoeffs& c = bq.coeffs();
+                    const uint32_t k = layout.num_sections++;
+                    layout.section_band[k] = band;
+                    design.biquad[k][0][lane] = c.b0;
+                    design.biquad[k][1][lane] = c.b1;
+                    design.biquad[k][2][lane] = c.b2;
+                    design.biquad[k][3][lane] = c.a1;
+                    design.biquad[k][4][lane] = c.a2;
+                }
+            }
+        }
+
+        design.layouts[lane] = layout;
+
+        design.preamp_target[lane] = db_to_gain(preset.preamp_db);
+
+        SoftLimiter limiter;
+        limiter.init(preset.limiter_threshold_db);
+        design.limiter_knee[lane] = limiter.kneeStart();
+        design.limiter_range[lane] = limiter.threshold() - limiter.kneeStart();
+        design.limiter_on[lane] = preset.limiter_enabled ? 1.0f : 0.0f;
+
+        presets[lane] = preset;
+        has_preset[lane] = true;
+
+        // Lanes run as many sections as the longest chain (the rest pass through)
+        design.num_svf = 0;
+        design.num_sections = 0;
+        for (uint32_t other = 0; other < bank.num_engines; other++) {
+            design.num_svf = std::max(design.num_svf, design.layouts[other].num_svf);
+            design.num_sections = std::max(design.num_sections, design.layouts[other].num_sections);
+        }
+
+        config_exchange.acquire() = design;
+        config_exchange.publish();
+    }
+
+    /**
+     * @brief Copy a published configuration into the bank (audio thread)
+     *
+     * A slot keeps its filter state when it still holds the same band;
+     * slots now holding another band start clear.
+     */
+    void installConfig(const GroupConfig& config) {
+        std::memcpy(bank.svf_gain, config.svf_gain, sizeof(bank.svf_gain));
+        std::memcpy(bank.svf_mix, config.svf_mix, sizeof(bank.svf_mix));
+        std::memcpy(bank.biquad, config.biquad, sizeof(bank.biquad));
+        std::memcpy(bank.preamp_target, config.preamp_target, sizeof(bank.preamp_target));
+        std::memcpy(bank.limiter_knee, config.limiter_knee, sizeof(bank.limiter_knee));
+        std::memcpy(bank.limiter_range, config.limiter_range, sizeof(bank.limiter_range));
+        std::memcpy(bank.limiter_on, config.limiter_on, sizeof(bank.limiter_on));
+
+        for (uint32_t lane = 0; lane < bank.num_engines; lane++) {
+            const LaneLayout& previous = installed_layouts[lane];
+            const LaneLayout& layout = config.layouts[lane];
+            for (uint32_t k = 0; k < RADIOFORM_MAX_BANDS; k++) {
+                const bool keep_svf = k < layout.num_svf && k < previous.num_svf &&
+                    layout.svf_band[k] == previous.svf_band[k];
+                const bool keep_biquad = k < layout.num_sections && k < previous.num_sections &&
+                    layout.section_band[k] == previous.section_band[k];
+                if (!keep_svf) {
+                    clearSvfState(lane, k);
+                }
+                if (!keep_biquad) {
+                    clearBiquadState(lane, k);
+                }
+            }
+            installed_layouts[lane] = layout;
+        }
+
+        bank.num_svf = config.num_svf;
+        bank.num_sections = config.num_sections;
+    }
+
+    void resetState() {
+        std::memset(bank.svf_ic1, 0, sizeof(bank.svf_ic1));
+        std::memset(bank.svf_ic2, 0, sizeof(bank.svf_ic2));
+        std::memset(bank.z1, 0, sizeof(bank.z1));
+        std::memset(bank.z2, 0, sizeof(bank.z2));
+        std::memset(bank.dc_x, 0, sizeof(bank.dc_x));
+        std::memset(bank.dc_y, 0, sizeof(bank.dc_y));
+    }
+};
+
+// ============================================================================
+// Group Lifecycle
+// ============================================================================
+
+radioform_dsp_engine_group_t* radioform_dsp_engine_group_create(
+    uint32_t sample_rate,
+    uint32_t num_engines
+) {
+    if (sample_rate < 8000 || sample_rate > 384000) {
+        return nullptr;
+    }
+    if (num_engines < 1 || num_engines > RADIOFORM_MAX_GROUP_ENGINES) {
+        return nullptr;
+    }
+
+    try {
+        return new radioform_dsp_engine_group(sample_rate, num_engines);
+    } catch (...) {
+        return nullptr;
+    }
+}
+
+void radioform_dsp_engine_group_destroy(radioform_dsp_engine_group_t* group) {
+    delete group;
+}
+
+void radioform_dsp_engine_group_reset(radioform_dsp_engine_group_t* group) {
+    if (!group) return;
+
+    group->resetState();
+    for (uint32_t lane = 0; lane < group->bank.num_engines; lane++) {
+        group->stats[lane].frames_processed.store(0);
+    }
+}
+
+uint32_t radioform_dsp_engine_group_get_num_engines(const radioform_dsp_engine_group_t* group) {
+    return group ? group->bank.num_engines : 0;
+}
+
+// ============================================================================
+// Configuration (NOT realtime-safe)
+// ============================================================================
+
+radioform_error_t radioform_dsp_engine_group_apply_preset(
+    radioform_dsp_engine_group_t* group,
+    uint32_t engine_index,
+    const radioform_preset_t* preset
+) {
+    if (!group || !preset) return RADIOFORM_ERROR_NULL_POINTER;
+    if (engine_index >= group->bank.num_engines) return RADIOFORM_ERROR_INVALID_PARAM;
+
+    const radioform_error_t err = radioform_dsp_preset_validate(preset);
+    if (err != RADIOFORM_OK) {
+        return err;
+    }
+
+    group->applyPreset(engine_index, *preset);
+    return RADIOFORM_OK;
+}
+
+void radioform_dsp_engine_group_set_bypass(
+    radioform_dsp_engine_group_t* group,
+    uint32_t engine_index,
+    bool bypass
+) {
+    if (group && engine_index < group->bank.num_engines) {
+        group->stats[engine_index].bypass.store(bypass, std::memory_order_relaxed);
+    }
+}
+
+// ============================================================================
+// Audio Processing (REALTIME-SAFE)
+// ============================================================================
+
+void radioform_dsp_engine_group_process_interleaved(
+    radioform_dsp_engine_group_t* group,
+    const float* const* inputs,
+    float* const* outputs,
+    uint32_t num_frames
+) {
+    if (!group || !inputs || !outputs || num_frames == 0) return;
+
+    const uint32_t engines = group->bank.num_engines;
+    for (uint32_t e = 0; e < engines; e++) {
+        if (!inputs[e] || !outputs[e]) return;
+    }
+
+    // Take the newest preset configuration, if one was published
+    if (const GroupConfig* config = group->config_exchange.take()) {
+        group->installConfig(*config);
+    }
+
+    auto start_time = std::chrono::high_resolution_clock::now();
+
+    bool bypass[kGroupLanes];
+    for (uint32_t e = 0; e < engines; e++) {
+        bypass[e] = group->stats[e].bypass.load(std::memory_order_relaxed);
+    }
+
+    float peaks[2 * kGroupLanes] = {};
+    float* block = group->block;
+    for (uint32_t offset = 0; offset < num_frames; offset += kGroupBlockFrames) {
+        const uint32_t frames = std::min(kGroupBlockFrames, num_frames - offset);
+
+        for (uint32_t e = 0; e < engines; e++) {
+            const float* src = inputs[e] + static_cast<size_t>(offset) * 2;
+            for (uint32_t i = 0; i < frames; i++) {
+                block[(i * 2) * kGroupLanes + e] = src[i * 2];
+                block[(i * 2 + 1) * kGroupLanes + e] = src[i * 2 + 1];
+            }
+        }
+
+        group->kernels->group(group->bank, block, frames, peaks);
+
+        for (uint32_t e = 0; e < engines; e++) {
+            float* dst = outputs[e] + static_cast<size_t>(offset) * 2;
+            if (bypass[e]) {
+                // Bit-perfect passthrough; the lane keeps running underneath
+                if (inputs[e] != outputs[e]) {
+                    std::memcpy(dst, inputs[e] + static_cast<size_t>(offset) * 2,
+                                frames * 2 * sizeof(float));
+                }
+                continue;
+            }
+            for (uint32_t i = 0; i < frames; i++) {
+                dst[i * 2] = block[(i * 2) * kGroupLanes + e];
+                dst[i * 2 + 1] = block[(i * 2 + 1) * kGroupLanes + e];
+            }
+        }
+    }
+
+    // Peak meters: same 300 ms decay as the engine
+    constexpr float peak_decay_time_ms = 300.0f;
+    const float peak_decay_samples = peak_decay_time_ms * static_cast<float>(group->sample_rate) / 1000.0f;
+    const float peak_decay = std::exp(-static_cast<float>(num_frames) / peak_decay_samples);
+    for (uint32_t e = 0; e < engines; e++) {
+        MemberStats& stats = group->stats[e];
+        const float left = bypass[e] ? 0.0f : peaks[e];
+        const float right = bypass[e] ? 0.0f : peaks[kGroupLanes + e];
+        stats.peak_left.store(
+            std::max(left, stats.peak_left.load(std::memory_order_relaxed) * peak_decay),
+            std::memory_order_relaxed);
+        stats.peak_right.store(
+            std::max(right, stats.peak_right.load(std::memory_order_relaxed) * peak_decay),
+            std::memory_order_relaxed);
+        stats.frames_processed.fetch_add(num_frames, std::memory_order_relaxed);
+    }
+
+    // CPU load of the whole group (same smoothing as the engine)
+    auto end_time = std::chrono::high_resolution_clock::now();
+    std::chrono::duration<double> elapsed = end_time - start_time;
+    double available_time = static_cast<double>(num_frames) / static_cast<double>(group->sample_rate);
+    float instant_load = static_cast<float>((elapsed.count() / available_time) * 100.0);
+
+    constexpr float cpu_smooth_time_ms = 500.0f;
+    const float cpu_smooth_samples = cpu_smooth_time_ms * static_cast<float>(group->sample_rate) / 1000.0f;
+    const float cpu_alpha = 1.0f - std::exp(-static_cast<float>(num_frames) / cpu_smooth_samples);
+    float current_load = group->cpu_load_percent.load(std::memory_order_relaxed);
+    group->cpu_load_percent.store(current_load + cpu_alpha * (instant_load - current_load),
+                                  std::memory_order_relaxed);
+}
+
+// ============================================================================
+// Diagnostics
+// ============================================================================
+
+void radioform_dsp_engine_group_get_stats(
+    const radioform_dsp_engine_group_t* group,
+    uint32_t engine_index,
+    radioform_stats_t* stats
+) {
+    if (!group || !stats || engine_index >= group->bank.num_engines) return;
+
+    const MemberStats& member = group->stats[engine_index];
+    stats->frames_processed = member.frames_processed.load(std::memory_order_relaxed);
+    stats->underrun_count = 0;
+    stats->cpu_load_percent = group->cpu_load_percent.load(std::memory_order_relaxed);
+    stats->bypass_active = member.bypass.load(std::memory_order_relaxed);
+    stats->sample_rate = group->sample_rate;
+
+    constexpr float min_db = -120.0f;
+    const float peak_left = member.peak_left.load(std::memory_order_relaxed);
+    const float peak_right = member.peak_right.load(std::memory_order_relaxed);
+    stats->peak_left_db = peak_left > 0.0f ? std::max(20.0f * std::log10(peak_left), min_db) : min_db;
+    stats->peak_right_db = peak_right > 0.0f ? std::max(20.0f * std::log10(peak_right), min_db) : min_db;
+
+    stats->coeff_cache_hits = 0;  // Groups design without the cache
+    stats->coeff_cache_misses = 0;
+    stats->true_peak_left_db = min_db;  // Groups do not meter true peak
+    stats->true_peak_right_db = min_db;
+    stats->true_peak_overs = 0;
+}
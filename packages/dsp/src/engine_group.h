@@ -0,0 +1,88 @@
+/**
+ * @file engine_group.h
+ * @brief Structure-of-arrays state for radioform_dsp_engine_group_t
+ *
+ * A group runs up to RADIOFORM_MAX_GROUP_ENGINES independent stereo chains
+ * with one engine per SIMD lane: every field below is an array indexed by
+ * engine, so a single vector op advances the same stage of 4 (SSE2/NEON) or
+ * 8 (AVX2) engines. Left and right are separate vectors.
+ *
+ * Each engine's chain has the same shape as a stereo engine's (preamp ->
+ * state-variable bands -> biquad cascade -> DC blocker -> limiter), but the
+ * section counts differ between engines. Lanes with fewer sections are
+ * padded with passthrough sections, so all lanes run the same code.
+ *
+ * The group kernel (kernels_impl.h) works on blocks transposed to
+ * [frame][channel][lane] by engine_group.cpp.
+ */
+
+#ifndef RADIOFORM_ENGINE_GROUP_H
+#define RADIOFORM_ENGINE_GROUP_H
+
+#include "radioform_types.h"
+#include "cpu_util.h"
+
+#include <cstdint>
+
+namespace radioform {
+
+static constexpr uint32_t kGroupLanes = RADIOFORM_MAX_GROUP_ENGINES;
+
+// Frames per transposed block (2 KB per channel at 8 lanes)
+static constexpr uint32_t kGroupBlockFrames = 64;
+
+/**
+ * @brief Coefficients and state of every engine in a group, one lane per engine
+ *
+ * Sections are indexed [section][lane]; state [section][channel][lane].
+ */
+struct GroupBank {
+    uint32_t num_engines;
+    uint32_t num_svf;       // State-variable sections in the longest chain
+    uint32_t num_sections;  // Biquad sections in the longest chain
+
+    // Preamp smoothers (ParameterSmoother, one per lane)
+    alignas(kCacheLineSize) float preamp_coeff[kGroupLanes];
+    alignas(kCacheLineSize) float preamp_velocity_coeff[kGroupLanes];
+    alignas(kCacheLineSize) float preamp_current[kGroupLanes];
+    alignas(kCacheLineSize) float preamp_target[kGroupLanes];
+    alignas(kCacheLineSize) float preamp_velocity[kGroupLanes];
+
+    // State-variable sections: per-sample gains, output mix, integrators
+    alignas(kCacheLineSize) float svf_gain[RADIOFORM_MAX_BANDS][3][kGroupLanes];
+    alignas(kCacheLineSize) float svf_mix[RADIOFORM_MAX_BANDS][3][kGroupLanes];
+    alignas(kCacheLineSize) float svf_ic1[RADIOFORM_MAX_BANDS][2][kGroupLanes];
+    alignas(kCacheLineSize) float svf_ic2[RADIOFORM_MAX_BANDS][2][kGroupLanes];
+
+    // Biquad sections (b0, b1, b2, a1, a2) and TDF2 state
+    alignas(kCacheLineSize) float biquad[RADIOFORM_MAX_BANDS][5][kGroupLanes];
+    alignas(kCacheLineSize) float z1[RADIOFORM_MAX_BANDS][2][kGroupLanes];
+    alignas(kCacheLineSize) float z2[RADIOFORM_MAX_BANDS][2][kGroupLanes];
+
+    // DC blockers (all lanes share the sample rate, so one coefficient)
+    float dc_coeff;
+    alignas(kCacheLineSize) float dc_x[2][kGroupLanes];
+    alignas(kCacheLineSize) float dc_y[2][kGroupLanes];
+
+    // Limiters; limiter_on is 1 where enabled, 0 where not
+    alignas(kCacheLineSize) float limiter_knee[kGroupLanes];
+    alignas(kCacheLineSize) float limiter_range[kGroupLanes];
+    alignas(kCacheLineSize) float limiter_on[kGroupLanes];
+};
+
+/**
+ * @brief Group kernel signature
+ *
+ * @param block num_frames transposed frames, [frame][channel][lane], in place
+ * @param peaks Per-lane peak levels [channel][lane], raised to this block's peaks
+ */
+using GroupKernelFn = void (*)(
+    GroupBank& bank,
+    float* block,
+    uint32_t num_frames,
+    float* peaks
+);
+
+} // namespace radioform
+
+#endif // RADIOFORM_ENGINE_GROUP_H
@@ -0,0 +1,76 @@
+/**
+ * @file fast_math.h
+ * @brief Vector sin/cos and exp2 with bounded error, for coefficient design
+ *
+ * Polynomials (Cephes single-precision minimax) on a reduced range:
+ *   sincos  absolute error below 1.5e-7 for |x| up to a few thousand
+ *           (range reduced to [-pi/4, pi/4] with a three-part pi/2)
+ *   exp2    relative error below 1.5e-7 for |x| <= 126
+ *
+ * The range reductions rely on exact rounding order; this header is only
+ * included from translation units built with -fno-associative-math.
+ */
+
+#ifndef RADIOFORM_FAST_MATH_H
+#define RADIOFORM_FAST_MATH_H
+
+#include "simd.h"
+
+namespace radioform {
+namespace fast_math {
+
+using simd::f32x4;
+
+/**
+ * @brief sin(x) and cos(x) in each lane
+ */
+inline void sincos(f32x4 x, f32x4& sin_x, f32x4& cos_x) {
+    using namespace simd;
+
+    // x = j * pi/2 + r, |r| <= pi/4
+    const f32x4 j = round_nearest(x * set1(0.63661977236758134f));
+    f32x4 r = x - j * set1(1.5703125f);
+    r = r - j * set1(4.837512969970703125e-4f);
+    r = r - j * set1(7.54978995489188216e-8f);
+
+    const f32x4 r2 = r * r;
+    f32x4 s = mul_add(set1(-1.9515295891e-4f), r2, set1(8.3321608736e-3f));
+    s = mul_add(s, r2, set1(-1.6666654611e-1f));
+    s = mul_add(s * r2, r, r);
+    f32x4 c = mul_add(set1(2.443315711809948e-5f), r2, set1(-1.388731625493765e-3f));
+    c = mul_add(c, r2, set1(4.166664568298827e-2f));
+    c = mul_add(c * r2, r2, set1(1.0f) - set1(0.5f) * r2);
+
+    // Quadrant q = j mod 4:  sin = s, c, -s, -c   cos = c, -s, -c, s
+    const f32x4 q = j - set1(4.0f) * round_nearest((j - set1(1.5f)) * set1(0.25f));
+    const m32x4 swap = cmp_le(abs(abs(q - set1(2.0f)) - set1(1.0f)), set1(0.5f));
+    const m32x4 sin_negative = cmp_gt(q, set1(1.5f));
+    const m32x4 cos_negative = cmp_le(abs(q - set1(1.5f)), set1(1.0f));
+    const f32x4 sin_mag = select(swap, c, s);
+    const f32x4 cos_mag = select(swap, s, c);
+    sin_x = select(sin_negative, zero() - sin_mag, sin_mag);
+    cos_x = select(cos_negative, zero() - cos_mag, cos_mag);
+}
+
+/**
+ * @brief 2^x in each lane
+ */
+inline f32x4 exp2(f32x4 x) {
+    using namespace simd;
+
+    // x = n + f, |f| <= 1/2
+    const f32x4 n = round_nearest(x);
+    const f32x4 f = x - n;
+    f32x4 p = mul_add(set1(1.535336188319500e-4f), f, set1(1.339887440266574e-3f));
+    p = mul_add(p, f, set1(9.618437357674640e-3f));
+    p = mul_add(p, f, set1(5.550332471162809e-2f));
+    p = mul_add(p, f, set1(2.402264791363012e-1f));
+    p = mul_add(p, f, set1(6.931472028550421e-1f));
+    p = mul_add(p, f, set1(1.0f));
+    return p * pow2i(n);
+}
+
+} // namespace fast_math
+} // namespace radioform
+
+#endif // RADIOFORM_FAST_MATH_H
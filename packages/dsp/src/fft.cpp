@@ -0,0 +1,130 @@
+/**
+ * @file fft.cpp
+ * @brief Split-radix real FFT implementation
+ */
+
+#include "fft.h"
+#include "simd.h"
+
+#include <cmath>
+
+namespace radioform {
+
+bool RealFFT::init(uint32_t size) {
+    if (size < kMinSize || size > kMaxSize || (size & (size - 1)) != 0) {
+        return false;
+    }
+    size_ = size;
+
+    const double pi = 3.14159265358979323846;
+    for (uint32_t n = 4; n <= size / 2; n *= 2) {
+        const uint32_t base = n / 4 - 1;
+        for (uint32_t k = 0; k < n / 4; k++) {
+            const double angle = -2.0 * pi * static_cast<double>(k) / static_cast<double>(n);
+            w1_re_[base + k] = static_cast<float>(std::cos(angle));
+            w1_im_[base + k] = static_cast<float>(std::sin(angle));
+            w3_re_[base + k] = static_cast<float>(std::cos(3.0 * angle));
+            w3_im_[base + k] = static_cast<float>(std::sin(3.0 * angle));
+        }
+    }
+    for (uint32_t k = 0; k < size / 2; k++) {
+        const double angle = -2.0 * pi * static_cast<double>(k) / static_cast<double>(size);
+        split_re_[k] = static_cast<float>(std::cos(angle));
+        split_im_[k] = static_cast<float>(std::sin(angle));
+    }
+    return true;
+}
+
+void RealFFT::transform(const float* in_re, const float* in_im, uint32_t stride,
+                        float* re, float* im, uint32_t n) const {
+    if (n == 1) {
+        re[0] = in_re[0];
+        im[0] = in_im[0];
+        return;
+    }
+    if (n == 2) {
+        re[0] = in_re[0] + in_re[stride];
+        im[0] = in_im[0] + in_im[stride];
+        re[1] = in_re[0] - in_re[stride];
+        im[1] = in_im[0] - in_im[stride];
+        return;
+    }
+
+    // E (even samples) to [0, n/2), U (4k+1) to [n/2, 3n/4), Z (4k+3) to [3n/4, n)
+    const uint32_t h = n / 2;
+    const uint32_t q = n / 4;
+    transform(in_re, in_im, 2 * stride, re, im, h);
+    transform(in_re + stride, in_im + stride, 4 * stride, re + h, im + h, q);
+    transform(in_re + 3 * stride, in_im + 3 * stride, 4 * stride, re + h + q, im + h + q, q);
+
+    // With a = w^k U[k], b = w^3k Z[k], s = a + b, d = a - b:
+    //   X[k] = E[k] + s           X[k + n/2] = E[k] - s
+    //   X[k + n/4] = E[k + n/4] - i d    X[k + 3n/4] = E[k + n/4] + i d
+    const float* w1r = w1_re_ + q - 1;
+    const float* w1i = w1_im_ + q - 1;
+    const float* w3r = w3_re_ + q - 1;
+    const float* w3i = w3_im_ + q - 1;
+    uint32_t k = 0;
+    {
+        using namespace simd;
+        for (; k + 4 <= q; k += 4) {
+            const f32x4 ur = load(re + h + k), ui = load(im + h + k);
+            const f32x4 zr = load(re + h + q + k), zi = load(im + h + q + k);
+            const f32x4 c1 = load(w1r + k), s1 = load(w1i + k);
+            const f32x4 c3 = load(w3r + k), s3 = load(w3i + k);
+            const f32x4 ar = c1 * ur - s1 * ui, ai = c1 * ui + s1 * ur;
+            const f32x4 br = c3 * zr - s3 * zi, bi = c3 * zi + s3 * zr;
+            const f32x4 sr = ar + br, si = ai + bi;
+            const f32x4 dr = ar - br, di = ai - bi;
+            const f32x4 e0r = load(re + k), e0i = load(im + k);
+            const f32x4 e1r = load(re + q + k), e1i = load(im + q + k);
+            store(re + k, e0r + sr);
+            store(im + k, e0i + si);
+            store(re + h + k, e0r - sr);
+            store(im + h + k, e0i - si);
+            store(re + q + k, e1r + di);
+            store(im + q + k, e1i - dr);
+            store(re + h + q + k, e1r - di);
+            store(im + h + q + k, e1i + dr);
+        }
+    }
+    for (; k < q; k++) {
+        const float ur = re[h + k], ui = im[h + k];
+        const float zr = re[h + q + k], zi = im[h + q + k];
+        const float ar = w1r[k] * ur - w1i[k] * ui, ai = w1r[k] * ui + w1i[k] * ur;
+        const float br = w3r[k] * zr - w3i[k] * zi, bi = w3r[k] * zi + w3i[k] * zr;
+        const float sr = ar + br, si = ai + bi;
+        const float dr = ar - br, di = ai - bi;
+        const float e0r = re[k], e0i = im[k];
+        const float e1r = re[q + k], e1i = im[q + k];
+        re[k] = e0r + sr;
+        im[k] = e0i + si;
+        re[h + k] = e0r - sr;
+        im[h + k] = e0i - si;
+        re[q + k] = e1r + di;
+        im[q + k] = e1i - dr;
+        re[h + q + k] = e1r - di;
+        im[h + q + k] = e1i + dr;
+    }
+}
+
+void RealFFT::powerSpectrum(const float* input, float* power) {
+    const uint32_t m = size_ / 2;
+    transform(input, input + 1, 2, re_, im_, m);
+
+    // Z = FFT(x[2j] + i x[2j+1]): the even-sample spectrum is
+    // (Z[k] + conj Z[m-k]) / 2, the odd one (Z[k] - conj Z[m-k]) / 2i
+    power[0] = (re_[0] + im_[0]) * (re_[0] + im_[0]);
+    power[m] = (re_[0] - im_[0]) * (re_[0] - im_[0]);
+    for (uint32_t k = 1; k < m; k++) {
+        const float zr = re_[k], zi = im_[k];
+        const float cr = re_[m - k], ci = -im_[m - k];
+        const float er = 0.5f * (zr + cr), ei = 0.5f * (zi + ci);
+        const float or_ = 0.5f * (zi - ci), oi = -0.5f * (zr - cr);
+        const float xr = er + split_re_[k] * or_ - split_im_[k] * oi;
+        const float xi = ei + split_re_[k] * oi + split_im_[k] * or_;
+        power[k] = xr * xr + xi * xi;
+    }
+}
+
+} // namespace radioform
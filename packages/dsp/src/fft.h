@@ -0,0 +1,73 @@
+/**
+ * @file fft.h
+ * @brief Split-radix real FFT (spectrum analysis, not realtime)
+ *
+ * A real transform of N samples runs as a complex transform of N/2 points
+ * (even samples as the real part, odd as the imaginary part) followed by
+ * the usual split into the two half spectra. The complex transform is the
+ * recursive split-radix decomposition: one half-length transform of the
+ * even samples and two quarter-length transforms of the samples at 4k+1
+ * and 4k+3, combined in place. Data is split-complex (separate real and
+ * imaginary arrays), so the combining butterflies run four k per vector.
+ *
+ * Twiddles are tabulated per transform length, contiguous in k. No
+ * allocation.
+ */
+
+#ifndef RADIOFORM_FFT_H
+#define RADIOFORM_FFT_H
+
+#include <cstdint>
+
+namespace radioform {
+
+class RealFFT {
+public:
+    static constexpr uint32_t kMinSize = 16;
+    static constexpr uint32_t kMaxSize = 8192;
+
+    /**
+     * @brief Set the transform size and build the twiddle tables
+     *
+     * @param size Power of two, kMinSize to kMaxSize
+     * @return false (and no change) if size is not supported
+     */
+    bool init(uint32_t size);
+
+    uint32_t size() const { return size_; }
+
+    /**
+     * @brief Squared magnitude of bins 0..size()/2 of size() real samples
+     *
+     * @param power size() / 2 + 1 values
+     */
+    void powerSpectrum(const float* input, float* power);
+
+private:
+    static constexpr uint32_t kMaxComplex = kMaxSize / 2;
+
+    // Complex transform of n points: input element m is in_re[m * stride],
+    // in_im[m * stride]; output is contiguous
+    void transform(const float* in_re, const float* in_im, uint32_t stride,
+                   float* re, float* im, uint32_t n) const;
+
+    uint32_t size_ = 0;
+
+    // For complex length n >= 4, w^k and w^3k (w = exp(-2 pi i / n)) for
+    // k < n / 4, starting at n / 4 - 1
+    float w1_re_[kMaxComplex / 2];
+    float w1_im_[kMaxComplex / 2];
+    float w3_re_[kMaxComplex / 2];
+    float w3_im_[kMaxComplex / 2];
+
+    // exp(-2 pi i k / size) for the real split, k < size / 2
+    float split_re_[kMaxComplex];
+    float split_im_[kMaxComplex];
+
+    float re_[kMaxComplex];
+    float im_[kMaxComplex];
+};
+
+} // namespace radioform
+
+#endif // RADIOFORM_FFT_H
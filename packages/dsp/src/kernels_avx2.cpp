@@ -0,0 +1,46 @@
+/**
+ * @file kernels_avx2.cpp
+ * @brief AVX2/FMA kernels (x86, selected at runtime)
+ *
+ * Only the code between the target push/pop is compiled for AVX2. Every
+ * header is included before it, so no inline function shared with the rest
+ * of the library (or the standard library) gets an AVX2 body. The kernel
+ * table is constant-initialized: nothing here runs before the dispatcher
+ * has checked the CPU.
+ */
+
+#include "dispatch.h"
+
+#if RADIOFORM_HAVE_AVX2_KERNELS
+
+#include <immintrin.h>
+#include <algorithm>
+#include <array>
+#include <cfloat>
+#include <cmath>
+#include <cstdint>
+#include <utility>
+
+#if defined(__clang__)
+    #pragma clang attribute push(__attribute__((target("avx2,fma"))), apply_to = function)
+#else
+    #pragma GCC push_options
+    #pragma GCC target("avx2,fma")
+#endif
+
+#include "simd_avx2.h"
+
+#define RADIOFORM_KERNEL_NAMESPACE avx2
+#define RADIOFORM_KERNEL_SIMD ::radioform::simd_avx2
+#define RADIOFORM_KERNEL_NAME "avx2+fma"
+#define RADIOFORM_KERNEL_FEATURES (RADIOFORM_CPU_AVX2 | RADIOFORM_CPU_FMA)
+
+#include "kernels_impl.h"
+
+#if defined(__clang__)
+    #pragma clang attribute pop
+#else
+    #pragma GCC pop_options
+#endif
+
+#endif // RADIOFORM_HAVE_AVX2_KERNELS
@@ -0,0 +1,24 @@
+/**
+ * @file kernels_baseline.cpp
+ * @brief Kernels for the library's build target (SSE2, NEON or scalar)
+ *
+ * Always available; the fallback when no wider kernel set is supported.
+ * Built without -fassociative-math (see CMakeLists.txt) so every kernel
+ * keeps the operation order written in kernels_impl.h and the steady-state
+ * and generic kernels agree bit for bit.
+ */
+
+#include "dispatch.h"
+#include "simd.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <utility>
+
+#define RADIOFORM_KERNEL_NAMESPACE baseline
+#define RADIOFORM_KERNEL_SIMD ::radioform::simd
+#define RADIOFORM_KERNEL_NAME RADIOFORM_SIMD_NAME
+#define RADIOFORM_KERNEL_FEATURES 0u
+
+#include "kernels_impl.h"
@@ -0,0 +1,1203 @@
+/**
+ * @file kernels_impl.h
+ * @brief Vector kernels, compiled once per instruction set
+ *
+ * Not a regular header: each kernel translation unit includes it exactly
+ * once, after defining
+ *
+ *   RADIOFORM_KERNEL_NAMESPACE  namespace of this copy (baseline, avx2)
+ *   RADIOFORM_KERNEL_SIMD       SIMD wrapper namespace (simd.h or simd_avx2.h)
+ *   RADIOFORM_KERNEL_NAME       kernel set name reported by the diagnostics
+ *   RADIOFORM_KERNEL_FEATURES   radioform_cpu_feature_t bits the copy needs
+ *
+ * and after including dispatch.h and the standard headers below itself.
+ * This file includes nothing, so no shared inline function is ever compiled
+ * with a copy's target flags. Everything but the exported kKernelTable has
+ * internal linkage.
+ *
+ * The stereo kernels keep L/R in lanes 0/1 of a 4-lane vector (see
+ * stereo_kernel.h). The planar kernels and the parallel EQ sections use the
+ * native width (simd::vec, simd::kWidth), and so do the multichannel
+ * kernel (the channels of one frame across its lanes) and the group kernel
+ * (one engine per lane).
+ *
+ * Required before inclusion: dispatch.h, <algorithm>, <array>, <cmath>,
+ * <utility>.
+ */
+
+#if !defined(RADIOFORM_KERNEL_NAMESPACE) || !defined(RADIOFORM_KERNEL_SIMD) || \
+    !defined(RADIOFORM_KERNEL_NAME) || !defined(RADIOFORM_KERNEL_FEATURES)
+    #error "kernels_impl.h must be included from a kernel translation unit"
+#endif
+
+namespace radioform {
+namespace RADIOFORM_KERNEL_NAMESPACE {
+
+namespace simd = RADIOFORM_KERNEL_SIMD;
+
+namespace {
+
+// ============================================================================
+// Shared stages
+// ============================================================================
+
+/**
+ * @brief Limiter parameters held in vector registers
+ */
+template <typename V>
+struct LimiterLanes {
+    V knee, range, one, zero;
+};
+
+/**
+ * @brief Soft limiter on all lanes (mirrors SoftLimiter::processSample)
+ *
+ * Branch-free: the curve is always evaluated and blended in above the knee.
+ */
+template <typename V>
+inline V process_limiter(V x, const LimiterLanes<V>& l) {
+    using namespace simd;
+
+    const V abs_x = abs(x);
+    const V scaled = max(abs_x - l.knee, l.zero) / l.range;
+    const V limited = l.knee + l.range * (scaled / (l.one + scaled));
+    const V shaped = select(cmp_gt(abs_x, l.knee), copysign(limited, x), x);
+
+    // Silence NaN/Inf rather than propagate
+    return select(is_finite(x), shaped, l.zero);
+}
+
+// ============================================================================
+// Interleaved stereo: cascade sections
+// ============================================================================
+
+/**
+ * @brief One biquad section held in vector registers for the duration of a call
+ */
+struct StereoSectionLanes {
+    simd::f32x4 b0, b1, b2, a1, a2;
+    simd::f32x4 z1, z2;
+};
+
+inline void load_section(StereoSectionLanes& lanes, const BiquadBank& bank, uint32_t k) {
+    lanes.b0 = simd::set1(bank.b0_[k]);
+    lanes.b1 = simd::set1(bank.b1_[k]);
+    lanes.b2 = simd::set1(bank.b2_[k]);
+    lanes.a1 = simd::set1(bank.a1_[k]);
+    lanes.a2 = simd::set1(bank.a2_[k]);
+    lanes.z1 = simd::set(bank.z1_[0][k], bank.z1_[1][k], 0.0f, 0.0f);
+    lanes.z2 = simd::set(bank.z2_[0][k], bank.z2_[1][k], 0.0f, 0.0f);
+}
+
+inline void store_section(const StereoSectionLanes& lanes, BiquadBank& bank, uint32_t k) {
+    bank.z1_[0][k] = simd::lane(lanes.z1, 0);
+    bank.z1_[1][k] = simd::lane(lanes.z1, 1);
+    bank.z2_[0][k] = simd::lane(lanes.z2, 0);
+    bank.z2_[1][k] = simd::lane(lanes.z2, 1);
+}
+
+/**
+ * @brief Direct Form 2 Transposed on both channels at once
+ *
+ * Same arithmetic as Biquad::processSampleMono. Non-finite results are
+ * handled once per frame by recover_cascade().
+ */
+inline simd::f32x4 process_section(StereoSectionLanes& lanes, simd::f32x4 x) {
+    const simd::f32x4 y = simd::mul_add(lanes.b0, x, lanes.z1);
+    lanes.z1 = (lanes.b1 * x - lanes.a1 * y) + lanes.z2;
+    lanes.z2 = lanes.b2 * x - lanes.a2 * y;
+    return y;
+}
+
+/**
+ * @brief Recover from NaN/Inf in the cascade output (cold path)
+ *
+ * Clears the filter history of the affected channel and passes the
+ * pre-EQ input through, or silence if the input itself was not finite,
+ * so nothing non-finite reaches the DC blocker state.
+ */
+#if defined(__GNUC__) || defined(__clang__)
+__attribute__((noinline, cold))
+#endif
+simd::f32x4 recover_cascade(
+    StereoSectionLanes* sections, uint32_t num_sections,
+    simd::f32x4 y, simd::f32x4 input
+) {
+    using namespace simd;
+
+    const m32x4 finite = is_finite(y);
+    for (uint32_t b = 0; b < num_sections; b++) {
+        sections[b].z1 = select(finite, sections[b].z1, zero());
+        sections[b].z2 = select(finite, sections[b].z2, zero());
+    }
+    const f32x4 safe_input = select(is_finite(input), input, zero());
+    return select(finite, y, safe_input);
+}
+
+// ============================================================================
+// Interleaved stereo: DC blocker and limiter
+// ============================================================================
+
+/**
+ * @brief DC blocker and limiter state shared by both kernel flavours
+ */
+struct StereoTailLanes {
+    simd::f32x4 dc_coeff, dc_x, dc_y;
+    LimiterLanes<simd::f32x4> limiter;
+};
+
+inline void load_tail(StereoTailLanes& tail, const StereoChain& chain) {
+    DCBlocker& dc_left = chain.dc_blocker->left();
+    DCBlocker& dc_right = chain.dc_blocker->right();
+    tail.dc_coeff = simd::set(dc_left.coefficient(), dc_right.coefficient(), 0.0f, 0.0f);
+    tail.dc_x = simd::set(dc_left.inputState(), dc_right.inputState(), 0.0f, 0.0f);
+    tail.dc_y = simd::set(dc_left.outputState(), dc_right.outputState(), 0.0f, 0.0f);
+
+    const float knee = chain.limiter ? chain.limiter->kneeStart() : 0.0f;
+    const float threshold = chain.limiter ? chain.limiter->threshold() : 1.0f;
+    tail.limiter.knee = simd::set1(knee);
+    tail.limiter.range = simd::set1(threshold - knee);
+    tail.limiter.one = simd::set1(1.0f);
+    tail.limiter.zero = simd::zero();
+}
+
+inline void store_tail(const StereoTailLanes& tail, const StereoChain& chain) {
+    DCBlocker& dc_left = chain.dc_blocker->left();
+    DCBlocker& dc_right = chain.dc_blocker->right();
+    dc_left.inputState() = simd::lane(tail.dc_x, 0);
+    dc_right.inputState() = simd::lane(tail.dc_x, 1);
+    dc_left.outputState() = simd::lane(tail.dc_y, 0);
+    dc_right.outputState() = simd::lane(tail.dc_y, 1);
+}
+
+/**
+ * @brief One-pole DC blocker: y[n] = x[n] - x[n-1] + coeff * y[n-1]
+ */
+inline simd::f32x4 process_dc(StereoTailLanes& tail, simd::f32x4 x) {
+    const simd::f32x4 y = (x - tail.dc_x) + tail.dc_coeff * tail.dc_y;
+    tail.dc_x = x;
+    tail.dc_y = y;
+    return y;
+}
+
+// ============================================================================
+// Parallel-form sections (native width)
+// ============================================================================
+
+constexpr uint32_t kMaxParallelGroups = ParallelEQ::kLanes / simd::kWidth;
+
+/**
+ * @brief Parallel sections held in vector registers for the duration of a call
+ */
+struct ParallelLanes {
+    simd::vec c0[kMaxParallelGroups];
+    simd::vec c1[kMaxParallelGroups];
+    simd::vec a1[kMaxParallelGroups];
+    simd::vec a2[kMaxParallelGroups];
+    simd::vec s1[kMaxParallelGroups];
+    simd::vec s2[kMaxParallelGroups];
+    simd::f32x4 direct;
+};
+
+inline void load_parallel(ParallelLanes& lanes, const ParallelEQ& eq, uint32_t num_groups) {
+    for (uint32_t g = 0; g < num_groups; g++) {
+        const uint32_t offset = g * simd::kWidth;
+        lanes.c0[g] = simd::vload(eq.c0_ + offset);
+        lanes.c1[g] = simd::vload(eq.c1_ + offset);
+        lanes.a1[g] = simd::vload(eq.a1_ + offset);
+        lanes.a2[g] = simd::vload(eq.a2_ + offset);
+        lanes.s1[g] = simd::vload(eq.s1_ + offset);
+        lanes.s2[g] = simd::vload(eq.s2_ + offset);
+    }
+    lanes.direct = simd::set1(eq.direct_);
+}
+
+inline void store_parallel(const ParallelLanes& lanes, ParallelEQ& eq, uint32_t num_groups) {
+    for (uint32_t g = 0; g < num_groups; g++) {
+        simd::store(eq.s1_ + g * simd::kWidth, lanes.s1[g]);
+        simd::store(eq.s2_ + g * simd::kWidth, lanes.s2[g]);
+    }
+}
+
+/**
+ * @brief Run all sections on one stereo frame
+ *
+ * @param x Frame in lanes 0/1 ([L, R, 0, 0])
+ * @return Filtered frame in lanes 0/1, lanes 2/3 zero
+ *
+ * Each section is a TDF2 biquad with b2 = 0. s2 holds a2 * y so the update
+ * needs no negation: s1 = (c1 x - a1 y) - s2.
+ */
+inline simd::f32x4 process_parallel(ParallelLanes& lanes, uint32_t num_groups, simd::f32x4 x) {
+    using namespace simd;
+
+    const vec xx = widen_pair(x);
+    vec acc = vzero();
+    for (uint32_t g = 0; g < num_groups; g++) {
+        const vec y = mul_add(lanes.c0[g], xx, lanes.s1[g]);
+        lanes.s1[g] = (lanes.c1[g] * xx - lanes.a1[g] * y) - lanes.s2[g];
+        lanes.s2[g] = lanes.a2[g] * y;
+        acc = acc + y;
+    }
+    return narrow_pairs(acc) + lanes.direct * x;
+}
+
+/**
+ * @brief Recover from NaN/Inf in the parallel output (cold path)
+ *
+ * Same policy as recover_cascade(): clear the affected channel's state and
+ * pass the finite pre-EQ input through.
+ */
+#if defined(__GNUC__) || defined(__clang__)
+__attribute__((noinline, cold))
+#endif
+simd::f32x4 recover_parallel(
+    ParallelLanes& lanes, uint32_t num_groups,
+    simd::f32x4 y, simd::f32x4 input
+) {
+    using namespace simd;
+
+    const m32x4 finite = is_finite(y);
+    const auto finite_lanes = is_finite(widen_pair(y));
+    for (uint32_t g = 0; g < num_groups; g++) {
+        lanes.s1[g] = select(finite_lanes, lanes.s1[g], vzero());
+        lanes.s2[g] = select(finite_lanes, lanes.s2[g], vzero());
+    }
+    const f32x4 safe_input = select(is_finite(input), input, zero());
+    return select(finite, y, safe_input);
+}
+
+// ============================================================================
+// Interleaved stereo kernels
+// ============================================================================
+
+/**
+ * @brief Steady-state kernel: fixed coefficients, fixed preamp gain
+ *
+ * @tparam NumBands Number of enabled bands (loop is fully unrolled)
+ * @tparam Limiter Whether the limiter stage is compiled in
+ *
+ * @note REALTIME-SAFE: No allocations, state lives on the stack for the call
+ */
+template <int NumBands, bool Limiter>
+StereoPeak process_stereo_steady(
+    const StereoChain& chain,
+    const float* input,
+    float* output,
+    uint32_t num_frames
+) {
+    using namespace simd;
+
+    // Keep at least one element so the NumBands == 0 case stays valid C++
+    StereoSectionLanes sections[NumBands > 0 ? NumBands : 1];
+    BiquadBank& bank = *chain.cascade;
+    for (int b = 0; b < NumBands; b++) {
+        load_section(sections[b], bank, b);
+    }
+
+    StereoTailLanes tail;
+    load_tail(tail, chain);
+
+    const f32x4 preamp = set1(chain.preamp->getCurrent());
+    f32x4 peak = zero();
+
+    for (uint32_t i = 0; i < num_frames; i++) {
+        const f32x4 in = load2(input + i * 2) * preamp;
+
+        f32x4 x = in;
+        for (int b = 0; b < NumBands; b++) {
+            x = process_section(sections[b], x);
+        }
+        if (!all(is_finite(x))) {
+            x = recover_cascade(sections, NumBands, x, in);
+        }
+
+        x = process_dc(tail, x);
+
+        if (Limiter) {
+            x = process_limiter(x, tail.limiter);
+        }
+
+        peak = max(peak, abs(x));
+        store2(output + i * 2, x);
+    }
+
+    for (int b = 0; b < NumBands; b++) {
+        store_section(sections[b], bank, b);
+    }
+    store_tail(tail, chain);
+
+    return {lane(peak, 0), lane(peak, 1)};
+}
+
+/**
+ * @brief Generic kernel: runtime band count and preamp ramp
+ *
+ * Used only for buffers in which stereo_chain_ramping() is true.
+ *
+ * @note REALTIME-SAFE: No allocations, state lives on the stack for the call
+ */
+StereoPeak process_stereo_generic(
+    const StereoChain& chain,
+    const float* input,
+    float* output,
+    uint32_t num_frames
+) {
+    using namespace simd;
+
+    BiquadBank& bank = *chain.cascade;
+    const uint32_t num_bands = bank.numSections();
+    StereoSectionLanes sections[RADIOFORM_MAX_BANDS];
+    for (uint32_t b = 0; b < num_bands; b++) {
+        load_section(sections[b], bank, b);
+    }
+
+    StereoTailLanes tail;
+    load_tail(tail, chain);
+    const bool limiter_enabled = chain.limiter != nullptr;
+
+    // Skip smoother ticks when stable
+    ParameterSmoother& preamp = *chain.preamp;
+    const bool preamp_stable = preamp.isStable();
+    const f32x4 preamp_cached = set1(preamp.getCurrent());
+
+    f32x4 peak = zero();
+
+    for (uint32_t i = 0; i < num_frames; i++) {
+        const f32x4 in = load2(input + i * 2) *
+            (preamp_stable ? preamp_cached : set1(preamp.next()));
+
+        f32x4 x = in;
+        for (uint32_t b = 0; b < num_bands; b++) {
+            x = process_section(sections[b], x);
+        }
+        if (!all(is_finite(x))) {
+            x = recover_cascade(sections, num_bands, x, in);
+        }
+
+        x = process_dc(tail, x);
+
+        if (limiter_enabled) {
+            x = process_limiter(x, tail.limiter);
+        }
+
+        peak = max(peak, abs(x));
+        store2(output + i * 2, x);
+    }
+
+    for (uint32_t b = 0; b < num_bands; b++) {
+        store_section(sections[b], bank, b);
+    }
+    store_tail(tail, chain);
+
+    return {lane(peak, 0), lane(peak, 1)};
+}
+
+/**
+ * @brief Steady-state parallel-form kernel
+ *
+ * @tparam NumGroups Number of section registers (ParallelEQ::numGroups())
+ * @tparam Limiter Whether the limiter stage is compiled in
+ *
+ * @note REALTIME-SAFE: No allocations, state lives on the stack for the call
+ */
+template <int NumGroups, bool Limiter>
+StereoPeak process_stereo_parallel_steady(
+    const StereoChain& chain,
+    const float* input,
+    float* output,
+    uint32_t num_frames
+) {
+    using namespace simd;
+
+    ParallelEQ& eq = *chain.parallel;
+    ParallelLanes lanes;
+    load_parallel(lanes, eq, NumGroups);
+
+    StereoTailLanes tail;
+    load_tail(tail, chain);
+
+    const f32x4 preamp = set1(chain.preamp->getCurrent());
+    f32x4 peak = zero();
+
+    for (uint32_t i = 0; i < num_frames; i++) {
+        const f32x4 in = load2(input + i * 2) * preamp;
+
+        f32x4 x = process_parallel(lanes, NumGroups, in);
+        if (!all(is_finite(x))) {
+            x = recover_parallel(lanes, NumGroups, x, in);
+        }
+
+        x = process_dc(tail, x);
+
+        if (Limiter) {
+            x = process_limiter(x, tail.limiter);
+        }
+
+        peak = max(peak, abs(x));
+        store2(output + i * 2, x);
+    }
+
+    store_parallel(lanes, eq, NumGroups);
+    store_tail(tail, chain);
+
+    return {lane(peak, 0), lane(peak, 1)};
+}
+
+/**
+ * @brief Generic parallel-form kernel (counterpart of process_stereo_generic)
+ *
+ * @note REALTIME-SAFE: No allocations, state lives on the stack for the call
+ */
+StereoPeak process_stereo_parallel_generic(
+    const StereoChain& chain,
+    const float* input,
+    float* output,
+    uint32_t num_frames
+) {
+    using namespace simd;
+
+    ParallelEQ& eq = *chain.parallel;
+    const uint32_t num_groups = eq.numGroups(kWidth);
+    ParallelLanes lanes;
+    load_parallel(lanes, eq, num_groups);
+
+    StereoTailLanes tail;
+    load_tail(tail, chain);
+    const bool limiter_enabled = chain.limiter != nullptr;
+
+    // Skip smoother ticks when stable
+    ParameterSmoother& preamp = *chain.preamp;
+    const bool preamp_stable = preamp.isStable();
+    const f32x4 preamp_cached = set1(preamp.getCurrent());
+
+    f32x4 peak = zero();
+
+    for (uint32_t i = 0; i < num_frames; i++) {
+        const f32x4 in = load2(input + i * 2) *
+            (preamp_stable ? preamp_cached : set1(preamp.next()));
+
+        f32x4 x = process_parallel(lanes, num_groups, in);
+        if (!all(is_finite(x))) {
+            x = recover_parallel(lanes, num_groups, x, in);
+        }
+
+        x = process_dc(tail, x);
+
+        if (limiter_enabled) {
+            x = process_limiter(x, tail.limiter);
+        }
+
+        peak = max(peak, abs(x));
+        store2(output + i * 2, x);
+    }
+
+    store_parallel(lanes, eq, num_groups);
+    store_tail(tail, chain);
+
+    return {lane(peak, 0), lane(peak, 1)};
+}
+
+template <size_t... NumBands>
+constexpr auto make_kernel_row(bool limiter, std::index_sequence<NumBands...>) {
+    using Row = std::array<StereoKernelFn, sizeof...(NumBands)>;
+    return limiter
+        ? Row{{&process_stereo_steady<static_cast<int>(NumBands), true>...}}
+        : Row{{&process_stereo_steady<static_cast<int>(NumBands), false>...}};
+}
+
+template <size_t... NumGroups>
+constexpr auto make_parallel_kernel_row(bool limiter, std::index_sequence<NumGroups...>) {
+    using Row = std::array<StereoKernelFn, sizeof...(NumGroups)>;
+    return limiter
+        ? Row{{&process_stereo_parallel_steady<static_cast<int>(NumGroups), true>...}}
+        : Row{{&process_stereo_parallel_steady<static_cast<int>(NumGroups), false>...}};
+}
+
+using BandSequence = std::make_index_sequence<RADIOFORM_MAX_BANDS + 1>;
+using GroupSequence = std::make_index_sequence<kMaxParallelGroups + 1>;
+
+// [limiter_enabled][num_bands]; constant-initialized, so no code from this
+// copy runs before the dispatcher has checked the CPU
+constexpr std::array<StereoKernelFn, RADIOFORM_MAX_BANDS + 1> kSteadyKernels[2] = {
+    make_kernel_row(false, BandSequence{}),
+    make_kernel_row(true, BandSequence{}),
+};
+
+// [limiter_enabled][num_groups]
+constexpr std::array<StereoKernelFn, kMaxParallelGroups + 1> kParallelKernels[2] = {
+    make_parallel_kernel_row(false, GroupSequence{}),
+    make_parallel_kernel_row(true, GroupSequence{}),
+};
+
+StereoKernels select_stereo_kernels(const StereoChain& chain) {
+    const int limiter = chain.limiter ? 1 : 0;
+
+    if (chain.parallel) {
+        return {kParallelKernels[limiter][chain.parallel->numGroups(simd::kWidth)],
+                &process_stereo_parallel_generic};
+    }
+    const uint32_t num_bands = chain.cascade->numSections();
+    if (num_bands > RADIOFORM_MAX_BANDS) {
+        return {&process_stereo_generic, &process_stereo_generic};
+    }
+    return {kSteadyKernels[limiter][num_bands], &process_stereo_generic};
+}
+
+// ============================================================================
+// Planar: parallel EQ
+// ============================================================================
+
+/**
+ * @brief Parallel-form EQ over planar stereo buffers, in place
+ */
+void process_parallel_planar(ParallelEQ& eq, float* left, float* right, uint32_t num_frames) {
+    using namespace simd;
+
+    const uint32_t num_groups = eq.numGroups(kWidth);
+    ParallelLanes lanes;
+    load_parallel(lanes, eq, num_groups);
+
+    for (uint32_t i = 0; i < num_frames; i++) {
+        const f32x4 x = set(left[i], right[i], 0.0f, 0.0f);
+        f32x4 y = process_parallel(lanes, num_groups, x);
+        if (!all(is_finite(y))) {
+            y = recover_parallel(lanes, num_groups, y, x);
+        }
+        left[i] = lane(y, 0);
+        right[i] = lane(y, 1);
+    }
+
+    store_parallel(lanes, eq, num_groups);
+}
+
+// ============================================================================
+// Planar: block state-space cascade (see block_iir.h)
+// ============================================================================
+
+static_assert(BlockBiquad::kBlockSize == 4, "block kernel is written for 4-lane vectors");
+
+/**
+ * @brief Block matrices of one section held in vector registers
+ */
+struct BlockLanes {
+    simd::f32x4 from_z1, from_z2;
+    simd::f32x4 from_x[BlockBiquad::kBlockSize];
+};
+
+/**
+ * @brief Per-sample TDF2 (same arithmetic and NaN policy as BiquadBank::processSection)
+ */
+inline float process_sample(const BiquadCoeffs& c, BiquadState& state, float input) {
+    const float output = c.b0 * input + state.z1;
+    state.z1 = c.b1 * input - c.a1 * output + state.z2;
+    state.z2 = c.b2 * input - c.a2 * output;
+
+    if (!std::isfinite(output)) {
+        state.z1 = 0.0f;
+        state.z2 = 0.0f;
+        return input;
+    }
+    return output;
+}
+
+/**
+ * @brief Redo a block sample by sample after a non-finite output (cold path)
+ */
+#if defined(__GNUC__) || defined(__clang__)
+__attribute__((noinline, cold))
+#endif
+void recover_block(const BiquadCoeffs& c, BiquadState& state, float* data) {
+    for (uint32_t n = 0; n < BlockBiquad::kBlockSize; n++) {
+        data[n] = process_sample(c, state, data[n]);
+    }
+}
+
+/**
+ * @brief Filter one block of one channel in place
+ */
+inline void process_block(
+    const BlockLanes& m, const BiquadCoeffs& c, BiquadState& state, float* data
+) {
+    using namespace simd;
+
+    const float x2 = data[2];
+    const float x3 = data[3];
+
+    // Input terms do not depend on the state and overlap with the previous block
+    const f32x4 from_input = (m.from_x[0] * set1(data[0]) + m.from_x[1] * set1(data[1]))
+        + (m.from_x[2] * set1(x2) + m.from_x[3] * set1(x3));
+    const f32x4 y = from_input + (m.from_z1 * set1(state.z1) + m.from_z2 * set1(state.z2));
+
+    if (!all(is_finite(y))) {
+        recover_block(c, state, data);
+        return;
+    }
+    store(data, y);
+
+    // State after the block, rebuilt from the last two outputs as the recursion would
+    const float y2 = data[2];
+    const float y3 = data[3];
+    const float z2_prev = c.b2 * x2 - c.a2 * y2;
+    state.z1 = c.b1 * x3 - c.a1 * y3 + z2_prev;
+    state.z2 = c.b2 * x3 - c.a2 * y3;
+}
+
+/**
+ * @brief Run a cascade over planar stereo buffers in place, block by block
+ *
+ * Filter state is read from and written back to the bank, so this can be
+ * interleaved freely with BiquadBank::processSection(). sections[k] must
+ * match the bank's current coefficients for section k.
+ */
+void process_block_cascade(
+    const BlockBiquad* sections,
+    BiquadBank& bank,
+    float* left,
+    float* right,
+    uint32_t num_frames
+) {
+    const uint32_t block_frames = num_frames - num_frames % BlockBiquad::kBlockSize;
+
+    for (uint32_t k = 0; k < bank.numSections(); k++) {
+        const BlockBiquad& section = sections[k];
+        const BiquadCoeffs& c = section.coeffs();
+
+        BlockLanes m;
+        m.from_z1 = simd::load(section.from_z1);
+        m.from_z2 = simd::load(section.from_z2);
+        for (uint32_t n = 0; n < BlockBiquad::kBlockSize; n++) {
+            m.from_x[n] = simd::load(section.from_x[n]);
+        }
+
+        BiquadState state_left = bank.state(0, k);
+        BiquadState state_right = bank.state(1, k);
+
+        // Left and right are independent chains; interleaving them hides latency
+        uint32_t i = 0;
+        for (; i < block_frames; i += BlockBiquad::kBlockSize) {
+            process_block(m, c, state_left, left + i);
+            process_block(m, c, state_right, right + i);
+        }
+        for (; i < num_frames; i++) {
+            left[i] = process_sample(c, state_left, left[i]);
+            right[i] = process_sample(c, state_right, right[i]);
+        }
+
+        bank.setState(0, k, state_left);
+        bank.setState(1, k, state_right);
+    }
+}
+
+// ============================================================================
+// Planar: DC blocker
+// ============================================================================
+
+/**
+ * @brief DC blocker unrolled over 4-sample blocks
+ *
+ * With d[n] = x[n] - x[n-1], the recursion y[n] = d[n] + c y[n-1] gives
+ *
+ *   y[n+k] = sum_{j<=k} c^(k-j) d[n+j] + c^(k+1) y[n-1]
+ *
+ * so a block is four broadcasts and multiply-adds plus one serial step,
+ * the same scheme as the block biquad.
+ */
+struct DCBlockLanes {
+    simd::f32x4 from_d[4];
+    simd::f32x4 from_y;
+};
+
+inline void load_dc_block(DCBlockLanes& m, float coeff) {
+    // Powers in double so every lane is one rounding from the exact value
+    double power[5];
+    power[0] = 1.0;
+    for (int k = 1; k < 5; k++) {
+        power[k] = power[k - 1] * static_cast<double>(coeff);
+    }
+    for (int j = 0; j < 4; j++) {
+        float column[4];
+        for (int k = 0; k < 4; k++) {
+            column[k] = k >= j ? static_cast<float>(power[k - j]) : 0.0f;
+        }
+        m.from_d[j] = simd::load(column);
+    }
+    m.from_y = simd::set(static_cast<float>(power[1]), static_cast<float>(power[2]),
+                         static_cast<float>(power[3]), static_cast<float>(power[4]));
+}
+
+void process_dc_channel(DCBlocker& dc, float* data, uint32_t num_frames) {
+    using namespace simd;
+
+    DCBlockLanes m;
+    load_dc_block(m, dc.coefficient());
+
+    float x_prev = dc.inputState();
+    float y_prev = dc.outputState();
+
+    const uint32_t block_frames = num_frames - num_frames % 4;
+    uint32_t i = 0;
+    for (; i < block_frames; i += 4) {
+        const float x0 = data[i];
+        const float x1 = data[i + 1];
+        const float x2 = data[i + 2];
+        const float x3 = data[i + 3];
+
+        const f32x4 from_input = (m.from_d[0] * set1(x0 - x_prev) + m.from_d[1] * set1(x1 - x0))
+            + (m.from_d[2] * set1(x2 - x1) + m.from_d[3] * set1(x3 - x2));
+        store(data + i, mul_add(m.from_y, set1(y_prev), from_input));
+
+        x_prev = x3;
+        y_prev = data[i + 3];
+    }
+    for (; i < num_frames; i++) {
+        const float x = data[i];
+        data[i] = x - x_prev + dc.coefficient() * y_prev;
+        x_prev = x;
+        y_prev = data[i];
+    }
+
+    dc.inputState() = x_prev;
+    dc.outputState() = y_prev;
+}
+
+void process_dc_planar(StereoDCBlocker& dc, float* left, float* right, uint32_t num_frames) {
+    process_dc_channel(dc.left(), left, num_frames);
+    process_dc_channel(dc.right(), right, num_frames);
+}
+
+// ============================================================================
+// Planar: limiter and peak meter (native width)
+// ============================================================================
+
+void process_limiter_channel(const LimiterLanes<simd::vec>& l, float* data, uint32_t num_frames) {
+    using namespace simd;
+
+    uint32_t i = 0;
+    for (; i + kWidth <= num_frames; i += kWidth) {
+        store(data + i, process_limiter(vload(data + i), l));
+    }
+
+    // Tail through a padded vector so every sample sees the same arithmetic
+    if (i < num_frames) {
+        float tail[kWidth] = {};
+        const uint32_t remaining = num_frames - i;
+        for (uint32_t k = 0; k < remaining; k++) {
+            tail[k] = data[i + k];
+        }
+        store(tail, process_limiter(vload(tail), l));
+        for (uint32_t k = 0; k < remaining; k++) {
+            data[i + k] = tail[k];
+        }
+    }
+}
+
+void process_limiter_planar(
+    const SoftLimiter& limiter, float* left, float* right, uint32_t num_frames
+) {
+    LimiterLanes<simd::vec> l;
+    l.knee = simd::vset1(limiter.kneeStart());
+    l.range = simd::vset1(limiter.threshold() - limiter.kneeStart());
+    l.one = simd::vset1(1.0f);
+    l.zero = simd::vzero();
+
+    process_limiter_channel(l, left, num_frames);
+    process_limiter_channel(l, right, num_frames);
+}
+
+StereoPeak measure_peak_planar(const float* left, const float* right, uint32_t num_frames) {
+    using namespace simd;
+
+    // abs(x) first: max() returns its second operand for NaN, so NaN never wins
+    vec peak_left = vzero();
+    vec peak_right = vzero();
+    uint32_t i = 0;
+    for (; i + kWidth <= num_frames; i += kWidth) {
+        peak_left = max(abs(vload(left + i)), peak_left);
+        peak_right = max(abs(vload(right + i)), peak_right);
+    }
+
+    StereoPeak peak = {reduce_max(peak_left), reduce_max(peak_right)};
+    for (; i < num_frames; i++) {
+        peak.left = std::max(peak.left, std::abs(left[i]));
+        peak.right = std::max(peak.right, std::abs(right[i]));
+    }
+    return peak;
+}
+
+// ============================================================================
+// Multichannel: channels in lanes (native width)
+// ============================================================================
+
+// Vectors covering the channel lanes of one padded frame
+constexpr uint32_t kFrameVectors = kFrameStride / simd::kWidth;
+static_assert(kFrameStride % simd::kWidth == 0, "padded frames must be whole vectors");
+
+template <uint32_t Vectors>
+struct ChannelSectionLanes {
+    simd::vec b0, b1, b2, a1, a2;
+    simd::vec z1[Vectors], z2[Vectors];
+};
+
+template <uint32_t Vectors>
+struct ChannelSvfLanes {
+    simd::vec a1, a2, a3, m0, m1, m2;
+    simd::vec ic1[Vectors], ic2[Vectors];
+};
+
+/**
+ * @brief Gather one value per channel into lane vectors (unused lanes zero)
+ */
+template <uint32_t Vectors, typename Get>
+inline void gather_channels(simd::vec* out, uint32_t num_channels, Get get) {
+    float tmp[Vectors * simd::kWidth] = {};
+    for (uint32_t ch = 0; ch < num_channels; ch++) {
+        tmp[ch] = get(ch);
+    }
+    for (uint32_t j = 0; j < Vectors; j++) {
+        out[j] = simd::vload(tmp + j * simd::kWidth);
+    }
+}
+
+template <uint32_t Vectors, typename Set>
+inline void scatter_channels(const simd::vec* in, uint32_t num_channels, Set set) {
+    float tmp[Vectors * simd::kWidth];
+    for (uint32_t j = 0; j < Vectors; j++) {
+        simd::store(tmp + j * simd::kWidth, in[j]);
+    }
+    for (uint32_t ch = 0; ch < num_channels; ch++) {
+        set(ch, tmp[ch]);
+    }
+}
+
+/**
+ * @brief Whole chain on padded frames, Vectors native vectors per frame
+ *
+ * Same arithmetic per lane as the stereo kernels (and svf.cpp for the
+ * state-variable bands). A non-finite EQ output clears the affected
+ * channel's history in every section and passes its input through.
+ */
+template <uint32_t Vectors>
+void process_multichannel_frames(
+    const MultichannelChain& chain, float* frames, uint32_t num_frames, float* peaks
+) {
+    using namespace simd;
+    const uint32_t channels = chain.num_channels;
+    const BiquadBank& bank = *chain.cascade;
+    const uint32_t num_sections = bank.numSections();
+
+    ChannelSvfLanes<Vectors> svf[RADIOFORM_MAX_BANDS];
+    for (uint32_t s = 0; s < chain.num_svf; s++) {
+        StateVariableFilter& f = *chain.svf[s];
+        svf[s].a1 = vset1(f.gains()[0]);
+        svf[s].a2 = vset1(f.gains()[1]);
+        svf[s].a3 = vset1(f.gains()[2]);
+        svf[s].m0 = vset1(f.params().m0);
+        svf[s].m1 = vset1(f.params().m1);
+        svf[s].m2 = vset1(f.params().m2);
+        gather_channels<Vectors>(svf[s].ic1, channels, [&](uint32_t ch) { return f.state(ch).ic1; });
+        gather_channels<Vectors>(svf[s].ic2, channels, [&](uint32_t ch) { return f.state(ch).ic2; });
+    }
+
+    ChannelSectionLanes<Vectors> sections[RADIOFORM_MAX_BANDS];
+    for (uint32_t k = 0; k < num_sections; k++) {
+        sections[k].b0 = vset1(bank.b0_[k]);
+        sections[k].b1 = vset1(bank.b1_[k]);
+        sections[k].b2 = vset1(bank.b2_[k]);
+        sections[k].a1 = vset1(bank.a1_[k]);
+        sections[k].a2 = vset1(bank.a2_[k]);
+        gather_channels<Vectors>(sections[k].z1, channels, [&](uint32_t ch) { return bank.z1_[ch][k]; });
+        gather_channels<Vectors>(sections[k].z2, channels, [&](uint32_t ch) { return bank.z2_[ch][k]; });
+    }
+
+    MultichannelDCBlocker& dc = *chain.dc_blocker;
+    const vec dc_coeff = vset1(dc.channel(0).coefficient());
+    vec dc_x[Vectors], dc_y[Vectors];
+    gather_channels<Vectors>(dc_x, channels, [&](uint32_t ch) { return dc.channel(ch).inputState(); });
+    gather_channels<Vectors>(dc_y, channels, [&](uint32_t ch) { return dc.channel(ch).outputState(); });
+
+    LimiterLanes<vec> limiter;
+    const float knee = chain.limiter ? chain.limiter->kneeStart() : 0.0f;
+    limiter.knee = vset1(knee);
+    limiter.range = vset1(chain.limiter ? chain.limiter->threshold() - knee : 1.0f);
+    limiter.one = vset1(1.0f);
+    limiter.zero = vzero();
+
+    vec peak[Vectors];
+    for (uint32_t j = 0; j < Vectors; j++) {
+        peak[j] = vzero();
+    }
+
+    const vec two = vset1(2.0f);
+    const bool preamp_stable = chain.preamp->isStable();
+    const float steady_gain = chain.preamp->getCurrent();
+
+    for (uint32_t i = 0; i < num_frames; i++) {
+        float* frame = frames + i * kFrameStride;
+        const vec gain = vset1(preamp_stable ? steady_gain : chain.preamp->next());
+
+        vec x[Vectors], y[Vectors];
+        bool finite = true;
+        for (uint32_t j = 0; j < Vectors; j++) {
+            x[j] = vload(frame + j * kWidth) * gain;
+            y[j] = x[j];
+
+            for (uint32_t s = 0; s < chain.num_svf; s++) {
+                ChannelSvfLanes<Vectors>& f = svf[s];
+                const vec v3 = y[j] - f.ic2[j];
+                const vec v1 = mul_add(f.a1, f.ic1[j], f.a2 * v3);
+                const vec v2 = (f.ic2[j] + f.a2 * f.ic1[j]) + f.a3 * v3;
+                f.ic1[j] = two * v1 - f.ic1[j];
+                f.ic2[j] = two * v2 - f.ic2[j];
+                y[j] = (f.m0 * y[j] + f.m1 * v1) + f.m2 * v2;
+            }
+
+            for (uint32_t k = 0; k < num_sections; k++) {
+                ChannelSectionLanes<Vectors>& c = sections[k];
+                const vec in = y[j];
+                y[j] = mul_add(c.b0, in, c.z1[j]);
+                c.z1[j] = (c.b1 * in - c.a1 * y[j]) + c.z2[j];
+                c.z2[j] = c.b2 * in - c.a2 * y[j];
+            }
+            finite = finite && all(is_finite(y[j]));
+        }
+
+        if (!finite) {
+            // Cold path: clear the affected lanes' history, pass their input
+            for (uint32_t j = 0; j < Vectors; j++) {
+                const auto ok = is_finite(y[j]);
+                for (uint32_t s = 0; s < chain.num_svf; s++) {
+                    svf[s].ic1[j] = select(ok, svf[s].ic1[j], vzero());
+                    svf[s].ic2[j] = select(ok, svf[s].ic2[j], vzero());
+                }
+                for (uint32_t k = 0; k < num_sections; k++) {
+                    sections[k].z1[j] = select(ok, sections[k].z1[j], vzero());
+                    sections[k].z2[j] = select(ok, sections[k].z2[j], vzero());
+                }
+                y[j] = select(ok, y[j], select(is_finite(x[j]), x[j], vzero()));
+            }
+        }
+
+        for (uint32_t j = 0; j < Vectors; j++) {
+            vec out = (y[j] - dc_x[j]) + dc_coeff * dc_y[j];
+            dc_x[j] = y[j];
+            dc_y[j] = out;
+            if (chain.limiter) {
+                out = process_limiter(out, limiter);
+            }
+            peak[j] = max(abs(out), peak[j]);
+            store(frame + j * kWidth, out);
+        }
+    }
+
+    for (uint32_t s = 0; s < chain.num_svf; s++) {
+        StateVariableFilter& f = *chain.svf[s];
+        scatter_channels<Vectors>(svf[s].ic1, channels, [&](uint32_t ch, float v) { f.state(ch).ic1 = v; });
+        scatter_channels<Vectors>(svf[s].ic2, channels, [&](uint32_t ch, float v) { f.state(ch).ic2 = v; });
+    }
+    BiquadBank& out_bank = *chain.cascade;
+    for (uint32_t k = 0; k < num_sections; k++) {
+        scatter_channels<Vectors>(sections[k].z1, channels, [&](uint32_t ch, float v) { out_bank.z1_[ch][k] = v; });
+        scatter_channels<Vectors>(sections[k].z2, channels, [&](uint32_t ch, float v) { out_bank.z2_[ch][k] = v; });
+    }
+    scatter_channels<Vectors>(dc_x, channels, [&](uint32_t ch, float v) { dc.channel(ch).inputState() = v; });
+    scatter_channels<Vectors>(dc_y, channels, [&](uint32_t ch, float v) { dc.channel(ch).outputState() = v; });
+    scatter_channels<Vectors>(peak, channels, [&](uint32_t ch, float v) { peaks[ch] = std::max(peaks[ch], v); });
+}
+
+void process_multichannel(
+    const MultichannelChain& chain, float* frames, uint32_t num_frames, float* peaks
+) {
+    // Only as many vectors as the channels need (one for quad and below)
+    if (chain.num_channels <= simd::kWidth) {
+        process_multichannel_frames<1>(chain, frames, num_frames, peaks);
+    } else {
+        process_multichannel_frames<kFrameVectors>(chain, frames, num_frames, peaks);
+    }
+}
+
+// ============================================================================
+// Engine groups: one engine per lane (native width)
+// ============================================================================
+
+constexpr uint32_t kGroupVectors = kGroupLanes / simd::kWidth;
+static_assert(kGroupLanes % simd::kWidth == 0, "group lanes must be whole vectors");
+
+/**
+ * @brief Run Vectors vectors of lanes of a group over a transposed block
+ *
+ * Per lane, the arithmetic is that of the planar stereo path: smoothed
+ * preamp, svf.cpp's sections, TDF2 biquads, one-pole DC blocker and the
+ * soft limiter. Sections are read from and written back to the bank once
+ * per call.
+ */
+template <uint32_t Vectors>
+void process_group_lanes(GroupBank& bank, float* block, uint32_t num_frames, float* peaks) {
+    using namespace simd;
+    constexpr uint32_t W = kWidth;
+    const uint32_t num_svf = bank.num_svf;
+    const uint32_t num_sections = bank.num_sections;
+
+    for (uint32_t j = 0; j < Vectors; j++) {
+        const uint32_t lane = j * W;
+
+        // Preamp: lanes already at their target hold their gain, as in the engine
+        const vec p_coeff = vload(bank.preamp_coeff + lane);
+        const vec p_vcoeff = vload(bank.preamp_velocity_coeff + lane);
+        const vec p_target = vload(bank.preamp_target + lane);
+        vec p_current = vload(bank.preamp_current + lane);
+        vec p_velocity = vload(bank.preamp_velocity + lane);
+        const vec one = vset1(1.0f);
+        const vec half = vset1(0.5f);
+        const vec epsilon = vset1(0.0001f);
+        const auto p_stable = cmp_gt(epsilon, max(abs(p_current - p_target), abs(p_velocity)));
+        const bool any_moving = !all(p_stable);
+
+        struct SvfLanes { vec a1, a2, a3, m0, m1, m2, ic1[2], ic2[2]; };
+        struct SectionLanes { vec b0, b1, b2, a1, a2, z1[2], z2[2]; };
+        SvfLanes svf[RADIOFORM_MAX_BANDS];
+        SectionLanes sections[RADIOFORM_MAX_BANDS];
+        for (uint32_t s = 0; s < num_svf; s++) {
+            svf[s].a1 = vload(bank.svf_gain[s][0] + lane);
+            svf[s].a2 = vload(bank.svf_gain[s][1] + lane);
+            svf[s].a3 = vload(bank.svf_gain[s][2] + lane);
+            svf[s].m0 = vload(bank.svf_mix[s][0] + lane);
+            svf[s].m1 = vload(bank.svf_mix[s][1] + lane);
+            svf[s].m2 = vload(bank.svf_mix[s][2] + lane);
+            for (uint32_t ch = 0; ch < 2; ch++) {
+                svf[s].ic1[ch] = vload(bank.svf_ic1[s][ch] + lane);
+                svf[s].ic2[ch] = vload(bank.svf_ic2[s][ch] + lane);
+            }
+        }
+        for (uint32_t k = 0; k < num_sections; k++) {
+            sections[k].b0 = vload(bank.biquad[k][0] + lane);
+            sections[k].b1 = vload(bank.biquad[k][1] + lane);
+            sections[k].b2 = vload(bank.biquad[k][2] + lane);
+            sections[k].a1 = vload(bank.biquad[k][3] + lane);
+            sections[k].a2 = vload(bank.biquad[k][4] + lane);
+            for (uint32_t ch = 0; ch < 2; ch++) {
+                sections[k].z1[ch] = vload(bank.z1[k][ch] + lane);
+                sections[k].z2[ch] = vload(bank.z2[k][ch] + lane);
+            }
+        }
+
+        const vec dc_coeff = vset1(bank.dc_coeff);
+        vec dc_x[2] = {vload(bank.dc_x[0] + lane), vload(bank.dc_x[1] + lane)};
+        vec dc_y[2] = {vload(bank.dc_y[0] + lane), vload(bank.dc_y[1] + lane)};
+
+        LimiterLanes<vec> limiter;
+        limiter.knee = vload(bank.limiter_knee + lane);
+        limiter.range = vload(bank.limiter_range + lane);
+        limiter.one = one;
+        limiter.zero = vzero();
+        const auto limiter_on = cmp_gt(vload(bank.limiter_on + lane), vzero());
+
+        vec peak[2] = {vload(peaks + lane), vload(peaks + kGroupLanes + lane)};
+        const vec two = vset1(2.0f);
+
+        for (uint32_t i = 0; i < num_frames; i++) {
+            vec gain = p_current;
+            if (any_moving) {
+                // ParameterSmoother::next() on every lane, kept only where moving
+                const vec velocity = p_vcoeff * p_velocity + (one - p_vcoeff) * (p_target - p_current);
+                const vec current = p_coeff * p_current + (one - p_coeff) * (p_target - velocity * half);
+                p_velocity = select(p_stable, p_velocity, velocity);
+                p_current = select(p_stable, p_current, current);
+                gain = p_current;
+            }
+
+            for (uint32_t ch = 0; ch < 2; ch++) {
+                float* samples = block + (i * 2 + ch) * kGroupLanes + lane;
+                const vec x = vload(samples) * gain;
+                vec y = x;
+
+                for (uint32_t s = 0; s < num_svf; s++) {
+                    SvfLanes& f = svf[s];
+                    const vec v3 = y - f.ic2[ch];
+                    const vec v1 = mul_add(f.a1, f.ic1[ch], f.a2 * v3);
+                    const vec v2 = (f.ic2[ch] + f.a2 * f.ic1[ch]) + f.a3 * v3;
+                    f.ic1[ch] = two * v1 - f.ic1[ch];
+                    f.ic2[ch] = two * v2 - f.ic2[ch];
+                    y = (f.m0 * y + f.m1 * v1) + f.m2 * v2;
+                }
+                for (uint32_t k = 0; k < num_sections; k++) {
+                    SectionLanes& c = sections[k];
+                    const vec in = y;
+                    y = mul_add(c.b0, in, c.z1[ch]);
+                    c.z1[ch] = (c.b1 * in - c.a1 * y) + c.z2[ch];
+                    c.z2[ch] = c.b2 * in - c.a2 * y;
+                }
+
+                const auto finite = is_finite(y);
+                if (!all(finite)) {
+                    // Cold path: clear the affected lanes' history, pass their input
+                    for (uint32_t s = 0; s < num_svf; s++) {
+                        svf[s].ic1[ch] = select(finite, svf[s].ic1[ch], vzero());
+                        svf[s].ic2[ch] = select(finite, svf[s].ic2[ch], vzero());
+                    }
+                    for (uint32_t k = 0; k < num_sections; k++) {
+                        sections[k].z1[ch] = select(finite, sections[k].z1[ch], vzero());
+                        sections[k].z2[ch] = select(finite, sections[k].z2[ch], vzero());
+                    }
+                    y = select(finite, y, select(is_finite(x), x, vzero()));
+                }
+
+                vec out = (y - dc_x[ch]) + dc_coeff * dc_y[ch];
+                dc_x[ch] = y;
+                dc_y[ch] = out;
+                out = select(limiter_on, process_limiter(out, limiter), out);
+                peak[ch] = max(abs(out), peak[ch]);
+                store(samples, out);
+            }
+        }
+
+        store(bank.preamp_current + lane, p_current);
+        store(bank.preamp_velocity + lane, p_velocity);
+        for (uint32_t s = 0; s < num_svf; s++) {
+            for (uint32_t ch = 0; ch < 2; ch++) {
+                store(bank.svf_ic1[s][ch] + lane, svf[s].ic1[ch]);
+                store(bank.svf_ic2[s][ch] + lane, svf[s].ic2[ch]);
+            }
+        }
+        for (uint32_t k = 0; k < num_sections; k++) {
+            for (uint32_t ch = 0; ch < 2; ch++) {
+                store(bank.z1[k][ch] + lane, sections[k].z1[ch]);
+                store(bank.z2[k][ch] + lane, sections[k].z2[ch]);
+            }
+        }
+        for (uint32_t ch = 0; ch < 2; ch++) {
+            store(bank.dc_x[ch] + lane, dc_x[ch]);
+            store(bank.dc_y[ch] + lane, dc_y[ch]);
+            store(peaks + ch * kGroupLanes + lane, peak[ch]);
+        }
+    }
+}
+
+void process_group(GroupBank& bank, float* block, uint32_t num_frames, float* peaks) {
+    // Only the vectors holding engines (one for up to kWidth engines)
+    if (bank.num_engines <= simd::kWidth) {
+        process_group_lanes<1>(bank, block, num_frames, peaks);
+    } else {
+        process_group_lanes<kGroupVectors>(bank, block, num_frames, peaks);
+    }
+}
+
+} // namespace
+
+extern const KernelTable kKernelTable;
+const KernelTable kKernelTable = {
+    RADIOFORM_KERNEL_NAME,
+    simd::kWidth,
+    RADIOFORM_KERNEL_FEATURES,
+    &select_stereo_kernels,
+    &process_parallel_planar,
+    &process_block_cascade,
+    &process_dc_planar,
+    &process_limiter_planar,
+    &measure_peak_planar,
+    &process_multichannel,
+    &process_group,
+};
+
+} // namespace RADIOFORM_KERNEL_NAMESPACE
+} // namespace radioform
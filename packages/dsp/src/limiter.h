@@ -89,6 +89,12 @@ public:
         }
     }
 
+    /**
+     * @brief Linear threshold and knee start (for vectorized kernels)
+     */
+    float threshold() const { return threshold_; }
+    float kneeStart() const { return knee_start_; }
+
 private:
     float threshold_ = 0.99f;    // ~-0.1 dB
     float knee_start_ = 0.792f;  // 80% of threshold
@@ -0,0 +1,153 @@
+/**
+ * @file lookahead_limiter.cpp
+ * @brief Lookahead limiter implementation
+ */
+
+#include "lookahead_limiter.h"
+#include "simd.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace radioform {
+
+void LookaheadLimiter::init(uint32_t num_channels) {
+    num_channels_ = std::min<uint32_t>(std::max<uint32_t>(num_channels, 1), RADIOFORM_MAX_CHANNELS);
+    reset();
+}
+
+void LookaheadLimiter::configure(uint32_t lookahead_frames, float release_frames, float threshold_db) {
+    threshold_ = std::pow(10.0f, threshold_db / 20.0f);
+    release_coeff_ = std::exp(-1.0f / std::max(release_frames, 1.0f));
+
+    lookahead_frames = std::min(std::max<uint32_t>(lookahead_frames, 1), kMaxLookaheadFrames);
+    if (lookahead_frames != lookahead_) {
+        lookahead_ = lookahead_frames;
+        reset();
+    }
+}
+
+void LookaheadLimiter::reset() {
+    std::memset(history_, 0, sizeof(history_));
+    std::memset(delay_, 0, sizeof(delay_));
+    frame_ = 0;
+    deque_head_ = 0;
+    deque_tail_ = 0;
+    std::fill(hold_, hold_ + lookahead_, 1.0f);
+    hold_pos_ = 0;
+    hold_sum_ = static_cast<double>(lookahead_);
+    envelope_ = 1.0f;
+}
+
+void LookaheadLimiter::detect(uint32_t num_frames) {
+    using namespace simd;
+
+    const f32x4 threshold = set1(threshold_);
+    for (uint32_t i = 0; i < num_frames; i += 4) {
+        f32x4 peak = zero();
+        for (uint32_t ch = 0; ch < num_channels_; ch++) {
+            const float* x = history_[ch] + kTaps - 1 + i;
+            f32x4 p0 = zero(), p1 = zero(), p2 = zero(), p3 = zero();
+            for (uint32_t j = 0; j < kTaps; j++) {
+                const f32x4 xj = load(x - j);
+                p0 = mul_add(set1(kTruePeakPhases[0][j]), xj, p0);
+                p1 = mul_add(set1(kTruePeakPhases[1][j]), xj, p1);
+                p2 = mul_add(set1(kTruePeakPhases[2][j]), xj, p2);
+                p3 = mul_add(set1(kTruePeakPhases[3][j]), xj, p3);
+            }
+            const f32x4 true_peak = max(max(abs(p0), abs(p1)), max(abs(p2), abs(p3)));
+            peak = max(peak, max(true_peak, abs(load(x))));
+        }
+        store(frame_gain_ + i, threshold / max(peak, threshold));
+    }
+}
+
+void LookaheadLimiter::computeEnvelope(uint32_t num_frames) {
+    // A peak detected at frame p limits the output of frames p - kDetectorDelay
+    // to p (delayed by the latency), so each window spans one more frame
+    const uint32_t window = lookahead_ + kDetectorDelay + 1;
+    const double inv_lookahead = 1.0 / static_cast<double>(lookahead_);
+
+    for (uint32_t i = 0; i < num_frames; i++) {
+        const uint32_t frame = frame_ + i;
+        const float gain = frame_gain_[i];
+
+        while (deque_tail_ != deque_head_ && deque_gain_[(deque_tail_ - 1) & kRingMask] >= gain) {
+            deque_tail_--;
+        }
+        deque_frame_[deque_tail_ & kRingMask] = frame;
+        deque_gain_[deque_tail_ & kRingMask] = gain;
+        deque_tail_++;
+        if (frame - deque_frame_[deque_head_ & kRingMask] >= window) {
+            deque_head_++;
+        }
+        const float window_min = deque_gain_[deque_head_ & kRingMask];
+
+        hold_sum_ += static_cast<double>(window_min) - static_cast<double>(hold_[hold_pos_]);
+        hold_[hold_pos_] = window_min;
+        if (++hold_pos_ == lookahead_) {
+            // Resum once per lap so rounding in the running sum cannot build up
+            hold_pos_ = 0;
+            hold_sum_ = 0.0;
+            for (uint32_t k = 0; k < lookahead_; k++) {
+                hold_sum_ += static_cast<double>(hold_[k]);
+            }
+        }
+        const float attack = static_cast<float>(hold_sum_ * inv_lookahead);
+
+        envelope_ = attack < envelope_ ? attack : attack + (envelope_ - attack) * release_coeff_;
+        frame_gain_[i] = envelope_;
+    }
+}
+
+template <typename Sample>
+void LookaheadLimiter::process(Sample sample, uint32_t num_frames, float* peaks) {
+    const uint32_t latency = latencyFrames();
+    for (uint32_t offset = 0; offset < num_frames;) {
+        const uint32_t frames = std::min(kChunkFrames, num_frames - offset);
+
+        for (uint32_t ch = 0; ch < num_channels_; ch++) {
+            float* x = history_[ch] + kTaps - 1;
+            for (uint32_t i = 0; i < frames; i++) {
+                const float value = sample(ch, offset + i);
+                x[i] = std::isfinite(value) ? value : 0.0f;
+            }
+            // The detector runs whole vectors
+            std::fill(x + frames, x + ((frames + 3) & ~3u), 0.0f);
+        }
+
+        detect(frames);
+        computeEnvelope(frames);
+
+        for (uint32_t i = 0; i < frames; i++) {
+            const uint32_t write = (frame_ + i) & kRingMask;
+            const uint32_t read = (frame_ + i - latency) & kRingMask;
+            const float gain = frame_gain_[i];
+            for (uint32_t ch = 0; ch < num_channels_; ch++) {
+                const float out = delay_[ch][read] * gain;
+                delay_[ch][write] = history_[ch][kTaps - 1 + i];
+                sample(ch, offset + i) = out;
+                peaks[ch] = std::max(peaks[ch], std::fabs(out));
+            }
+        }
+        frame_ += frames;
+
+        for (uint32_t ch = 0; ch < num_channels_; ch++) {
+            std::memmove(history_[ch], history_[ch] + frames, (kTaps - 1) * sizeof(float));
+        }
+        offset += frames;
+    }
+}
+
+void LookaheadLimiter::processInterleaved(float* data, uint32_t stride, uint32_t num_frames, float* peaks) {
+    process([data, stride](uint32_t ch, uint32_t i) -> float& { return data[static_cast<size_t>(i) * stride + ch]; },
+            num_frames, peaks);
+}
+
+void LookaheadLimiter::processPlanar(float* left, float* right, uint32_t num_frames, float* peaks) {
+    float* const channels[2] = {left, right};
+    process([&channels](uint32_t ch, uint32_t i) -> float& { return channels[ch][i]; }, num_frames, peaks);
+}
+
+} // namespace radioform
@@ -0,0 +1,127 @@
+/**
+ * @file lookahead_limiter.h
+ * @brief Lookahead brickwall limiter with true-peak detection
+ *
+ * The audio is delayed by the lookahead plus the detector delay, so the gain
+ * can ramp down before a peak arrives instead of bending the waveform. Per
+ * sub-block:
+ *
+ *   1. Detection: each frame's peak is the larger of its sample peak and the
+ *      4x oversampled (BS.1770 Annex 2 interpolator) true peak, linked over
+ *      all channels. Four frames per vector, one vector per phase.
+ *   2. Required gain, threshold / max(peak, threshold), four frames per vector.
+ *   3. Gain envelope: the minimum required gain over the lookahead window
+ *      (monotonic deque, amortized O(1) per frame for any window length),
+ *      averaged over the lookahead (the attack ramp), then an exponential
+ *      release. Every sample inside a window that saw a peak is scaled by at
+ *      most the gain that peak needs, so the output stays at the threshold.
+ *   4. The delayed audio is scaled by the envelope.
+ *
+ * No allocation; state is sized for 5 ms at 384 kHz and up to
+ * RADIOFORM_MAX_CHANNELS channels.
+ */
+
+#ifndef RADIOFORM_LOOKAHEAD_LIMITER_H
+#define RADIOFORM_LOOKAHEAD_LIMITER_H
+
+#include "radioform_types.h"
+#include "true_peak.h"
+
+#include <cstdint>
+
+namespace radioform {
+
+class LookaheadLimiter {
+public:
+    // Detector group delay in frames (the interpolator's centre tap)
+    static constexpr uint32_t kDetectorDelay = 6;
+
+    // 5 ms at 384 kHz
+    static constexpr uint32_t kMaxLookaheadFrames = 1920;
+
+    /**
+     * @brief Set the channel count and clear all state
+     */
+    void init(uint32_t num_channels);
+
+    /**
+     * @brief Set lookahead, release and threshold
+     *
+     * Clears the delay line when the lookahead changes (the latency changes
+     * with it); threshold and release changes keep the state.
+     *
+     * @param lookahead_frames 1 to kMaxLookaheadFrames
+     * @param release_frames Release time constant in frames
+     * @param threshold_db Ceiling in dB (true peak)
+     */
+    void configure(uint32_t lookahead_frames, float release_frames, float threshold_db);
+
+    /**
+     * @brief Clear the delay line and the gain envelope
+     */
+    void reset();
+
+    /**
+     * @brief Delay the limiter adds, in frames
+     */
+    uint32_t latencyFrames() const { return lookahead_ + kDetectorDelay; }
+
+    /**
+     * @brief Limit interleaved (or padded) frames in place
+     *
+     * Channel c of frame i is data[i * stride + c]. Non-finite input samples
+     * are replaced by silence.
+     *
+     * @param peaks Per-channel output peaks, raised (not reset) by this call
+     */
+    void processInterleaved(float* data, uint32_t stride, uint32_t num_frames, float* peaks);
+
+    /**
+     * @brief Limit planar stereo buffers in place (two-channel limiter)
+     */
+    void processPlanar(float* left, float* right, uint32_t num_frames, float* peaks);
+
+private:
+    static constexpr uint32_t kTaps = kTruePeakTaps;  // Per interpolator phase
+    static constexpr uint32_t kChunkFrames = 64;      // Detection runs per chunk
+    static constexpr uint32_t kRingSize = 2048;       // > kMaxLookaheadFrames + kDetectorDelay
+    static constexpr uint32_t kRingMask = kRingSize - 1;
+
+    template <typename Sample>
+    void process(Sample sample, uint32_t num_frames, float* peaks);
+
+    void detect(uint32_t num_frames);
+    void computeEnvelope(uint32_t num_frames);
+
+    uint32_t num_channels_ = 2;
+    uint32_t lookahead_ = 48;
+    float release_coeff_ = 0.999f;
+    float threshold_ = 1.0f;
+
+    // Per chunk: detector input (previous kTaps - 1 samples first, padded to
+    // whole vectors), frame peaks, then the gain per frame
+    float history_[RADIOFORM_MAX_CHANNELS][kTaps - 1 + kChunkFrames + 4];
+    float frame_gain_[kChunkFrames + 4];
+
+    // Delayed audio
+    float delay_[RADIOFORM_MAX_CHANNELS][kRingSize];
+    uint32_t frame_ = 0;  // Frames processed (ring position, deque indices)
+
+    // Sliding-window minimum of the required gain: frame indices and gains,
+    // increasing from head to tail
+    uint32_t deque_frame_[kRingSize];
+    float deque_gain_[kRingSize];
+    uint32_t deque_head_ = 0;
+    uint32_t deque_tail_ = 0;
+
+    // Attack: running mean of the window minimum over the lookahead
+    float hold_[kMaxLookaheadFrames];
+    uint32_t hold_pos_ = 0;
+    double hold_sum_ = 0.0;
+
+    float envelope_ = 1.0f;
+};
+
+} // namespace radioform
+
+#endif // RADIOFORM_LOOKAHEAD_LIMITER_H
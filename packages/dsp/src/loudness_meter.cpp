@@ -0,0 +1,200 @@
+/**
+ * @file loudness_meter.cpp
+ * @brief BS.1770-4 loudness meter implementation
+ */
+
+#include "loudness_meter.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace radioform {
+
+namespace {
+
+// One transposed direct form II step
+inline float df2t(const BiquadCoeffs& c, BiquadState& state, float input) {
+    const float output = c.b0 * input + state.z1;
+    state.z1 = c.b1 * input - c.a1 * output + state.z2;
+    state.z2 = c.b2 * input - c.a2 * output;
+    return output;
+}
+
+// K-weighting stages as specified at 48 kHz (BS.1770-4 Table 1 and 2),
+// re-derived for other rates from their analog prototypes
+constexpr double kShelfFrequency = 1681.974450955533;
+constexpr double kShelfGainDb = 3.999843853973347;
+constexpr double kShelfQ = 0.7071752369554196;
+constexpr double kHighPassFrequency = 38.13547087602444;
+constexpr double kHighPassQ = 0.5003270373238773;
+
+BiquadCoeffs design_pre_filter(double sample_rate) {
+    const double k = std::tan(3.14159265358979323846 * kShelfFrequency / sample_rate);
+    const double vh = std::pow(10.0, kShelfGainDb / 20.0);
+    const double vb = std::pow(vh, 0.4996667741545416);
+    const double a0 = 1.0 + k / kShelfQ + k * k;
+    BiquadCoeffs c;
+    c.b0 = static_cast<float>((vh + vb * k / kShelfQ + k * k) / a0);
+    c.b1 = static_cast<float>(2.0 * (k * k - vh) / a0);
+    c.b2 = static_cast<float>((vh - vb * k / kShelfQ + k * k) / a0);
+    c.a1 = static_cast<float>(2.0 * (k * k - 1.0) / a0);
+    c.a2 = static_cast<float>((1.0 - k / kShelfQ + k * k) / a0);
+    return c;
+}
+
+BiquadCoeffs design_rlb_filter(double sample_rate) {
+    const double k = std::tan(3.14159265358979323846 * kHighPassFrequency / sample_rate);
+    const double a0 = 1.0 + k / kHighPassQ + k * k;
+    BiquadCoeffs c;
+    c.b0 = 1.0f;
+    c.b1 = -2.0f;
+    c.b2 = 1.0f;
+    c.a1 = static_cast<float>(2.0 * (k * k - 1.0) / a0);
+    c.a2 = static_cast<float>((1.0 - k / kHighPassQ + k * k) / a0);
+    return c;
+}
+
+float to_lufs(double mean_square) {
+    if (!(mean_square > 0.0)) {
+        return LoudnessMeter::kFloorLufs;
+    }
+    return std::max(static_cast<float>(-0.691 + 10.0 * std::log10(mean_square)),
+                    LoudnessMeter::kFloorLufs);
+}
+
+} // namespace
+
+void LoudnessMeter::init(float sample_rate, uint32_t num_channels) {
+    num_channels_ = std::min<uint32_t>(std::max<uint32_t>(num_channels, 1), RADIOFORM_MAX_CHANNELS);
+    block_frames_ = std::max<uint32_t>(1, static_cast<uint32_t>(std::lround(sample_rate / 10.0f)));
+
+    const bool surround = num_channels_ == 6 || num_channels_ == 8;
+    for (uint32_t ch = 0; ch < kPairs * 2; ch++) {
+        float weight = ch < num_channels_ ? 1.0f : 0.0f;
+        if (surround && ch == 3) {
+            weight = 0.0f;   // LFE
+        } else if (surround && ch >= 4 && ch < num_channels_) {
+            weight = 1.41f;  // Surrounds
+        }
+        weights_[ch] = weight;
+    }
+
+    pre_filter_ = design_pre_filter(sample_rate);
+    rlb_filter_ = design_rlb_filter(sample_rate);
+    reset();
+}
+
+void LoudnessMeter::reset() {
+    std::fill(pre_state_, pre_state_ + kPairs * 2, BiquadState{});
+    std::fill(rlb_state_, rlb_state_ + kPairs * 2, BiquadState{});
+    block_fill_ = 0;
+    block_sum_ = 0.0;
+    std::fill(ring_, ring_ + kRingBlocks, 0.0);
+    ring_pos_ = 0;
+    blocks_done_ = 0;
+    std::fill(bin_count_, bin_count_ + kBins, uint64_t{0});
+    std::fill(bin_energy_, bin_energy_ + kBins, 0.0);
+    momentary_lufs_ = kFloorLufs;
+    short_term_lufs_ = kFloorLufs;
+    integrated_lufs_ = kFloorLufs;
+}
+
+void LoudnessMeter::process(const float* const* channels, uint32_t stride, uint32_t num_frames) {
+    const uint32_t pairs = (num_channels_ + 1) / 2;
+    for (uint32_t offset = 0; offset < num_frames;) {
+        const uint32_t frames = std::min(num_frames - offset, block_frames_ - block_fill_);
+
+        double sum = 0.0;
+        for (uint32_t p = 0; p < pairs; p++) {
+            const uint32_t ch = 2 * p;
+            const float* left = channels[ch] + static_cast<size_t>(offset) * stride;
+            const float* right = ch + 1 < num_channels_
+                ? channels[ch + 1] + static_cast<size_t>(offset) * stride
+                : nullptr;
+            // Two channels per pass keep two independent filter chains in
+            // flight. Squares are summed in float per block (<= 100 ms).
+            BiquadState pre_l = pre_state_[ch], pre_r = pre_state_[ch + 1];
+            BiquadState rlb_l = rlb_state_[ch], rlb_r = rlb_state_[ch + 1];
+            float sum_left = 0.0f;
+            float sum_right = 0.0f;
+            for (uint32_t i = 0; i < frames; i++) {
+                float l = left[i * stride];
+                float r = right ? right[i * stride] : 0.0f;
+                l = std::isfinite(l) ? l : 0.0f;
+                r = std::isfinite(r) ? r : 0.0f;
+                l = df2t(rlb_filter_, rlb_l, df2t(pre_filter_, pre_l, l));
+                r = df2t(rlb_filter_, rlb_r, df2t(pre_filter_, pre_r, r));
+                sum_left += l * l;
+                sum_right += r * r;
+            }
+            pre_state_[ch] = pre_l;
+            pre_state_[ch + 1] = pre_r;
+            rlb_state_[ch] = rlb_l;
+            rlb_state_[ch + 1] = rlb_r;
+            sum += weights_[ch] * static_cast<double>(sum_left) +
+                   weights_[ch + 1] * static_cast<double>(sum_right);
+        }
+
+        block_sum_ += sum;
+        block_fill_ += frames;
+        if (block_fill_ == block_frames_) {
+            finishBlock();
+        }
+        offset += frames;
+    }
+}
+
+void LoudnessMeter::finishBlock() {
+    ring_[ring_pos_] = block_sum_ / static_cast<double>(block_frames_);
+    ring_pos_ = (ring_pos_ + 1) % kRingBlocks;
+    blocks_done_++;
+    block_sum_ = 0.0;
+    block_fill_ = 0;
+
+    // Windows before the first 400 ms include the silence before the start
+    double momentary = 0.0;
+    double short_term = 0.0;
+    for (uint32_t b = 1; b <= kShortTermBlocks; b++) {
+        const double energy = ring_[(ring_pos_ + kRingBlocks - b) % kRingBlocks];
+        short_term += energy;
+        if (b <= kMomentaryBlocks) {
+            momentary += energy;
+        }
+    }
+    momentary /= kMomentaryBlocks;
+    short_term /= kShortTermBlocks;
+    momentary_lufs_ = to_lufs(momentary);
+    short_term_lufs_ = to_lufs(short_term);
+
+    // Gating windows are whole 400 ms windows of the programme
+    if (blocks_done_ < kMomentaryBlocks || momentary_lufs_ <= kAbsoluteGateLufs) {
+        return;
+    }
+    const float position = (momentary_lufs_ - kAbsoluteGateLufs) / kBinLu;
+    const uint32_t bin = std::min(static_cast<uint32_t>(position), kBins - 1);
+    bin_count_[bin]++;
+    bin_energy_[bin] += momentary;
+
+    // Relative gate from the absolute-gated mean, then the mean above it.
+    // A bin passes when its centre is above the gate.
+    uint64_t count = 0;
+    double energy = 0.0;
+    for (uint32_t b = 0; b < kBins; b++) {
+        count += bin_count_[b];
+        energy += bin_energy_[b];
+    }
+    const float gate = to_lufs(energy / static_cast<double>(count)) + kRelativeGateLu;
+    const float first = (gate - kAbsoluteGateLufs) / kBinLu - 0.5f;
+    const uint32_t first_bin = first <= 0.0f
+        ? 0
+        : std::min(static_cast<uint32_t>(std::ceil(first)), kBins - 1);
+    count = 0;
+    energy = 0.0;
+    for (uint32_t b = first_bin; b < kBins; b++) {
+        count += bin_count_[b];
+        energy += bin_energy_[b];
+    }
+    integrated_lufs_ = count > 0 ? to_lufs(energy / static_cast<double>(count)) : kFloorLufs;
+}
+
+} // namespace radioform
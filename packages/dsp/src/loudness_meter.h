@@ -0,0 +1,107 @@
+/**
+ * @file loudness_meter.h
+ * @brief ITU-R BS.1770-4 / EBU R 128 loudness meter (momentary, short-term, integrated)
+ *
+ * Channels are K-weighted (a high shelf and the RLB high-pass, run two
+ * channels at a time) and their weighted mean squares summed into 100 ms
+ * block energies, kept in a fixed ring. Momentary loudness covers the last
+ * 4 blocks (400 ms), short-term the last 30 (3 s).
+ *
+ * Integrated loudness gates the 400 ms windows (one every 100 ms, 75%
+ * overlap) at -70 LUFS and then 10 LU below the mean of what passed. Every
+ * window above the absolute gate lands in a 0.1 LU histogram bin holding
+ * its count and energy sum, so memory stays constant however long the
+ * session runs and the relative gate needs one pass over the bins. Windows
+ * are classified by bin, so the relative gate has 0.1 LU resolution.
+ *
+ * No allocation; the readings are recomputed once per 100 ms block.
+ */
+
+#ifndef RADIOFORM_LOUDNESS_METER_H
+#define RADIOFORM_LOUDNESS_METER_H
+
+#include "biquad.h"
+#include "radioform_types.h"
+
+#include <cstdint>
+
+namespace radioform {
+
+class LoudnessMeter {
+public:
+    // Reading while there is nothing to report (silence, nothing gated in)
+    static constexpr float kFloorLufs = -120.0f;
+
+    /**
+     * @brief Design the K-weighting filters and clear the measurement
+     *
+     * Channel weights follow BS.1770 for 5.1 and 7.1 (L R C LFE Ls Rs
+     * [Lb Rb]): surrounds count 1.41, the LFE is left out. Other layouts
+     * weight every channel 1.0.
+     *
+     * @param num_channels 1 to RADIOFORM_MAX_CHANNELS
+     */
+    void init(float sample_rate, uint32_t num_channels);
+
+    /**
+     * @brief Clear the filters, blocks and histogram (starts a new programme)
+     */
+    void reset();
+
+    /**
+     * @brief Meter a buffer
+     *
+     * Sample i of channel ch is channels[ch][i * stride]. Non-finite samples
+     * are metered as silence.
+     */
+    void process(const float* const* channels, uint32_t stride, uint32_t num_frames);
+
+    float momentaryLufs() const { return momentary_lufs_; }
+    float shortTermLufs() const { return short_term_lufs_; }
+    float integratedLufs() const { return integrated_lufs_; }
+
+private:
+    static constexpr uint32_t kPairs = (RADIOFORM_MAX_CHANNELS + 1) / 2;
+    static constexpr uint32_t kRingBlocks = 32;       // >= 30 (short-term window)
+    static constexpr uint32_t kMomentaryBlocks = 4;
+    static constexpr uint32_t kShortTermBlocks = 30;
+    static constexpr float kAbsoluteGateLufs = -70.0f;
+    static constexpr float kRelativeGateLu = -10.0f;
+    static constexpr float kBinLu = 0.1f;
+    static constexpr uint32_t kBins = 800;             // -70 to +10 LUFS (louder windows share the top bin)
+
+    // Close the current 100 ms block and update the readings
+    void finishBlock();
+
+    uint32_t num_channels_ = 2;
+    uint32_t block_frames_ = 4800;
+    float weights_[kPairs * 2] = {};
+
+    // K-weighting: pre-filter (high shelf) then RLB high-pass. Input is
+    // sanitized and both filters are stable, so the state needs no guard.
+    BiquadCoeffs pre_filter_ = {};
+    BiquadCoeffs rlb_filter_ = {};
+    BiquadState pre_state_[kPairs * 2];
+    BiquadState rlb_state_[kPairs * 2];
+
+    // Current block: frames so far and the weighted sum of squares
+    uint32_t block_fill_ = 0;
+    double block_sum_ = 0.0;
+
+    // Mean square of the last kRingBlocks blocks (ring_pos_: next to write)
+    double ring_[kRingBlocks] = {};
+    uint32_t ring_pos_ = 0;
+    uint64_t blocks_done_ = 0;
+
+    // Gating windows above the absolute gate, by loudness
+    uint64_t bin_count_[kBins] = {};
+    double bin_energy_[kBins] = {};
+
+    float momentary_lufs_ = kFloorLufs;
+    float short_term_lufs_ = kFloorLufs;
+    float integrated_lufs_ = kFloorLufs;
+};
+
+} // namespace radioform
+
+#endif // RADIOFORM_LOUDNESS_METER_H
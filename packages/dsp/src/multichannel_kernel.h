@@ -0,0 +1,65 @@
+/**
+ * @file multichannel_kernel.h
+ * @brief Processing chain for engines with other than two channels
+ *
+ * The multichannel kernel puts the channels of a frame in SIMD lanes (one
+ * 4-lane vector for up to 4 channels, two 4-lane or one 8-lane vector for
+ * 5.1 / 7.1) and runs the whole chain on them: preamp -> state-variable
+ * bands -> biquad cascade -> DC blocker -> limiter -> peak. Every channel
+ * shares the coefficients; each has its own filter state.
+ *
+ * It works on frames padded to RADIOFORM_MAX_CHANNELS floats, so the engine
+ * copies interleaved or planar audio into a padded block first (unused lanes
+ * hold zeros). Coefficient ramps are stepped between calls, as for the
+ * stereo kernels.
+ */
+
+#ifndef RADIOFORM_MULTICHANNEL_KERNEL_H
+#define RADIOFORM_MULTICHANNEL_KERNEL_H
+
+#include "radioform_types.h"
+#include "biquad_bank.h"
+#include "svf.h"
+#include "smoothing.h"
+#include "limiter.h"
+#include "dc_blocker.h"
+
+#include <cstdint>
+
+namespace radioform {
+
+// Floats per padded frame in the multichannel kernel's block
+static constexpr uint32_t kFrameStride = RADIOFORM_MAX_CHANNELS;
+
+/**
+ * @brief Processing chain for the multichannel kernel
+ *
+ * Built by the engine when a preset is applied. Always a cascade: the
+ * parallel form is stereo-only.
+ */
+struct MultichannelChain {
+    uint32_t num_channels;
+    StateVariableFilter* svf[RADIOFORM_MAX_BANDS];  // Low-frequency bands, in order
+    uint32_t num_svf;
+    BiquadBank* cascade;
+    ParameterSmoother* preamp;
+    MultichannelDCBlocker* dc_blocker;
+    const SoftLimiter* limiter;  // nullptr when the limiter is disabled
+};
+
+/**
+ * @brief Kernel signature
+ *
+ * @param frames Padded frames (kFrameStride floats each), processed in place
+ * @param peaks Per-channel peak levels, raised to this block's peaks (linear)
+ */
+using MultichannelKernelFn = void (*)(
+    const MultichannelChain& chain,
+    float* frames,
+    uint32_t num_frames,
+    float* peaks
+);
+
+} // namespace radioform
+
+#endif // RADIOFORM_MULTICHANNEL_KERNEL_H
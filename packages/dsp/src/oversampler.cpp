@@ -0,0 +1,208 @@
+/**
+ * @file oversampler.cpp
+ * @brief Half-band oversampler implementation
+ */
+
+#include "oversampler.h"
+#include "simd.h"
+
+#include <cstring>
+
+namespace radioform {
+
+namespace {
+
+// Per stage, from the base rate up: nonzero odd taps per side. The first
+// stage has a ~0.11 fs (at 2x) transition band; the later ones only have to
+// reach their stopband before the images of the base-rate Nyquist.
+constexpr uint32_t kHalfTaps[3] = {12, 6, 4};
+constexpr float kKaiserBeta = 8.0f;  // ~80 dB stopband
+
+// Zeroth-order modified Bessel function of the first kind (Kaiser window)
+double bessel_i0(double x) {
+    double sum = 1.0;
+    double term = 1.0;
+    for (int k = 1; k < 32; k++) {
+        term *= (x / (2.0 * k)) * (x / (2.0 * k));
+        sum += term;
+    }
+    return sum;
+}
+
+} // namespace
+
+// ============================================================================
+// HalfbandStage
+// ============================================================================
+
+void HalfbandStage::design(uint32_t half_taps, float kaiser_beta) {
+    taps_ = std::min(2 * std::max<uint32_t>(half_taps, 1), kMaxTaps);
+
+    // Full filter: 2 * taps_ - 1 taps around the centre c = taps_ - 1. The
+    // odd taps are at offsets m = c - 2j from the centre, j = 0..taps_ - 1.
+    const double centre = static_cast<double>(taps_ - 1);
+    const double pi = 3.14159265358979323846;
+    double taps[kMaxTaps];
+    double sum = 0.0;
+    for (uint32_t j = 0; j < taps_; j++) {
+        const double m = centre - 2.0 * static_cast<double>(j);
+        const double sinc = std::sin(pi * m / 2.0) / (pi * m);
+        const double r = m / centre;
+        const double window = bessel_i0(kaiser_beta * std::sqrt(std::max(0.0, 1.0 - r * r))) /
+                              bessel_i0(kaiser_beta);
+        taps[j] = sinc * window;
+        sum += taps[j];
+    }
+
+    // The odd taps sum to 0.5 (the centre tap is the other half of DC)
+    for (uint32_t j = 0; j < taps_; j++) {
+        const double tap = taps[j] * 0.5 / sum;
+        down_coeffs_[j] = static_cast<float>(tap);
+        up_coeffs_[j] = static_cast<float>(2.0 * tap);
+    }
+    reset();
+}
+
+void HalfbandStage::reset() {
+    std::memset(up_history_, 0, sizeof(up_history_));
+    std::memset(even_history_, 0, sizeof(even_history_));
+    std::memset(odd_history_, 0, sizeof(odd_history_));
+}
+
+void HalfbandStage::upsample(const float* input, uint32_t num_frames, float* output) {
+    using namespace simd;
+
+    // Even outputs: the odd-tap branch. Odd outputs: the centre tap, a delay
+    // of half_taps - 1 input samples.
+    const uint32_t keep = taps_ - 1;
+    const uint32_t centre = taps_ / 2 - 1;
+    float* x = up_history_ + keep;
+    std::memcpy(x, input, num_frames * sizeof(float));
+    const float* delayed = x - centre;
+
+    for (uint32_t i = 0; i < num_frames; i += kBlock) {
+        // Four independent accumulators keep the adders busy
+        f32x4 acc0 = zero(), acc1 = zero(), acc2 = zero(), acc3 = zero();
+        for (uint32_t j = 0; j < taps_; j++) {
+            const f32x4 c = set1(up_coeffs_[j]);
+            const float* xj = x + i - j;
+            acc0 = mul_add(c, load(xj), acc0);
+            acc1 = mul_add(c, load(xj + 4), acc1);
+            acc2 = mul_add(c, load(xj + 8), acc2);
+            acc3 = mul_add(c, load(xj + 12), acc3);
+        }
+        float branch[kBlock];
+        store(branch, acc0);
+        store(branch + 4, acc1);
+        store(branch + 8, acc2);
+        store(branch + 12, acc3);
+        const uint32_t count = std::min(kBlock, num_frames - i);
+        for (uint32_t k = 0; k < count; k++) {
+            output[2 * (i + k)] = branch[k];
+            output[2 * (i + k) + 1] = delayed[i + k];
+        }
+    }
+
+    std::memmove(up_history_, x + num_frames - keep, keep * sizeof(float));
+}
+
+void HalfbandStage::downsample(const float* input, uint32_t num_frames, float* output) {
+    using namespace simd;
+
+    // Even input samples through the odd-tap branch, odd ones through the
+    // centre tap (half_taps samples back)
+    const uint32_t keep = taps_ - 1;
+    const uint32_t centre = taps_ / 2;
+    float* even = even_history_ + keep;
+    float* odd = odd_history_ + centre;
+    for (uint32_t i = 0; i < num_frames; i++) {
+        even[i] = input[2 * i];
+        odd[i] = input[2 * i + 1];
+    }
+
+    const f32x4 half = set1(0.5f);
+    for (uint32_t i = 0; i < num_frames; i += kBlock) {
+        const float* centre_taps = odd_history_ + i;
+        f32x4 acc0 = half * load(centre_taps);
+        f32x4 acc1 = half * load(centre_taps + 4);
+        f32x4 acc2 = half * load(centre_taps + 8);
+        f32x4 acc3 = half * load(centre_taps + 12);
+        for (uint32_t j = 0; j < taps_; j++) {
+            const f32x4 c = set1(down_coeffs_[j]);
+            const float* xj = even + i - j;
+            acc0 = mul_add(c, load(xj), acc0);
+            acc1 = mul_add(c, load(xj + 4), acc1);
+            acc2 = mul_add(c, load(xj + 8), acc2);
+            acc3 = mul_add(c, load(xj + 12), acc3);
+        }
+        float result[kBlock];
+        store(result, acc0);
+        store(result + 4, acc1);
+        store(result + 8, acc2);
+        store(result + 12, acc3);
+        const uint32_t count = std::min(kBlock, num_frames - i);
+        for (uint32_t k = 0; k < count; k++) {
+            output[i + k] = result[k];
+        }
+    }
+
+    std::memmove(even_history_, even + num_frames - keep, keep * sizeof(float));
+    std::memmove(odd_history_, odd + num_frames - centre, centre * sizeof(float));
+}
+
+// ============================================================================
+// Oversampler
+// ============================================================================
+
+void Oversampler::init() {
+    for (uint32_t ch = 0; ch < RADIOFORM_MAX_CHANNELS; ch++) {
+        for (uint32_t s = 0; s < kStages; s++) {
+            stages_[ch][s].design(kHalfTaps[s], kKaiserBeta);
+        }
+    }
+    setFactor(1);
+}
+
+void Oversampler::setFactor(uint32_t factor) {
+    num_stages_ = factor >= 8 ? 3 : factor >= 4 ? 2 : factor >= 2 ? 1 : 0;
+    factor_ = 1u << num_stages_;
+    reset();
+}
+
+void Oversampler::reset() {
+    for (uint32_t ch = 0; ch < RADIOFORM_MAX_CHANNELS; ch++) {
+        for (uint32_t s = 0; s < kStages; s++) {
+            stages_[ch][s].reset();
+        }
+    }
+}
+
+float Oversampler::latencyFrames(uint32_t factor) {
+    // Each stage delays both directions by 2 * half_taps - 1 samples at its
+    // higher rate
+    float latency = 0.0f;
+    for (uint32_t s = 0; s < kStages && (2u << s) <= factor; s++) {
+        latency += static_cast<float>(2 * (2 * kHalfTaps[s] - 1)) / static_cast<float>(2u << s);
+    }
+    return latency;
+}
+
+float* Oversampler::upsample(uint32_t channel, uint32_t num_frames) {
+    float* in = base_;
+    for (uint32_t s = 0; s < num_stages_; s++) {
+        float* out = rate_[s % 2];
+        stages_[channel][s].upsample(in, num_frames << s, out);
+        in = out;
+    }
+    return in;
+}
+
+void Oversampler::downsample(uint32_t channel, uint32_t num_frames, float* high) {
+    for (uint32_t s = num_stages_; s-- > 0;) {
+        float* out = s == 0 ? base_ : rate_[(s + 1) % 2];
+        stages_[channel][s].downsample(high, num_frames << s, out);
+        high = out;
+    }
+}
+
+} // namespace radioform
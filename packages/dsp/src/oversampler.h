@@ -0,0 +1,163 @@
+/**
+ * @file oversampler.h
+ * @brief Polyphase half-band oversampling around a nonlinear stage
+ *
+ * 2x, 4x and 8x run as a cascade of half-band FIR stages, each doubling the
+ * rate on the way up and halving it on the way down. Every other tap of a
+ * half-band filter is zero apart from the centre tap, so each stage runs as
+ * two polyphase branches at the lower rate: a pure delay and a short FIR
+ * over the odd taps, vectorized sixteen outputs (four independent vectors)
+ * per pass.
+ *
+ * The first stage sits next to the audio band and gets the steepest design
+ * (passband to ~0.39 fs, ~80 dB stopband). Later stages only separate an
+ * already band-limited signal from its images, so they are shorter. All
+ * stages are linear phase; the round trip adds 23 (2x), 28.5 (4x) or
+ * 30.25 (8x) frames at the base rate.
+ *
+ * No allocation after init(); state for RADIOFORM_MAX_CHANNELS channels.
+ */
+
+#ifndef RADIOFORM_OVERSAMPLER_H
+#define RADIOFORM_OVERSAMPLER_H
+
+#include "radioform_types.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+
+namespace radioform {
+
+/**
+ * @brief One 2x half-band stage (interpolator and decimator, one channel)
+ */
+class HalfbandStage {
+public:
+    // Odd-tap branch length limit, and lower-rate samples per call
+    static constexpr uint32_t kMaxTaps = 24;
+    static constexpr uint32_t kMaxFrames = 256;
+
+    /**
+     * @brief Design the filter and clear the state
+     *
+     * Kaiser-windowed sinc with 4 * half_taps - 1 taps, normalized to unity
+     * DC gain.
+     *
+     * @param half_taps Nonzero odd taps per side (kMaxTaps / 2 at most)
+     * @param kaiser_beta Window shape (stopband depth)
+     */
+    void design(uint32_t half_taps, float kaiser_beta);
+
+    void reset();
+
+    /**
+     * @brief num_frames samples in, 2 * num_frames samples out at twice the rate
+     */
+    void upsample(const float* input, uint32_t num_frames, float* output);
+
+    /**
+     * @brief 2 * num_frames samples in, num_frames samples out at half the rate
+     */
+    void downsample(const float* input, uint32_t num_frames, float* output);
+
+    /**
+     * @brief Group delay of each direction, in samples at the higher rate
+     */
+    uint32_t delay() const { return taps_ - 1; }
+
+private:
+    // Outputs per pass of the branch loop (four vectors)
+    static constexpr uint32_t kBlock = 16;
+
+    uint32_t taps_ = 0;  // Odd-tap branch length (2 * half_taps)
+
+    // Odd-tap branch, reversed: tap j weights the sample j back. The
+    // interpolator's copy carries its gain of 2.
+    float up_coeffs_[kMaxTaps];
+    float down_coeffs_[kMaxTaps];
+
+    // Branch inputs (previous taps_ - 1 samples first, padded to whole passes)
+    float up_history_[kMaxTaps - 1 + kMaxFrames + kBlock];
+    float even_history_[kMaxTaps - 1 + kMaxFrames + kBlock];
+    float odd_history_[kMaxTaps / 2 + kMaxFrames + kBlock];
+};
+
+/**
+ * @brief Runs a per-sample stage at 1x, 2x, 4x or 8x the base rate
+ */
+class Oversampler {
+public:
+    static constexpr uint32_t kMaxFactor = 8;
+
+    /**
+     * @brief Design the stages and clear the state (not realtime-safe)
+     */
+    void init();
+
+    /**
+     * @brief Select 1, 2, 4 or 8x and clear the state (realtime-safe)
+     */
+    void setFactor(uint32_t factor);
+
+    void reset();
+
+    uint32_t factor() const { return factor_; }
+
+    /**
+     * @brief Round-trip delay at the base rate (fractional above 2x)
+     */
+    static float latencyFrames(uint32_t factor);
+
+    /**
+     * @brief Run one channel through the stage at the oversampled rate, in place
+     *
+     * Sample i of the channel is data[i * stride]. Non-finite input samples
+     * are replaced by silence.
+     *
+     * @param stage Called as stage(float* samples, uint32_t count) on the
+     *        oversampled signal, at most kChunkFrames * factor() samples
+     * @return Peak magnitude of the channel's output
+     */
+    template <typename Stage>
+    float processChannel(uint32_t channel, float* data, uint32_t stride, uint32_t num_frames, Stage stage) {
+        float peak = 0.0f;
+        for (uint32_t offset = 0; offset < num_frames; offset += kChunkFrames) {
+            const uint32_t frames = std::min(kChunkFrames, num_frames - offset);
+            float* x = data + static_cast<size_t>(offset) * stride;
+            for (uint32_t i = 0; i < frames; i++) {
+                const float sample = x[i * stride];
+                base_[i] = std::isfinite(sample) ? sample : 0.0f;
+            }
+            float* high = upsample(channel, frames);
+            stage(high, frames * factor_);
+            downsample(channel, frames, high);
+            for (uint32_t i = 0; i < frames; i++) {
+                x[i * stride] = base_[i];
+                peak = std::max(peak, std::fabs(base_[i]));
+            }
+        }
+        return peak;
+    }
+
+private:
+    static constexpr uint32_t kStages = 3;
+    static constexpr uint32_t kChunkFrames = HalfbandStage::kMaxFrames / (kMaxFactor / 2);
+
+    // base_ to the top rate; returns the buffer holding it
+    float* upsample(uint32_t channel, uint32_t num_frames);
+    // From the top rate (in high) back to base_
+    void downsample(uint32_t channel, uint32_t num_frames, float* high);
+
+    uint32_t factor_ = 1;
+    uint32_t num_stages_ = 0;
+    HalfbandStage stages_[RADIOFORM_MAX_CHANNELS][kStages];
+
+    // Chunk at the base rate, and ping-pong buffers for the higher rates
+    float base_[kChunkFrames];
+    float rate_[2][kChunkFrames * kMaxFactor];
+};
+
+} // namespace radioform
+
+#endif // RADIOFORM_OVERSAMPLER_H
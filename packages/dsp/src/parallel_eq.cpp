@@ -0,0 +1,171 @@
+/**
+ * @file parallel_eq.cpp
+ * @brief Cascade-to-parallel conversion
+ */
+
+#include "parallel_eq.h"
+
+#include <cmath>
+#include <complex>
+
+namespace radioform {
+
+namespace {
+
+using Complex = std::complex<double>;
+
+// Smallest |a2| accepted: the direct term divides by the product of all a2
+constexpr double kMinPoleProduct = 1e-9;
+
+// Poles closer than this cannot be separated by partial fractions
+constexpr double kMinPoleDistance = 1e-7;
+
+// Largest allowed ratio of summed section energy to output energy. Above
+// this the sections cancel each other and float rounding dominates.
+constexpr double kMaxCancellation = 256.0;
+
+// Largest allowed relative L2 error between parallel and cascade responses
+constexpr double kMaxResponseError = 1e-4;
+
+constexpr int kVerifyLength = 4096;
+
+/**
+ * @brief Impulse responses in double precision, one per structure
+ *
+ * Uses the float coefficients the kernels will actually run with.
+ */
+bool verify_design(const BiquadCoeffs* cascade, const ParallelDesign& design) {
+    const uint32_t n = design.num_sections;
+
+    double z1[RADIOFORM_MAX_BANDS] = {};
+    double z2[RADIOFORM_MAX_BANDS] = {};
+    double s1[RADIOFORM_MAX_BANDS] = {};
+    double s2[RADIOFORM_MAX_BANDS] = {};
+
+    double error_energy = 0.0;
+    double cascade_energy = 0.0;
+    double section_energy = 0.0;
+
+    for (int i = 0; i < kVerifyLength; i++) {
+        const double x = (i == 0) ? 1.0 : 0.0;
+
+        double y_cascade = x;
+        for (uint32_t k = 0; k < n; k++) {
+            const BiquadCoeffs& c = cascade[k];
+            const double in = y_cascade;
+            y_cascade = c.b0 * in + z1[k];
+            z1[k] = c.b1 * in - c.a1 * y_cascade + z2[k];
+            z2[k] = c.b2 * in - c.a2 * y_cascade;
+        }
+
+        double y_parallel = design.direct * x;
+        for (uint32_t k = 0; k < n; k++) {
+            const double y = design.c0[k] * x + s1[k];
+            s1[k] = design.c1[k] * x - design.a1[k] * y + s2[k];
+            s2[k] = -design.a2[k] * y;
+            y_parallel += y;
+            section_energy += y * y;
+        }
+
+        const double diff = y_parallel - y_cascade;
+        error_energy += diff * diff;
+        cascade_energy += y_cascade * y_cascade;
+    }
+
+    if (!std::isfinite(error_energy) || !std::isfinite(section_energy) || cascade_energy <= 0.0) {
+        return false;
+    }
+    if (error_energy > kMaxResponseError * kMaxResponseError * cascade_energy) {
+        return false;
+    }
+    return section_energy <= kMaxCancellation * kMaxCancellation * cascade_energy;
+}
+
+} // namespace
+
+bool design_parallel(const BiquadCoeffs* cascade, uint32_t num_sections, ParallelDesign& design) {
+    if (num_sections > RADIOFORM_MAX_BANDS) {
+        return false;
+    }
+
+    design = {};
+    design.num_sections = num_sections;
+
+    // Poles of each section: roots of z^2 + a1 z + a2
+    Complex poles[RADIOFORM_MAX_BANDS * 2];
+    double pole_product = 1.0;
+    double zero_product = 1.0;
+    for (uint32_t k = 0; k < num_sections; k++) {
+        const double a1 = cascade[k].a1;
+        const double a2 = cascade[k].a2;
+        if (std::abs(a2) < kMinPoleProduct) {
+            return false;
+        }
+        const Complex root = std::sqrt(Complex(a1 * a1 - 4.0 * a2, 0.0));
+        poles[k * 2] = (-a1 + root) * 0.5;
+        poles[k * 2 + 1] = (-a1 - root) * 0.5;
+        pole_product *= a2;
+        zero_product *= cascade[k].b2;
+    }
+
+    const uint32_t num_poles = num_sections * 2;
+    for (uint32_t i = 0; i < num_poles; i++) {
+        for (uint32_t j = i + 1; j < num_poles; j++) {
+            if (std::abs(poles[i] - poles[j]) < kMinPoleDistance) {
+                return false;
+            }
+        }
+    }
+
+    // In w = z^-1 both numerator and denominator have degree 2N, so
+    // H(w) = C + sum_i r_i / (1 - p_i w) with C = H(w -> inf) = prod b2 / prod a2
+    // and r_i = B(1/p_i) / prod_{j != i} (1 - p_j / p_i).
+    Complex residues[RADIOFORM_MAX_BANDS * 2];
+    for (uint32_t i = 0; i < num_poles; i++) {
+        const Complex w = 1.0 / poles[i];
+        Complex numerator = 1.0;
+        for (uint32_t k = 0; k < num_sections; k++) {
+            const BiquadCoeffs& c = cascade[k];
+            numerator *= static_cast<double>(c.b0) + w * (static_cast<double>(c.b1) + w * static_cast<double>(c.b2));
+        }
+        Complex denominator = 1.0;
+        for (uint32_t j = 0; j < num_poles; j++) {
+            if (j != i) {
+                denominator *= 1.0 - poles[j] * w;
+            }
+        }
+        residues[i] = numerator / denominator;
+    }
+
+    // Recombine each section's pole pair into a real second-order section:
+    // r1 / (1 - p1 w) + r2 / (1 - p2 w) = ((r1 + r2) - (r1 p2 + r2 p1) w) / A(w)
+    for (uint32_t k = 0; k < num_sections; k++) {
+        const Complex& p1 = poles[k * 2];
+        const Complex& p2 = poles[k * 2 + 1];
+        const Complex& r1 = residues[k * 2];
+        const Complex& r2 = residues[k * 2 + 1];
+
+        const Complex c0 = r1 + r2;
+        const Complex c1 = -(r1 * p2 + r2 * p1);
+        const double scale = std::abs(r1) + std::abs(r2) + 1.0;
+        if (std::abs(c0.imag()) > 1e-6 * scale || std::abs(c1.imag()) > 1e-6 * scale) {
+            return false;
+        }
+
+        design.c0[k] = static_cast<float>(c0.real());
+        design.c1[k] = static_cast<float>(c1.real());
+        design.a1[k] = cascade[k].a1;
+        design.a2[k] = cascade[k].a2;
+        if (!std::isfinite(design.c0[k]) || !std::isfinite(design.c1[k])) {
+            return false;
+        }
+    }
+    design.direct = static_cast<float>(zero_product / pole_product);
+    if (!std::isfinite(design.direct)) {
+        return false;
+    }
+
+    return verify_design(cascade, design);
+}
+
+} // namespace radioform
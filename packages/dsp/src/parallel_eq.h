@@ -0,0 +1,218 @@
+/**
+ * @file parallel_eq.h
+ * @brief Parallel-form (partial-fraction) realization of the EQ cascade
+ *
+ * A cascade of N biquads H(z) = prod B_k(z) / A_k(z) is rewritten as
+ *
+ *   H(z) = C + sum_k (c0_k + c1_k z^-1) / A_k(z)
+ *
+ * keeping each section's poles. The sections no longer depend on each
+ * other, so they run side by side in SIMD lanes: lane = section * 2 + channel,
+ * two sections (stereo) per 4-lane register, four per 8-lane register. Each
+ * frame costs one short dependency chain instead of N back-to-back biquads.
+ * The kernels are in kernels_impl.h.
+ *
+ * The conversion is done in double precision when a preset is applied and
+ * is rejected (the engine keeps the cascade) when it is ill-conditioned:
+ * coincident or zero poles, or residues so large that float rounding in the
+ * sections would be audible after they cancel in the sum.
+ */
+
+#ifndef RADIOFORM_PARALLEL_EQ_H
+#define RADIOFORM_PARALLEL_EQ_H
+
+#include "radioform_types.h"
+#include "biquad.h"
+#include "cpu_util.h"
+
+#include <cstdint>
+
+namespace radioform {
+
+/**
+ * @brief Parallel-form coefficients for up to RADIOFORM_MAX_BANDS sections
+ */
+struct ParallelDesign {
+    float c0[RADIOFORM_MAX_BANDS];  // Section numerators (feed-forward)
+    float c1[RADIOFORM_MAX_BANDS];
+    float a1[RADIOFORM_MAX_BANDS];  // Section denominators (same as the cascade)
+    float a2[RADIOFORM_MAX_BANDS];
+    float direct;                   // Direct (FIR) term C
+    uint32_t num_sections;
+};
+
+/**
+ * @brief Convert a biquad cascade into parallel form
+ *
+ * @param cascade Section coefficients in processing order
+ * @param num_sections Number of sections (0 to RADIOFORM_MAX_BANDS)
+ * @param design Receives the parallel coefficients on success
+ * @return false if the conversion is ill-conditioned (keep the cascade)
+ *
+ * @note NOT realtime-safe (double-precision root finding and verification)
+ */
+bool design_parallel(const BiquadCoeffs* cascade, uint32_t num_sections, ParallelDesign& design);
+
+/**
+ * @brief Stereo parallel-form filter bank
+ *
+ * Coefficients and state are stored in lane order, one cache-line-aligned
+ * array per field, so the kernels load them straight into registers.
+ */
+class ParallelEQ {
+public:
+    // Stereo lanes, padded to a whole number of 8-lane registers
+    static constexpr uint32_t kMaxVectorWidth = 8;
+    static constexpr uint32_t kLanes =
+        (RADIOFORM_MAX_BANDS * 2 + kMaxVectorWidth - 1) / kMaxVectorWidth * kMaxVectorWidth;
+
+    /**
+     * @brief Initialize to passthrough (no sections, direct term 1)
+     */
+    void init() {
+        ParallelDesign flat = {};
+        flat.direct = 1.0f;
+        setDesign(flat);
+        reset();
+    }
+
+    /**
+     * @brief Reset section state
+     */
+    void reset() {
+        for (uint32_t i = 0; i < kLanes; i++) {
+            s1_[i] = 0.0f;
+            s2_[i] = 0.0f;
+        }
+    }
+
+    /**
+     * @brief Set coefficients instantly
+     *
+     * Section state is kept when the section count is unchanged and cleared
+     * otherwise (the sections no longer correspond).
+     */
+    void setDesign(const ParallelDesign& design) {
+        if (design.num_sections != num_sections_) {
+            reset();
+        }
+        storeDesign(design, c0_, c1_, a1_, a2_, direct_);
+        storeDesign(design, target_c0_, target_c1_, target_a1_, target_a2_, target_direct_);
+        num_sections_ = design.num_sections;
+        ramp_remaining_ = 0;
+    }
+
+    /**
+     * @brief Ramp to new coefficients over transition_frames frames
+     *
+     * Stepped like Biquad::setCoeffsSmooth(): held for kRampBlockFrames
+     * frames, moved by stepRamp(), denominators interpolated through stable
+     * filters. The first step is taken immediately. Falls back to
+     * setDesign() when the section count changes.
+     */
+    void setDesignSmooth(const ParallelDesign& design, int transition_frames) {
+        if (design.num_sections != num_sections_ || transition_frames <= 0) {
+            setDesign(design);
+            return;
+        }
+
+        storeDesign(design, target_c0_, target_c1_, target_a1_, target_a2_, target_direct_);
+        for (uint32_t i = 0; i < kLanes; i++) {
+            start_c0_[i] = c0_[i];
+            start_c1_[i] = c1_[i];
+            start_a1_[i] = a1_[i];
+            start_a2_[i] = a2_[i];
+        }
+        start_direct_ = direct_;
+        ramp_steps_ = ramp_step_count(transition_frames);
+        ramp_remaining_ = ramp_steps_;
+        stepRamp();
+    }
+
+    /**
+     * @brief Move an active ramp to its next step (see Biquad::stepRamp)
+     */
+    void stepRamp() {
+        if (ramp_remaining_ <= 0) {
+            return;
+        }
+        if (--ramp_remaining_ == 0) {
+            for (uint32_t i = 0; i < kLanes; i++) {
+                c0_[i] = target_c0_[i];
+                c1_[i] = target_c1_[i];
+                a1_[i] = target_a1_[i];
+                a2_[i] = target_a2_[i];
+            }
+            direct_ = target_direct_;
+            return;
+        }
+
+        const float t = static_cast<float>(ramp_steps_ - ramp_remaining_) /
+                        static_cast<float>(ramp_steps_);
+        for (uint32_t i = 0; i < kLanes; i++) {
+            c0_[i] = start_c0_[i] + (target_c0_[i] - start_c0_[i]) * t;
+            c1_[i] = start_c1_[i] + (target_c1_[i] - start_c1_[i]) * t;
+            interpolate_poles(start_a1_[i], start_a2_[i], target_a1_[i], target_a2_[i], t,
+                              a1_[i], a2_[i]);
+        }
+        direct_ = start_direct_ + (target_direct_ - start_direct_) * t;
+    }
+
+    uint32_t numSections() const { return num_sections_; }
+
+    /**
+     * @brief Registers of width vector lanes needed to hold all sections
+     */
+    uint32_t numGroups(uint32_t width) const {
+        return (num_sections_ * 2 + width - 1) / width;
+    }
+    int rampStepsRemaining() const { return ramp_remaining_; }
+
+    // Lane-ordered storage, read and written back by the kernels
+    alignas(kCacheLineSize) float c0_[kLanes];
+    alignas(kCacheLineSize) float c1_[kLanes];
+    alignas(kCacheLineSize) float a1_[kLanes];
+    alignas(kCacheLineSize) float a2_[kLanes];
+    alignas(kCacheLineSize) float s1_[kLanes];
+    alignas(kCacheLineSize) float s2_[kLanes];
+    float direct_;
+
+private:
+    /**
+     * @brief Scatter per-section coefficients into lane order (unused lanes zero)
+     */
+    static void storeDesign(
+        const ParallelDesign& design,
+        float* c0, float* c1, float* a1, float* a2, float& direct
+    ) {
+        for (uint32_t i = 0; i < kLanes; i++) {
+            const uint32_t section = i / 2;
+            const bool used = section < design.num_sections;
+            c0[i] = used ? design.c0[section] : 0.0f;
+            c1[i] = used ? design.c1[section] : 0.0f;
+            a1[i] = used ? design.a1[section] : 0.0f;
+            a2[i] = used ? design.a2[section] : 0.0f;
+        }
+        direct = design.direct;
+    }
+
+    // Ramp endpoints (stepRamp() interpolates between them)
+    float start_c0_[kLanes];
+    float start_c1_[kLanes];
+    float start_a1_[kLanes];
+    float start_a2_[kLanes];
+    float start_direct_;
+    float target_c0_[kLanes];
+    float target_c1_[kLanes];
+    float target_a1_[kLanes];
+    float target_a2_[kLanes];
+    float target_direct_;
+    int ramp_steps_ = 0;
+    int ramp_remaining_ = 0;
+
+    uint32_t num_sections_ = 0;
+};
+
+} // namespace radioform
+
+#endif // RADIOFORM_PARALLEL_EQ_H
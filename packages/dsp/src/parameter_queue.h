@@ -0,0 +1,259 @@
+/**
+ * @file parameter_queue.h
+ * @brief Wait-free handoff of realtime parameter updates to the audio thread
+ *
+ * The control thread designs coefficients and publishes them; the audio
+ * thread applies them at the start of its next buffer. Each update target
+ * (a band, the preamp, the parallel design) has a latest-value Mailbox, so
+ * a burst of slider moves costs the audio thread one update, not one per
+ * move. Targets holding an unread value are listed, once each, in an
+ * SpscQueue, so the audio thread only visits targets that changed, in the
+ * order they were first changed.
+ *
+ * One producer (the control thread) and one consumer (the audio thread).
+ */
+
+#ifndef RADIOFORM_PARAMETER_QUEUE_H
+#define RADIOFORM_PARAMETER_QUEUE_H
+
+#include "radioform_types.h"
+#include "biquad.h"
+#include "svf.h"
+#include "parallel_eq.h"
+#include "cpu_util.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+
+namespace radioform {
+
+/**
+ * @brief Bounded wait-free single-producer/single-consumer ring
+ *
+ * @tparam Capacity Power of two
+ */
+template <typename T, uint32_t Capacity>
+class SpscQueue {
+    static_assert((Capacity & (Capacity - 1)) == 0, "capacity must be a power of two");
+
+public:
+    /**
+     * @brief Append an item (producer)
+     *
+     * @return false if the queue is full
+     */
+    bool push(const T& item) {
+        const uint32_t tail = tail_.load(std::memory_order_relaxed);
+        if (tail - head_.load(std::memory_order_acquire) == Capacity) {
+            return false;
+        }
+        items_[tail & (Capacity - 1)] = item;
+        tail_.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Take the oldest item (consumer)
+     *
+     * @return false if the queue is empty
+     */
+    bool pop(T& item) {
+        const uint32_t head = head_.load(std::memory_order_relaxed);
+        if (head == tail_.load(std::memory_order_acquire)) {
+            return false;
+        }
+        item = items_[head & (Capacity - 1)];
+        head_.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Append up to count items, in at most two copies (producer)
+     *
+     * @return Number of items appended (fewer than count if the queue fills)
+     */
+    uint32_t push(const T* items, uint32_t count) {
+        const uint32_t tail = tail_.load(std::memory_order_relaxed);
+        count = std::min(count, Capacity - (tail - head_.load(std::memory_order_acquire)));
+        const uint32_t start = tail & (Capacity - 1);
+        const uint32_t first = std::min(count, Capacity - start);
+        std::copy(items, items + first, items_ + start);
+        std::copy(items + first, items + count, items_);
+        tail_.store(tail + count, std::memory_order_release);
+        return count;
+    }
+
+    /**
+     * @brief Take up to count of the oldest items, in at most two copies (consumer)
+     *
+     * @return Number of items taken
+     */
+    uint32_t pop(T* items, uint32_t count) {
+        const uint32_t head = head_.load(std::memory_order_relaxed);
+        count = std::min(count, tail_.load(std::memory_order_acquire) - head);
+        const uint32_t start = head & (Capacity - 1);
+        const uint32_t first = std::min(count, Capacity - start);
+        std::copy(items_ + start, items_ + start + first, items);
+        std::copy(items_, items_ + (count - first), items + first);
+        head_.store(head + count, std::memory_order_release);
+        return count;
+    }
+
+    uint32_t size() const {
+        return tail_.load(std::memory_order_acquire) - head_.load(std::memory_order_acquire);
+    }
+
+private:
+    T items_[Capacity];
+    alignas(kCacheLineSize) std::atomic<uint32_t> head_{0};  // Consumer
+    alignas(kCacheLineSize) std::atomic<uint32_t> tail_{0};  // Producer
+};
+
+/**
+ * @brief Latest-value slot between one producer and one consumer
+ *
+ * Triple buffer: the producer fills its back buffer and swaps it with the
+ * middle one; the consumer swaps the middle one with its front buffer when
+ * it is newer. Neither side waits, and an unread value is replaced by a
+ * newer one.
+ */
+template <typename T>
+class Mailbox {
+public:
+    /**
+     * @brief Buffer the next value is written to (producer)
+     */
+    T& back() { return buffers_[back_]; }
+
+    /**
+     * @brief Make back() the latest value (producer)
+     *
+     * @return true if the consumer had read the previous value (so it needs
+     *         to be told about this one), false if this one replaced it
+     */
+    bool publish() {
+        const uint32_t previous = middle_.exchange(back_ | kFresh, std::memory_order_acq_rel);
+        back_ = previous & kIndexMask;
+        return (previous & kFresh) == 0;
+    }
+
+    /**
+     * @brief Latest value if it has not been read yet, else nullptr (consumer)
+     */
+    const T* take() {
+        if ((middle_.load(std::memory_order_relaxed) & kFresh) == 0) {
+            return nullptr;
+        }
+        front_ = middle_.exchange(front_, std::memory_order_acq_rel) & kIndexMask;
+        return &buffers_[front_];
+    }
+
+private:
+    static constexpr uint32_t kIndexMask = 3;
+    static constexpr uint32_t kFresh = 4;
+
+    T buffers_[3] = {};
+    uint32_t back_ = 0;                     // Producer
+    std::atomic<uint32_t> middle_{1};
+    uint32_t front_ = 2;                    // Consumer
+};
+
+/**
+ * @brief New coefficients for one band, designed on the control thread
+ */
+struct BandUpdate {
+    uint32_t epoch;                        // Configuration the update was made for
+    radioform_filter_topology_t topology;  // Which of the two designs applies
+    BiquadCoeffs biquad;
+    SvfCoeffs svf;
+};
+
+struct PreampUpdate {
+    uint32_t epoch;
+    float gain;
+};
+
+/**
+ * @brief New parallel-form design (parallel mode), or a fallback to the cascade
+ */
+struct ParallelUpdate {
+    uint32_t epoch;
+    bool valid;  // false: the conversion was rejected, switch to the cascade
+    ParallelDesign design;
+};
+
+/**
+ * @brief All realtime parameter updates of an engine
+ */
+class ParameterQueue {
+public:
+    static constexpr uint32_t kPreampTarget = RADIOFORM_MAX_BANDS;
+    static constexpr uint32_t kParallelTarget = RADIOFORM_MAX_BANDS + 1;
+    static constexpr uint32_t kNumTargets = RADIOFORM_MAX_BANDS + 2;
+
+    // ------------------------------------------------------------------------
+    // Control thread
+    // ------------------------------------------------------------------------
+
+    BandUpdate& band(uint32_t index) { return bands_[index].back(); }
+    PreampUpdate& preamp() { return preamp_.back(); }
+    ParallelUpdate& parallel() { return parallel_.back(); }
+
+    /**
+     * @brief Publish the value written to band()/preamp()/parallel()
+     */
+    void publish(uint32_t target) {
+        bool first;
+        if (target < RADIOFORM_MAX_BANDS) {
+            first = bands_[target].publish();
+        } else if (target == kPreampTarget) {
+            first = preamp_.publish();
+        } else {
+            first = parallel_.publish();
+        }
+        // Each target is listed at most once, so this never fails
+        if (first) {
+            pending_.push(target);
+        }
+    }
+
+    // ------------------------------------------------------------------------
+    // Audio thread
+    // ------------------------------------------------------------------------
+
+    /**
+     * @brief Apply every pending update
+     *
+     * Visits at most kNumTargets targets per call, so a producer publishing
+     * continuously cannot keep the audio thread here.
+     */
+    template <typename OnBand, typename OnPreamp, typename OnParallel>
+    void drain(OnBand on_band, OnPreamp on_preamp, OnParallel on_parallel) {
+        uint32_t target;
+        for (uint32_t i = 0; i < kNumTargets && pending_.pop(target); i++) {
+            if (target < RADIOFORM_MAX_BANDS) {
+                if (const BandUpdate* update = bands_[target].take()) {
+                    on_band(target, *update);
+                }
+            } else if (target == kPreampTarget) {
+                if (const PreampUpdate* update = preamp_.take()) {
+                    on_preamp(*update);
+                }
+            } else if (const ParallelUpdate* update = parallel_.take()) {
+                on_parallel(*update);
+            }
+        }
+    }
+
+private:
+    Mailbox<BandUpdate> bands_[RADIOFORM_MAX_BANDS];
+    Mailbox<PreampUpdate> preamp_;
+    Mailbox<ParallelUpdate> parallel_;
+    SpscQueue<uint32_t, 16> pending_;
+    static_assert(kNumTargets <= 16, "pending list must hold every target");
+};
+
+} // namespace radioform
+
+#endif // RADIOFORM_PARAMETER_QUEUE_H
@@ -0,0 +1,274 @@
+/**
+ * @file simd.h
+ * @brief Minimal portable 4-lane float vector wrapper
+ *
+ * Maps onto SSE2 on x86, NEON on arm64 and a plain array elsewhere so the
+ * processing kernels can be written once. Only the handful of operations the
+ * kernels actually need are provided.
+ *
+ * Multiply-add is deliberately NOT fused, so vector kernels round the same
+ * way as the scalar reference code in biquad.h / dc_blocker.h. The AVX2
+ * kernel set (simd_avx2.h) fuses it.
+ */
+
+#ifndef RADIOFORM_SIMD_H
+#define RADIOFORM_SIMD_H
+
+#include <cstdint>
+#include <cfloat>
+#include <cmath>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #include <emmintrin.h>
+    #define RADIOFORM_SIMD_SSE2 1
+    #define RADIOFORM_SIMD_NAME "sse2"
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__) || defined(__aarch64__)
+    #include <arm_neon.h>
+    #define RADIOFORM_SIMD_NEON 1
+    #define RADIOFORM_SIMD_NAME "neon"
+#else
+    #define RADIOFORM_SIMD_SCALAR 1
+    #define RADIOFORM_SIMD_NAME "scalar"
+#endif
+
+namespace radioform {
+namespace simd {
+
+#if defined(RADIOFORM_SIMD_SSE2)
+
+struct f32x4 { __m128 v; };
+struct m32x4 { __m128 v; };
+
+inline f32x4 zero() { return {_mm_setzero_ps()}; }
+inline f32x4 set1(float x) { return {_mm_set1_ps(x)}; }
+inline f32x4 set(float a, float b, float c, float d) { return {_mm_setr_ps(a, b, c, d)}; }
+inline f32x4 load(const float* p) { return {_mm_loadu_ps(p)}; }
+inline void store(float* p, f32x4 x) { _mm_storeu_ps(p, x.v); }
+
+/** Load two consecutive floats into lanes 0/1 (lanes 2/3 are zero) */
+inline f32x4 load2(const float* p) {
+    return {_mm_castpd_ps(_mm_load_sd(reinterpret_cast<const double*>(p)))};
+}
+
+/** Store lanes 0/1 to two consecutive floats */
+inline void store2(float* p, f32x4 x) {
+    _mm_store_sd(reinterpret_cast<double*>(p), _mm_castps_pd(x.v));
+}
+
+inline f32x4 operator+(f32x4 a, f32x4 b) { return {_mm_add_ps(a.v, b.v)}; }
+inline f32x4 operator-(f32x4 a, f32x4 b) { return {_mm_sub_ps(a.v, b.v)}; }
+inline f32x4 operator*(f32x4 a, f32x4 b) { return {_mm_mul_ps(a.v, b.v)}; }
+inline f32x4 operator/(f32x4 a, f32x4 b) { return {_mm_div_ps(a.v, b.v)}; }
+inline f32x4 min(f32x4 a, f32x4 b) { return {_mm_min_ps(a.v, b.v)}; }
+inline f32x4 max(f32x4 a, f32x4 b) { return {_mm_max_ps(a.v, b.v)}; }
+
+inline f32x4 abs(f32x4 a) {
+    return {_mm_and_ps(a.v, _mm_castsi128_ps(_mm_set1_epi32(0x7fffffff)))};
+}
+
+/** Round to the nearest integer (ties to even; |x| < 2^31) */
+inline f32x4 round_nearest(f32x4 a) { return {_mm_cvtepi32_ps(_mm_cvtps_epi32(a.v))}; }
+
+/** 2^n for integer-valued lanes n in [-126, 127] */
+inline f32x4 pow2i(f32x4 n) {
+    const __m128i e = _mm_add_epi32(_mm_cvtps_epi32(n.v), _mm_set1_epi32(127));
+    return {_mm_castsi128_ps(_mm_slli_epi32(e, 23))};
+}
+
+/** Magnitude of @p mag with the sign of @p sign */
+inline f32x4 copysign(f32x4 mag, f32x4 sign) {
+    const __m128 sign_mask = _mm_castsi128_ps(_mm_set1_epi32(static_cast<int>(0x80000000u)));
+    return {_mm_or_ps(_mm_andnot_ps(sign_mask, mag.v), _mm_and_ps(sign_mask, sign.v))};
+}
+
+inline m32x4 cmp_le(f32x4 a, f32x4 b) { return {_mm_cmple_ps(a.v, b.v)}; }
+inline m32x4 cmp_gt(f32x4 a, f32x4 b) { return {_mm_cmpgt_ps(a.v, b.v)}; }
+
+/** Lane mask: true where the value is neither NaN nor infinite */
+inline m32x4 is_finite(f32x4 a) { return cmp_le(abs(a), set1(FLT_MAX)); }
+
+/** Per-lane (mask ? a : b) */
+inline f32x4 select(m32x4 m, f32x4 a, f32x4 b) {
+    return {_mm_or_ps(_mm_and_ps(m.v, a.v), _mm_andnot_ps(m.v, b.v))};
+}
+
+inline bool all(m32x4 m) { return _mm_movemask_ps(m.v) == 0xF; }
+inline bool any(m32x4 m) { return _mm_movemask_ps(m.v) != 0; }
+
+/** [x0, x1, x2, x3] -> [x0, x1, x0, x1] */
+inline f32x4 dup_pair(f32x4 x) { return {_mm_movelh_ps(x.v, x.v)}; }
+
+/** [x0, x1, x2, x3] -> [x0 + x2, x1 + x3, 0, 0] */
+inline f32x4 fold_pairs(f32x4 x) {
+    const __m128 sum = _mm_add_ps(x.v, _mm_movehl_ps(x.v, x.v));
+    return {_mm_castpd_ps(_mm_move_sd(_mm_setzero_pd(), _mm_castps_pd(sum)))};
+}
+
+#elif defined(RADIOFORM_SIMD_NEON)
+
+struct f32x4 { float32x4_t v; };
+struct m32x4 { uint32x4_t v; };
+
+inline f32x4 zero() { return {vdupq_n_f32(0.0f)}; }
+inline f32x4 set1(float x) { return {vdupq_n_f32(x)}; }
+inline f32x4 set(float a, float b, float c, float d) {
+    const float tmp[4] = {a, b, c, d};
+    return {vld1q_f32(tmp)};
+}
+inline f32x4 load(const float* p) { return {vld1q_f32(p)}; }
+inline void store(float* p, f32x4 x) { vst1q_f32(p, x.v); }
+
+/** Load two consecutive floats into lanes 0/1 (lanes 2/3 are zero) */
+inline f32x4 load2(const float* p) { return {vcombine_f32(vld1_f32(p), vdup_n_f32(0.0f))}; }
+
+/** Store lanes 0/1 to two consecutive floats */
+inline void store2(float* p, f32x4 x) { vst1_f32(p, vget_low_f32(x.v)); }
+
+inline f32x4 operator+(f32x4 a, f32x4 b) { return {vaddq_f32(a.v, b.v)}; }
+inline f32x4 operator-(f32x4 a, f32x4 b) { return {vsubq_f32(a.v, b.v)}; }
+inline f32x4 operator*(f32x4 a, f32x4 b) { return {vmulq_f32(a.v, b.v)}; }
+inline f32x4 operator/(f32x4 a, f32x4 b) { return {vdivq_f32(a.v, b.v)}; }
+inline f32x4 min(f32x4 a, f32x4 b) { return {vminq_f32(a.v, b.v)}; }
+inline f32x4 max(f32x4 a, f32x4 b) { return {vmaxq_f32(a.v, b.v)}; }
+inline f32x4 abs(f32x4 a) { return {vabsq_f32(a.v)}; }
+
+/** Round to the nearest integer (ties to even) */
+inline f32x4 round_nearest(f32x4 a) { return {vrndnq_f32(a.v)}; }
+
+/** 2^n for integer-valued lanes n in [-126, 127] */
+inline f32x4 pow2i(f32x4 n) {
+    const int32x4_t e = vaddq_s32(vcvtnq_s32_f32(n.v), vdupq_n_s32(127));
+    return {vreinterpretq_f32_s32(vshlq_n_s32(e, 23))};
+}
+
+/** Magnitude of @p mag with the sign of @p sign */
+inline f32x4 copysign(f32x4 mag, f32x4 sign) {
+    return {vbslq_f32(vdupq_n_u32(0x80000000u), sign.v, mag.v)};
+}
+
+inline m32x4 cmp_le(f32x4 a, f32x4 b) { return {vcleq_f32(a.v, b.v)}; }
+inline m32x4 cmp_gt(f32x4 a, f32x4 b) { return {vcgtq_f32(a.v, b.v)}; }
+
+/** Lane mask: true where the value is neither NaN nor infinite */
+inline m32x4 is_finite(f32x4 a) { return cmp_le(abs(a), set1(FLT_MAX)); }
+
+/** Per-lane (mask ? a : b) */
+inline f32x4 select(m32x4 m, f32x4 a, f32x4 b) { return {vbslq_f32(m.v, a.v, b.v)}; }
+
+inline bool all(m32x4 m) { return vminvq_u32(m.v) != 0; }
+inline bool any(m32x4 m) { return vmaxvq_u32(m.v) != 0; }
+
+/** [x0, x1, x2, x3] -> [x0, x1, x0, x1] */
+inline f32x4 dup_pair(f32x4 x) { return {vcombine_f32(vget_low_f32(x.v), vget_low_f32(x.v))}; }
+
+/** [x0, x1, x2, x3] -> [x0 + x2, x1 + x3, 0, 0] */
+inline f32x4 fold_pairs(f32x4 x) {
+    return {vcombine_f32(vadd_f32(vget_low_f32(x.v), vget_high_f32(x.v)), vdup_n_f32(0.0f))};
+}
+
+#else // RADIOFORM_SIMD_SCALAR
+
+struct f32x4 { float v[4]; };
+struct m32x4 { bool v[4]; };
+
+inline f32x4 zero() { return {{0.0f, 0.0f, 0.0f, 0.0f}}; }
+inline f32x4 set1(float x) { return {{x, x, x, x}}; }
+inline f32x4 set(float a, float b, float c, float d) { return {{a, b, c, d}}; }
+inline f32x4 load(const float* p) { return {{p[0], p[1], p[2], p[3]}}; }
+inline void store(float* p, f32x4 x) { for (int i = 0; i < 4; ++i) p[i] = x.v[i]; }
+
+/** Load two consecutive floats into lanes 0/1 (lanes 2/3 are zero) */
+inline f32x4 load2(const float* p) { return {{p[0], p[1], 0.0f, 0.0f}}; }
+
+/** Store lanes 0/1 to two consecutive floats */
+inline void store2(float* p, f32x4 x) { p[0] = x.v[0]; p[1] = x.v[1]; }
+
+#define RADIOFORM_SIMD_LANEWISE(expr) \
+    f32x4 r; for (int i = 0; i < 4; ++i) r.v[i] = (expr); return r
+
+inline f32x4 operator+(f32x4 a, f32x4 b) { RADIOFORM_SIMD_LANEWISE(a.v[i] + b.v[i]); }
+inline f32x4 operator-(f32x4 a, f32x4 b) { RADIOFORM_SIMD_LANEWISE(a.v[i] - b.v[i]); }
+inline f32x4 operator*(f32x4 a, f32x4 b) { RADIOFORM_SIMD_LANEWISE(a.v[i] * b.v[i]); }
+inline f32x4 operator/(f32x4 a, f32x4 b) { RADIOFORM_SIMD_LANEWISE(a.v[i] / b.v[i]); }
+inline f32x4 min(f32x4 a, f32x4 b) { RADIOFORM_SIMD_LANEWISE(a.v[i] < b.v[i] ? a.v[i] : b.v[i]); }
+inline f32x4 max(f32x4 a, f32x4 b) { RADIOFORM_SIMD_LANEWISE(a.v[i] > b.v[i] ? a.v[i] : b.v[i]); }
+inline f32x4 abs(f32x4 a) { RADIOFORM_SIMD_LANEWISE(a.v[i] < 0.0f ? -a.v[i] : a.v[i]); }
+
+/** Round to the nearest integer (ties to even) */
+inline f32x4 round_nearest(f32x4 a) { RADIOFORM_SIMD_LANEWISE(std::nearbyint(a.v[i])); }
+
+/** 2^n for integer-valued lanes n in [-126, 127] */
+inline f32x4 pow2i(f32x4 n) { RADIOFORM_SIMD_LANEWISE(std::ldexp(1.0f, static_cast<int>(n.v[i]))); }
+
+/** Magnitude of @p mag with the sign of @p sign */
+inline f32x4 copysign(f32x4 mag, f32x4 sign) {
+    RADIOFORM_SIMD_LANEWISE(std::signbit(sign.v[i]) ? -std::fabs(mag.v[i]) : std::fabs(mag.v[i]));
+}
+
+#undef RADIOFORM_SIMD_LANEWISE
+
+inline m32x4 cmp_le(f32x4 a, f32x4 b) {
+    m32x4 m; for (int i = 0; i < 4; ++i) m.v[i] = a.v[i] <= b.v[i]; return m;
+}
+inline m32x4 cmp_gt(f32x4 a, f32x4 b) {
+    m32x4 m; for (int i = 0; i < 4; ++i) m.v[i] = a.v[i] > b.v[i]; return m;
+}
+
+/** Lane mask: true where the value is neither NaN nor infinite */
+inline m32x4 is_finite(f32x4 a) { return cmp_le(abs(a), set1(FLT_MAX)); }
+
+/** Per-lane (mask ? a : b) */
+inline f32x4 select(m32x4 m, f32x4 a, f32x4 b) {
+    f32x4 r; for (int i = 0; i < 4; ++i) r.v[i] = m.v[i] ? a.v[i] : b.v[i]; return r;
+}
+
+inline bool all(m32x4 m) { return m.v[0] && m.v[1] && m.v[2] && m.v[3]; }
+inline bool any(m32x4 m) { return m.v[0] || m.v[1] || m.v[2] || m.v[3]; }
+
+/** [x0, x1, x2, x3] -> [x0, x1, x0, x1] */
+inline f32x4 dup_pair(f32x4 x) { return {{x.v[0], x.v[1], x.v[0], x.v[1]}}; }
+
+/** [x0, x1, x2, x3] -> [x0 + x2, x1 + x3, 0, 0] */
+inline f32x4 fold_pairs(f32x4 x) { return {{x.v[0] + x.v[2], x.v[1] + x.v[3], 0.0f, 0.0f}}; }
+
+#endif
+
+/** Multiply-add a * b + c (unfused, see file comment) */
+inline f32x4 mul_add(f32x4 a, f32x4 b, f32x4 c) { return a * b + c; }
+
+/** Extract a single lane (not for use in inner loops) */
+inline float lane(f32x4 x, int index) {
+    float tmp[4];
+    store(tmp, x);
+    return tmp[index];
+}
+
+// ----------------------------------------------------------------------------
+// Native-width interface used by the width-generic kernels (4 lanes here;
+// simd_avx2.h provides an 8-lane version)
+// ----------------------------------------------------------------------------
+
+using vec = f32x4;
+constexpr uint32_t kWidth = 4;
+
+inline vec vzero() { return zero(); }
+inline vec vset1(float x) { return set1(x); }
+inline vec vload(const float* p) { return load(p); }
+
+/** Repeat a [L, R, -, -] pair across the vector */
+inline vec widen_pair(f32x4 x) { return dup_pair(x); }
+
+/** Sum all [L, R] lane pairs into lanes 0/1 (lanes 2/3 zero) */
+inline f32x4 narrow_pairs(vec x) { return fold_pairs(x); }
+
+/** Largest lane */
+inline float reduce_max(vec x) {
+    float tmp[4];
+    store(tmp, x);
+    return std::fmax(std::fmax(tmp[0], tmp[1]), std::fmax(tmp[2], tmp[3]));
+}
+
+} // namespace simd
+} // namespace radioform
+
+#endif // RADIOFORM_SIMD_H
@@ -0,0 +1,160 @@
+/**
+ * @file simd_avx2.h
+ * @brief AVX2/FMA counterpart of simd.h
+ *
+ * Same operations as simd.h in namespace simd_avx2, plus an 8-lane type
+ * (f32x8) for the planar kernels. mul_add() is fused here.
+ *
+ * Must only be included inside an AVX2/FMA target region (see
+ * kernels_avx2.cpp): every function in this file is compiled for AVX2, and
+ * nothing from it may be called before the dispatcher has checked the CPU.
+ */
+
+#ifndef RADIOFORM_SIMD_AVX2_H
+#define RADIOFORM_SIMD_AVX2_H
+
+#include <immintrin.h>
+#include <cstdint>
+#include <cfloat>
+
+namespace radioform {
+namespace simd_avx2 {
+
+// ----------------------------------------------------------------------------
+// 4 lanes (stereo pair kernels)
+// ----------------------------------------------------------------------------
+
+struct f32x4 { __m128 v; };
+struct m32x4 { __m128 v; };
+
+inline f32x4 zero() { return {_mm_setzero_ps()}; }
+inline f32x4 set1(float x) { return {_mm_set1_ps(x)}; }
+inline f32x4 set(float a, float b, float c, float d) { return {_mm_setr_ps(a, b, c, d)}; }
+inline f32x4 load(const float* p) { return {_mm_loadu_ps(p)}; }
+inline void store(float* p, f32x4 x) { _mm_storeu_ps(p, x.v); }
+
+/** Load two consecutive floats into lanes 0/1 (lanes 2/3 are zero) */
+inline f32x4 load2(const float* p) {
+    return {_mm_castpd_ps(_mm_load_sd(reinterpret_cast<const double*>(p)))};
+}
+
+/** Store lanes 0/1 to two consecutive floats */
+inline void store2(float* p, f32x4 x) {
+    _mm_store_sd(reinterpret_cast<double*>(p), _mm_castps_pd(x.v));
+}
+
+inline f32x4 operator+(f32x4 a, f32x4 b) { return {_mm_add_ps(a.v, b.v)}; }
+inline f32x4 operator-(f32x4 a, f32x4 b) { return {_mm_sub_ps(a.v, b.v)}; }
+inline f32x4 operator*(f32x4 a, f32x4 b) { return {_mm_mul_ps(a.v, b.v)}; }
+inline f32x4 operator/(f32x4 a, f32x4 b) { return {_mm_div_ps(a.v, b.v)}; }
+inline f32x4 min(f32x4 a, f32x4 b) { return {_mm_min_ps(a.v, b.v)}; }
+inline f32x4 max(f32x4 a, f32x4 b) { return {_mm_max_ps(a.v, b.v)}; }
+
+inline f32x4 abs(f32x4 a) {
+    return {_mm_and_ps(a.v, _mm_castsi128_ps(_mm_set1_epi32(0x7fffffff)))};
+}
+
+/** Magnitude of @p mag with the sign of @p sign */
+inline f32x4 copysign(f32x4 mag, f32x4 sign) {
+    const __m128 sign_mask = _mm_castsi128_ps(_mm_set1_epi32(static_cast<int>(0x80000000u)));
+    return {_mm_or_ps(_mm_andnot_ps(sign_mask, mag.v), _mm_and_ps(sign_mask, sign.v))};
+}
+
+inline m32x4 cmp_le(f32x4 a, f32x4 b) { return {_mm_cmp_ps(a.v, b.v, _CMP_LE_OQ)}; }
+inline m32x4 cmp_gt(f32x4 a, f32x4 b) { return {_mm_cmp_ps(a.v, b.v, _CMP_GT_OQ)}; }
+
+/** Lane mask: true where the value is neither NaN nor infinite */
+inline m32x4 is_finite(f32x4 a) { return cmp_le(abs(a), set1(FLT_MAX)); }
+
+/** Per-lane (mask ? a : b) */
+inline f32x4 select(m32x4 m, f32x4 a, f32x4 b) { return {_mm_blendv_ps(b.v, a.v, m.v)}; }
+
+inline bool all(m32x4 m) { return _mm_movemask_ps(m.v) == 0xF; }
+inline bool any(m32x4 m) { return _mm_movemask_ps(m.v) != 0; }
+
+/** [x0, x1, x2, x3] -> [x0, x1, x0, x1] */
+inline f32x4 dup_pair(f32x4 x) { return {_mm_movelh_ps(x.v, x.v)}; }
+
+/** [x0, x1, x2, x3] -> [x0 + x2, x1 + x3, 0, 0] */
+inline f32x4 fold_pairs(f32x4 x) {
+    const __m128 sum = _mm_add_ps(x.v, _mm_movehl_ps(x.v, x.v));
+    return {_mm_blend_ps(sum, _mm_setzero_ps(), 0xC)};
+}
+
+/** Fused multiply-add a * b + c */
+inline f32x4 mul_add(f32x4 a, f32x4 b, f32x4 c) { return {_mm_fmadd_ps(a.v, b.v, c.v)}; }
+
+/** Extract a single lane (not for use in inner loops) */
+inline float lane(f32x4 x, int index) {
+    float tmp[4];
+    store(tmp, x);
+    return tmp[index];
+}
+
+// ----------------------------------------------------------------------------
+// 8 lanes (planar kernels)
+// ----------------------------------------------------------------------------
+
+struct f32x8 { __m256 v; };
+struct m32x8 { __m256 v; };
+
+inline void store(float* p, f32x8 x) { _mm256_storeu_ps(p, x.v); }
+
+inline f32x8 operator+(f32x8 a, f32x8 b) { return {_mm256_add_ps(a.v, b.v)}; }
+inline f32x8 operator-(f32x8 a, f32x8 b) { return {_mm256_sub_ps(a.v, b.v)}; }
+inline f32x8 operator*(f32x8 a, f32x8 b) { return {_mm256_mul_ps(a.v, b.v)}; }
+inline f32x8 operator/(f32x8 a, f32x8 b) { return {_mm256_div_ps(a.v, b.v)}; }
+inline f32x8 min(f32x8 a, f32x8 b) { return {_mm256_min_ps(a.v, b.v)}; }
+inline f32x8 max(f32x8 a, f32x8 b) { return {_mm256_max_ps(a.v, b.v)}; }
+
+inline f32x8 abs(f32x8 a) {
+    return {_mm256_and_ps(a.v, _mm256_castsi256_ps(_mm256_set1_epi32(0x7fffffff)))};
+}
+
+inline f32x8 copysign(f32x8 mag, f32x8 sign) {
+    const __m256 sign_mask = _mm256_castsi256_ps(_mm256_set1_epi32(static_cast<int>(0x80000000u)));
+    return {_mm256_or_ps(_mm256_andnot_ps(sign_mask, mag.v), _mm256_and_ps(sign_mask, sign.v))};
+}
+
+inline m32x8 cmp_le(f32x8 a, f32x8 b) { return {_mm256_cmp_ps(a.v, b.v, _CMP_LE_OQ)}; }
+inline m32x8 cmp_gt(f32x8 a, f32x8 b) { return {_mm256_cmp_ps(a.v, b.v, _CMP_GT_OQ)}; }
+inline m32x8 is_finite(f32x8 a) { return cmp_le(abs(a), f32x8{_mm256_set1_ps(FLT_MAX)}); }
+inline f32x8 select(m32x8 m, f32x8 a, f32x8 b) { return {_mm256_blendv_ps(b.v, a.v, m.v)}; }
+inline bool all(m32x8 m) { return _mm256_movemask_ps(m.v) == 0xFF; }
+inline f32x8 mul_add(f32x8 a, f32x8 b, f32x8 c) { return {_mm256_fmadd_ps(a.v, b.v, c.v)}; }
+
+// ----------------------------------------------------------------------------
+// Native-width interface used by the width-generic kernels
+// ----------------------------------------------------------------------------
+
+using vec = f32x8;
+constexpr uint32_t kWidth = 8;
+
+inline vec vzero() { return {_mm256_setzero_ps()}; }
+inline vec vset1(float x) { return {_mm256_set1_ps(x)}; }
+inline vec vload(const float* p) { return {_mm256_loadu_ps(p)}; }
+
+/** Repeat a [L, R, -, -] pair across the vector */
+inline vec widen_pair(f32x4 x) {
+    const __m128 pair = dup_pair(x).v;
+    return {_mm256_insertf128_ps(_mm256_castps128_ps256(pair), pair, 1)};
+}
+
+/** Sum all [L, R] lane pairs into lanes 0/1 (lanes 2/3 zero) */
+inline f32x4 narrow_pairs(vec x) {
+    const f32x4 halves = {_mm_add_ps(_mm256_castps256_ps128(x.v), _mm256_extractf128_ps(x.v, 1))};
+    return fold_pairs(halves);
+}
+
+/** Largest lane */
+inline float reduce_max(vec x) {
+    __m128 m = _mm_max_ps(_mm256_castps256_ps128(x.v), _mm256_extractf128_ps(x.v, 1));
+    m = _mm_max_ps(m, _mm_movehl_ps(m, m));
+    m = _mm_max_ss(m, _mm_shuffle_ps(m, m, 1));
+    return _mm_cvtss_f32(m);
+}
+
+} // namespace simd_avx2
+} // namespace radioform
+
+#endif // RADIOFORM_SIMD_AVX2_H
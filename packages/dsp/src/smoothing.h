@@ -113,6 +113,13 @@ public:
      */
     float getTarget() const { return target_; }
 
+    /**
+     * @brief Coefficients and velocity (for vectorized kernels)
+     */
+    float coefficient() const { return coeff_; }
+    float velocityCoefficient() const { return velocity_coeff_; }
+    float velocity() const { return velocity_; }
+
 private:
     float sample_rate_ = 48000.0f;
     float coeff_ = 0.0f;
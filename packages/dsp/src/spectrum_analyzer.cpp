@@ -0,0 +1,189 @@
+/**
+ * @file spectrum_analyzer.cpp
+ * @brief Spectrum tap and analyzer implementation
+ */
+
+#include "spectrum_analyzer.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace radioform {
+
+namespace {
+
+constexpr uint32_t kMinFftSize = 256;
+constexpr float kFloorDb = -120.0f;
+
+float power_to_db(float power) {
+    return power > 1e-12f ? 10.0f * std::log10(power) : kFloorDb;
+}
+
+} // namespace
+
+// ============================================================================
+// SpectrumTap
+// ============================================================================
+
+void SpectrumTap::write(const float* left, const float* right, uint32_t stride, uint32_t num_frames) {
+    uint32_t queued = 0;
+    if (stride == 2 && right == left + 1) {
+        queued = ring_.push(left, num_frames * 2) / 2;
+    } else {
+        constexpr uint32_t kChunkFrames = 64;
+        float frames[kChunkFrames * 2];
+        while (queued < num_frames) {
+            const uint32_t count = std::min(kChunkFrames, num_frames - queued);
+            for (uint32_t i = 0; i < count; i++) {
+                frames[i * 2] = left[(queued + i) * stride];
+                frames[i * 2 + 1] = right[(queued + i) * stride];
+            }
+            const uint32_t pushed = ring_.push(frames, count * 2) / 2;
+            queued += pushed;
+            if (pushed < count) {
+                break;
+            }
+        }
+    }
+    if (queued < num_frames) {
+        dropped_.fetch_add(num_frames - queued, std::memory_order_relaxed);
+    }
+}
+
+uint32_t SpectrumTap::read(float* frames, uint32_t max_frames) {
+    return ring_.pop(frames, max_frames * 2) / 2;
+}
+
+// ============================================================================
+// SpectrumAnalyzer
+// ============================================================================
+
+bool SpectrumAnalyzer::validate(const radioform_spectrum_config_t& config, float sample_rate) {
+    const uint32_t n = config.fft_size;
+    return n >= kMinFftSize && n <= RealFFT::kMaxSize && (n & (n - 1)) == 0
+        && config.num_bins >= 1 && config.num_bins <= RADIOFORM_MAX_SPECTRUM_BINS
+        && config.min_frequency_hz > 0.0f
+        && config.min_frequency_hz < config.max_frequency_hz
+        && config.max_frequency_hz <= 0.5f * sample_rate
+        && std::isfinite(config.averaging_ms) && config.averaging_ms >= 0.0f
+        && std::isfinite(config.peak_hold_ms) && config.peak_hold_ms >= 0.0f
+        && std::isfinite(config.peak_fall_db_per_s) && config.peak_fall_db_per_s >= 0.0f;
+}
+
+void SpectrumAnalyzer::configure(const radioform_spectrum_config_t& config, float sample_rate) {
+    config_ = config;
+    sample_rate_ = sample_rate;
+    const uint32_t n = config.fft_size;
+    fft_.init(n);
+    hop_ = n / 2;
+
+    // Periodic Hann window (sums to n / 2): a sine of amplitude A peaks at
+    // A * n / 4 in the transform
+    const double pi = 3.14159265358979323846;
+    for (uint32_t i = 0; i < n; i++) {
+        window_[i] = static_cast<float>(0.5 - 0.5 * std::cos(2.0 * pi * i / n));
+    }
+    power_scale_ = 16.0f / (static_cast<float>(n) * static_cast<float>(n));
+
+    const float hop_seconds = static_cast<float>(hop_) / sample_rate;
+    average_alpha_ = config.averaging_ms > 0.0f
+        ? 1.0f - std::exp(-hop_seconds * 1000.0f / config.averaging_ms)
+        : 1.0f;
+    peak_fall_db_ = config.peak_fall_db_per_s * hop_seconds;
+    peak_hold_frames_ = static_cast<uint32_t>(std::ceil(config.peak_hold_ms / 1000.0f / hop_seconds));
+
+    // Bands: FFT bins k with k * df in [lo, hi)
+    const double df = static_cast<double>(sample_rate) / n;
+    const double ratio = static_cast<double>(config.max_frequency_hz) / config.min_frequency_hz;
+    for (uint32_t b = 0; b < config.num_bins; b++) {
+        const double lo = config.min_frequency_hz * std::pow(ratio, static_cast<double>(b) / config.num_bins);
+        const double hi = config.min_frequency_hz * std::pow(ratio, static_cast<double>(b + 1) / config.num_bins);
+        const double centre = std::sqrt(lo * hi);
+        band_centre_[b] = static_cast<float>(centre);
+        const uint32_t first = static_cast<uint32_t>(std::ceil(lo / df));
+        const uint32_t end = std::min(static_cast<uint32_t>(std::ceil(hi / df)), n / 2 + 1);
+        if (end > first) {
+            band_first_[b] = first;
+            band_count_[b] = end - first;
+            band_frac_[b] = 0.0f;
+        } else {
+            const double position = centre / df;
+            band_first_[b] = std::min(static_cast<uint32_t>(position), n / 2 - 1);
+            band_count_[b] = 0;
+            band_frac_[b] = static_cast<float>(position - band_first_[b]);
+        }
+        average_power_[b] = 0.0f;
+        peak_db_[b] = kFloorDb;
+        peak_hold_[b] = 0;
+    }
+
+    input_fill_ = 0;
+    frames_analyzed_ = 0;
+}
+
+void SpectrumAnalyzer::analyze(SpectrumTap& tap, radioform_spectrum_t& result) {
+    // At most one ring's worth, so a producer that keeps up cannot keep us here
+    const uint32_t n = config_.fft_size;
+    for (uint32_t total = 0; total < SpectrumTap::kCapacityFrames;) {
+        const uint32_t frames = tap.read(read_, kReadFrames);
+        if (frames == 0) {
+            break;
+        }
+        for (uint32_t i = 0; i < frames; i++) {
+            const float mono = 0.5f * (read_[i * 2] + read_[i * 2 + 1]);
+            input_[input_fill_++] = std::isfinite(mono) ? mono : 0.0f;
+            if (input_fill_ == n) {
+                analyzeFrame();
+                std::memmove(input_, input_ + hop_, (n - hop_) * sizeof(float));
+                input_fill_ = n - hop_;
+            }
+        }
+        frames_analyzed_ += frames;
+        total += frames;
+    }
+
+    result.num_bins = config_.num_bins;
+    for (uint32_t b = 0; b < config_.num_bins; b++) {
+        result.frequency_hz[b] = band_centre_[b];
+        result.magnitude_db[b] = power_to_db(average_power_[b]);
+        result.peak_db[b] = peak_db_[b];
+    }
+    result.frames_analyzed = frames_analyzed_;
+    result.frames_dropped = tap.droppedFrames();
+}
+
+void SpectrumAnalyzer::analyzeFrame() {
+    const uint32_t n = config_.fft_size;
+    for (uint32_t i = 0; i < n; i++) {
+        windowed_[i] = input_[i] * window_[i];
+    }
+    fft_.powerSpectrum(windowed_, power_);
+
+    for (uint32_t b = 0; b < config_.num_bins; b++) {
+        const uint32_t first = band_first_[b];
+        float power;
+        if (band_count_[b] > 0) {
+            power = *std::max_element(power_ + first, power_ + first + band_count_[b]);
+        } else {
+            power = power_[first] + (power_[first + 1] - power_[first]) * band_frac_[b];
+        }
+        power *= power_scale_;
+
+        average_power_[b] += average_alpha_ * (power - average_power_[b]);
+
+        // Levels within one frame's fall of the peak renew the hold, so
+        // frame-to-frame jitter of a steady signal does not let it run out
+        const float level = power_to_db(power);
+        if (level >= peak_db_[b] - peak_fall_db_) {
+            peak_db_[b] = std::max(peak_db_[b], level);
+            peak_hold_[b] = peak_hold_frames_;
+        } else if (peak_hold_[b] > 0) {
+            peak_hold_[b]--;
+        } else {
+            peak_db_[b] = std::max(level, peak_db_[b] - peak_fall_db_);
+        }
+    }
+}
+
+} // namespace radioform
@@ -0,0 +1,120 @@
+/**
+ * @file spectrum_analyzer.h
+ * @brief Output spectrum tap (audio thread) and log-frequency analyzer (UI thread)
+ *
+ * The audio thread copies output frames (first two channels, interleaved)
+ * into a wait-free SPSC ring; for interleaved stereo output that is a
+ * single copy of the buffer. The analyzer drains the ring on the calling
+ * thread, downmixes to mono and runs Hann-windowed real FFTs with 50%
+ * overlap. FFT bins are gathered into log-spaced bands (the API's bins):
+ * the largest bin in each band, or the level interpolated at its centre
+ * when the band falls between two bins. Band powers are exponentially
+ * averaged, and a peak level is held per band before falling at a fixed
+ * rate.
+ *
+ * Levels are scaled so a full-scale sine reads 0 dB. No allocation.
+ */
+
+#ifndef RADIOFORM_SPECTRUM_ANALYZER_H
+#define RADIOFORM_SPECTRUM_ANALYZER_H
+
+#include "radioform_types.h"
+#include "fft.h"
+#include "parameter_queue.h"
+
+#include <atomic>
+#include <cstdint>
+
+namespace radioform {
+
+/**
+ * @brief Ring of interleaved stereo output frames (one producer, one consumer)
+ */
+class SpectrumTap {
+public:
+    // ~340 ms at 48 kHz; frames that do not fit are dropped and counted
+    static constexpr uint32_t kCapacityFrames = 16384;
+
+    /**
+     * @brief Queue frames (audio thread)
+     *
+     * Sample i of each channel is left[i * stride], right[i * stride].
+     * Interleaved stereo (right == left + 1, stride 2) is copied as is.
+     */
+    void write(const float* left, const float* right, uint32_t stride, uint32_t num_frames);
+
+    /**
+     * @brief Take up to max_frames interleaved frames (analysis thread)
+     *
+     * @return Frames taken
+     */
+    uint32_t read(float* frames, uint32_t max_frames);
+
+    uint64_t droppedFrames() const { return dropped_.load(std::memory_order_relaxed); }
+
+private:
+    // Only whole frames go in and out, so the ring always holds an even count
+    SpscQueue<float, kCapacityFrames * 2> ring_;
+    std::atomic<uint64_t> dropped_{0};
+};
+
+class SpectrumAnalyzer {
+public:
+    /**
+     * @brief Check a configuration against the sample rate
+     */
+    static bool validate(const radioform_spectrum_config_t& config, float sample_rate);
+
+    /**
+     * @brief Apply a validated configuration and clear the analysis state
+     */
+    void configure(const radioform_spectrum_config_t& config, float sample_rate);
+
+    const radioform_spectrum_config_t& config() const { return config_; }
+    float sampleRate() const { return sample_rate_; }
+
+    /**
+     * @brief Analyze everything queued on the tap and report the bands
+     */
+    void analyze(SpectrumTap& tap, radioform_spectrum_t& result);
+
+private:
+    static constexpr uint32_t kMaxBins = RealFFT::kMaxSize / 2 + 1;
+    static constexpr uint32_t kReadFrames = 512;
+
+    // Window and transform the current analysis frame, then update the bands
+    void analyzeFrame();
+
+    radioform_spectrum_config_t config_ = {};
+    float sample_rate_ = 48000.0f;
+    RealFFT fft_;
+    uint32_t hop_ = 0;
+    float power_scale_ = 1.0f;   // Full-scale sine to 1.0
+    float average_alpha_ = 1.0f;
+    float peak_fall_db_ = 0.0f;  // Per analysis frame
+    uint32_t peak_hold_frames_ = 0;  // Analysis frames a peak is held
+    uint64_t frames_analyzed_ = 0;
+
+    // Band b covers FFT bins [band_first_[b], band_first_[b] + band_count_[b]);
+    // empty bands interpolate between bins band_first_[b] and + 1 by band_frac_[b]
+    uint32_t band_first_[RADIOFORM_MAX_SPECTRUM_BINS];
+    uint32_t band_count_[RADIOFORM_MAX_SPECTRUM_BINS];
+    float band_frac_[RADIOFORM_MAX_SPECTRUM_BINS];
+    float band_centre_[RADIOFORM_MAX_SPECTRUM_BINS];
+
+    float average_power_[RADIOFORM_MAX_SPECTRUM_BINS];
+    float peak_db_[RADIOFORM_MAX_SPECTRUM_BINS];
+    uint32_t peak_hold_[RADIOFORM_MAX_SPECTRUM_BINS];  // Analysis frames left before falling
+
+    // Mono input (input_fill_ samples) and per-frame scratch
+    uint32_t input_fill_ = 0;
+    float input_[RealFFT::kMaxSize];
+    float window_[RealFFT::kMaxSize];
+    float windowed_[RealFFT::kMaxSize];
+    float power_[kMaxBins];
+    float read_[kReadFrames * 2];
+};
+
+} // namespace radioform
+
+#endif // RADIOFORM_SPECTRUM_ANALYZER_H
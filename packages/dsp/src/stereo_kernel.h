@@ -0,0 +1,95 @@
+/**
+ * @file stereo_kernel.h
+ * @brief Vectorized stereo processing chain for interleaved buffers
+ *
+ * Keeps the left and right channel in lanes 0/1 of one SIMD register for the
+ * whole chain (preamp -> biquads -> DC blocker -> limiter -> peak), loading
+ * and storing interleaved frames directly. One vector op replaces the two
+ * scalar ops of the per-channel path in biquad.h.
+ *
+ * Two flavours exist:
+ * - Steady-state kernels, specialized at compile time on band count and
+ *   limiter state. The frame loop has no configuration branches. The engine
+ *   picks one from a table in radioform_dsp_apply_preset().
+ * - A generic kernel that also handles a preamp ramp. It is only used for
+ *   buffers in which the preamp is moving.
+ *
+ * Coefficient ramps never reach the kernels: they are stepped between
+ * kernel calls (Biquad::stepRamp, every kRampBlockFrames frames), so the
+ * coefficients are fixed for the duration of every call.
+ *
+ * The cascade is read from a BiquadBank (biquad_bank.h).
+ *
+ * Both exist for the serial biquad cascade and for the parallel form
+ * (parallel_eq.h), once per instruction set. This header holds the types
+ * they share; the kernels themselves are in kernels_impl.h and are reached
+ * through the dispatch table (dispatch.h).
+ */
+
+#ifndef RADIOFORM_STEREO_KERNEL_H
+#define RADIOFORM_STEREO_KERNEL_H
+
+#include "radioform_types.h"
+#include "biquad_bank.h"
+#include "smoothing.h"
+#include "limiter.h"
+#include "dc_blocker.h"
+#include "parallel_eq.h"
+
+#include <cstdint>
+
+namespace radioform {
+
+/**
+ * @brief Processing chain for the stereo kernels
+ *
+ * Built by the engine when a preset is applied. The cascade holds only the
+ * enabled bands (packed, in processing order). When parallel is set the EQ
+ * runs in parallel form and the cascade only holds coefficients.
+ */
+struct StereoChain {
+    BiquadBank* cascade;
+    ParallelEQ* parallel;  // nullptr when the cascade is active
+    ParameterSmoother* preamp;
+    StereoDCBlocker* dc_blocker;
+    const SoftLimiter* limiter;  // nullptr when the limiter is disabled
+};
+
+/**
+ * @brief Per-buffer peak levels (linear)
+ */
+struct StereoPeak {
+    float left;
+    float right;
+};
+
+/**
+ * @brief Signature shared by all stereo kernels
+ */
+using StereoKernelFn = StereoPeak (*)(
+    const StereoChain& chain,
+    const float* input,
+    float* output,
+    uint32_t num_frames
+);
+
+/**
+ * @brief Kernels for one chain configuration
+ */
+struct StereoKernels {
+    StereoKernelFn steady;   // Fixed preamp gain
+    StereoKernelFn ramping;  // Used while stereo_chain_ramping() is true
+};
+
+/**
+ * @brief Whether the preamp is ramping
+ *
+ * Checked once per kernel call to choose between steady-state and generic kernels.
+ */
+inline bool stereo_chain_ramping(const StereoChain& chain) {
+    return !chain.preamp->isStable();
+}
+
+} // namespace radioform
+
+#endif // RADIOFORM_STEREO_KERNEL_H
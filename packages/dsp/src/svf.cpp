@@ -0,0 +1,143 @@
+/**
+ * @file svf.cpp
+ * @brief Trapezoidal state-variable filter processing and design
+ *
+ * Compiled without associative math (see CMakeLists.txt): the integrator
+ * updates must stay in the form 2 * v - ic.
+ */
+
+#include "svf.h"
+
+#include <cmath>
+
+namespace radioform {
+
+namespace {
+
+inline float process_sample(float x, SvfState& s, float a1, float a2, float a3,
+                            float m0, float m1, float m2) {
+    const float v3 = x - s.ic2;
+    const float v1 = a1 * s.ic1 + a2 * v3;
+    const float v2 = s.ic2 + a2 * s.ic1 + a3 * v3;
+    s.ic1 = 2.0f * v1 - s.ic1;
+    s.ic2 = 2.0f * v2 - s.ic2;
+    return m0 * x + m1 * v1 + m2 * v2;
+}
+
+// NaN policy shared with the biquads: clear the state, pass the input through
+inline float guard(float y, float x, SvfState& s) {
+    if (!std::isfinite(y)) {
+        s = {};
+        return x;
+    }
+    return y;
+}
+
+} // namespace
+
+void StateVariableFilter::processPlanar(float* left, float* right, uint32_t num_frames) {
+    const float a1 = gains_[0], a2 = gains_[1], a3 = gains_[2];
+    const float m0 = params_.m0, m1 = params_.m1, m2 = params_.m2;
+    SvfState sl = state_[0];
+    SvfState sr = state_[1];
+
+    for (uint32_t i = 0; i < num_frames; i++) {
+        const float xl = left[i];
+        const float xr = right[i];
+        left[i] = guard(process_sample(xl, sl, a1, a2, a3, m0, m1, m2), xl, sl);
+        right[i] = guard(process_sample(xr, sr, a1, a2, a3, m0, m1, m2), xr, sr);
+    }
+
+    state_[0] = sl;
+    state_[1] = sr;
+}
+
+void StateVariableFilter::processInterleaved(float* data, uint32_t num_frames) {
+    const float a1 = gains_[0], a2 = gains_[1], a3 = gains_[2];
+    const float m0 = params_.m0, m1 = params_.m1, m2 = params_.m2;
+    SvfState sl = state_[0];
+    SvfState sr = state_[1];
+
+    for (uint32_t i = 0; i < num_frames; i++) {
+        const float xl = data[i * 2];
+        const float xr = data[i * 2 + 1];
+        data[i * 2] = guard(process_sample(xl, sl, a1, a2, a3, m0, m1, m2), xl, sl);
+        data[i * 2 + 1] = guard(process_sample(xr, sr, a1, a2, a3, m0, m1, m2), xr, sr);
+    }
+
+    state_[0] = sl;
+    state_[1] = sr;
+}
+
+SvfCoeffs StateVariableFilter::calculateCoeffs(const radioform_band_t& band, float sample_rate) {
+    // Same bilinear-transform prototypes as Biquad::calculateCoeffs()
+    // (Simper, "Solving the continuous SVF equations using trapezoidal
+    // integration and equivalent currents")
+    const double pi = 3.14159265358979323846;
+    const double w0 = 2.0 * pi * static_cast<double>(band.frequency_hz) / sample_rate;
+    const double g = std::tan(0.5 * w0);
+    const double A = std::pow(10.0, static_cast<double>(band.gain_db) / 40.0);
+
+    // The biquads' bandwidth warp (alpha scaled by sin(w0) / w0 from
+    // w0 = 0.01 up) applies to every type but the shelves. Bands only pick
+    // the SVF on their own below w0 = 0.0063; pinned ones can be anywhere.
+    const double k_shelf = 1.0 / static_cast<double>(band.q_factor);
+    const double k = (w0 < 0.01 ? 1.0 : std::sin(w0) / w0) * k_shelf;
+
+    double cg = g, ck = k, m0 = 1.0, m1 = 0.0, m2 = 0.0;
+    switch (band.type) {
+        case RADIOFORM_FILTER_PEAK:
+            ck = k / A;
+            m1 = ck * (A * A - 1.0);
+            break;
+
+        case RADIOFORM_FILTER_LOW_SHELF:
+            cg = g / std::sqrt(A);
+            ck = k_shelf;
+            m1 = k_shelf * (A - 1.0);
+            m2 = A * A - 1.0;
+            break;
+
+        case RADIOFORM_FILTER_HIGH_SHELF:
+            cg = g * std::sqrt(A);
+            ck = k_shelf;
+            m0 = A * A;
+            m1 = k_shelf * (1.0 - A) * A;
+            m2 = 1.0 - A * A;
+            break;
+
+        case RADIOFORM_FILTER_LOW_PASS:
+            m0 = 0.0;
+            m2 = 1.0;
+            break;
+
+        case RADIOFORM_FILTER_HIGH_PASS:
+            m1 = -k;
+            m2 = -1.0;
+            break;
+
+        case RADIOFORM_FILTER_NOTCH:
+            m1 = -k;
+            break;
+
+        case RADIOFORM_FILTER_BAND_PASS:
+            // 0 dB peak gain, like the biquad
+            m0 = 0.0;
+            m1 = k;
+            break;
+
+        default:
+            // Flat
+            break;
+    }
+
+    SvfCoeffs c = {static_cast<float>(cg), static_cast<float>(ck),
+                   static_cast<float>(m0), static_cast<float>(m1), static_cast<float>(m2)};
+    if (!std::isfinite(c.g) || !std::isfinite(c.k) || !std::isfinite(c.m0) ||
+        !std::isfinite(c.m1) || !std::isfinite(c.m2)) {
+        c = {0.0f, 1.0f, 1.0f, 0.0f, 0.0f};
+    }
+    return c;
+}
+
+} // namespace radioform
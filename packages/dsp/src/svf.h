@@ -0,0 +1,198 @@
+/**
+ * @file svf.h
+ * @brief Trapezoidal state-variable filter for low-frequency bands
+ *
+ * At small f/fs a biquad's a1/a2 approach -2/+1, so single precision keeps
+ * only a few significant bits of the pole positions (1 - cos(w0) ~ w0^2 / 2),
+ * and the TDF2 state amplifies rounding noise. The trapezoidal SVF (Andrew
+ * Simper, Cytomic) is parameterized by g = tan(pi f / fs) and k = 1 / Q,
+ * which keep full relative precision as f/fs -> 0, and its integrator states
+ * have low noise gain. Like the RBJ biquads it is a bilinear-transform
+ * design, so the response is the same for the same band parameters.
+ *
+ * The engine picks this topology per band when a preset is applied
+ * (svf_preferred()), or for bands pinned to it with
+ * radioform_dsp_set_band_topology(); all other bands stay on the biquad
+ * kernels. Any g > 0, k > 0 is stable, so edits can ramp as fast as the
+ * ramp steps allow without passing through an unstable filter.
+ */
+
+#ifndef RADIOFORM_SVF_H
+#define RADIOFORM_SVF_H
+
+#include "radioform_types.h"
+#include "biquad.h"
+
+#include <cstdint>
+
+namespace radioform {
+
+// Bands below this fraction of the sample rate run as an SVF
+// (48 Hz at 48 kHz, 192 Hz at 192 kHz)
+static constexpr float kSvfMaxRelativeFrequency = 0.001f;
+
+/**
+ * @brief Whether a band is better served by the SVF than by a float biquad
+ */
+inline bool svf_preferred(const radioform_band_t& band, float sample_rate) {
+    return band.frequency_hz < kSvfMaxRelativeFrequency * sample_rate;
+}
+
+/**
+ * @brief SVF design parameters
+ *
+ * Output is m0 * input + m1 * bandpass + m2 * lowpass.
+ */
+struct SvfCoeffs {
+    float g;   // tan(pi f / fs), shelves scale it by A^(-/+1/2)
+    float k;   // Damping (1 / Q)
+    float m0, m1, m2;
+};
+
+/**
+ * @brief SVF state (per channel)
+ */
+struct SvfState {
+    float ic1 = 0.0f;  // Integrator states
+    float ic2 = 0.0f;
+};
+
+/**
+ * @brief Trapezoidal SVF with state for up to RADIOFORM_MAX_CHANNELS channels
+ *
+ * Ramps step like Biquad::setCoeffsSmooth(): the design parameters are
+ * interpolated linearly, and any g > 0, k > 0 is a stable filter. The
+ * planar and interleaved stereo paths use channels 0/1; the multichannel
+ * kernel reads gains() and state() directly.
+ */
+class StateVariableFilter {
+public:
+    void init() {
+        reset();
+        setCoeffsFlat();
+    }
+
+    void reset() {
+        for (SvfState& state : state_) {
+            state = {};
+        }
+        if (ramp_remaining_ > 0) {
+            setParams(target_);
+            ramp_remaining_ = 0;
+        }
+    }
+
+    /**
+     * @brief Passthrough (m0 = 1, filter outputs unused)
+     */
+    void setCoeffsFlat() {
+        setParams({0.0f, 1.0f, 1.0f, 0.0f, 0.0f});
+        ramp_remaining_ = 0;
+    }
+
+    /**
+     * @brief Set coefficients from band configuration (instant)
+     */
+    void setCoeffs(const radioform_band_t& band, float sample_rate) {
+        setCoeffs(calculateCoeffs(band, sample_rate));
+    }
+
+    /**
+     * @brief Set precomputed design parameters (instant)
+     */
+    void setCoeffs(const SvfCoeffs& c) {
+        setParams(c);
+        ramp_remaining_ = 0;
+    }
+
+    /**
+     * @brief Ramp to a new band configuration in kRampBlockFrames steps
+     *
+     * The first step is taken immediately; stepRamp() takes the others.
+     */
+    void setCoeffsSmooth(const radioform_band_t& band, float sample_rate, int transition_samples) {
+        setCoeffsSmooth(calculateCoeffs(band, sample_rate), transition_samples);
+    }
+
+    /**
+     * @brief Ramp to precomputed design parameters (e.g. designed on another thread)
+     */
+    void setCoeffsSmooth(const SvfCoeffs& target, int transition_samples) {
+        target_ = target;
+        ramp_start_ = params_;
+        ramp_steps_ = ramp_step_count(transition_samples);
+        if (ramp_steps_ < 1) {
+            ramp_steps_ = 1;
+        }
+        ramp_remaining_ = ramp_steps_;
+        stepRamp();
+    }
+
+    void stepRamp() {
+        if (ramp_remaining_ <= 0) {
+            return;
+        }
+        if (--ramp_remaining_ == 0) {
+            setParams(target_);
+            return;
+        }
+
+        const float t = static_cast<float>(ramp_steps_ - ramp_remaining_) /
+                        static_cast<float>(ramp_steps_);
+        SvfCoeffs c;
+        c.g = ramp_start_.g + (target_.g - ramp_start_.g) * t;
+        c.k = ramp_start_.k + (target_.k - ramp_start_.k) * t;
+        c.m0 = ramp_start_.m0 + (target_.m0 - ramp_start_.m0) * t;
+        c.m1 = ramp_start_.m1 + (target_.m1 - ramp_start_.m1) * t;
+        c.m2 = ramp_start_.m2 + (target_.m2 - ramp_start_.m2) * t;
+        setParams(c);
+    }
+
+    int rampStepsRemaining() const { return ramp_remaining_; }
+    const SvfCoeffs& params() const { return params_; }
+
+    // Per-sample gains a1, a2, a3 (derived from g and k) and channel state,
+    // for the multichannel kernel
+    const float* gains() const { return gains_; }
+    SvfState& state(uint32_t channel) { return state_[channel]; }
+
+    /**
+     * @brief Filter planar stereo buffers in place
+     *
+     * Same NaN policy as the biquads: clear the channel's state and pass the
+     * input through.
+     */
+    void processPlanar(float* left, float* right, uint32_t num_frames);
+
+    /**
+     * @brief Filter an interleaved stereo buffer in place
+     */
+    void processInterleaved(float* data, uint32_t num_frames);
+
+    /**
+     * @brief Design parameters for a band (computed in double precision)
+     */
+    static SvfCoeffs calculateCoeffs(const radioform_band_t& band, float sample_rate);
+
+private:
+    void setParams(const SvfCoeffs& c) {
+        params_ = c;
+        gains_[0] = 1.0f / (1.0f + c.g * (c.g + c.k));
+        gains_[1] = c.g * gains_[0];
+        gains_[2] = c.g * gains_[1];
+    }
+
+    // Per-sample data first
+    float gains_[3];
+    SvfCoeffs params_;
+    SvfState state_[RADIOFORM_MAX_CHANNELS];
+
+    SvfCoeffs target_;
+    SvfCoeffs ramp_start_;
+    int ramp_steps_ = 0;
+    int ramp_remaining_ = 0;
+};
+
+} // namespace radioform
+
+#endif // RADIOFORM_SVF_H
@@ -0,0 +1,78 @@
+/**
+ * @file true_peak.cpp
+ * @brief True-peak meter implementation
+ */
+
+#include "true_peak.h"
+#include "simd.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace radioform {
+
+void TruePeakMeter::reset() {
+    std::memset(history_, 0, sizeof(history_));
+}
+
+float TruePeakMeter::process(uint32_t channel, const float* data, uint32_t stride, uint32_t num_frames,
+                             uint32_t& overs) {
+    using namespace simd;
+
+    constexpr uint32_t keep = kTruePeakTaps - 1;
+    float* history = history_[channel];
+    float* x = history + keep;
+    const f32x4 one = set1(1.0f);  // Full scale, and one frame over it
+
+    f32x4 peak = zero();
+    for (uint32_t offset = 0; offset < num_frames; offset += kChunkFrames) {
+        const uint32_t frames = std::min(kChunkFrames, num_frames - offset);
+        const float* src = data + static_cast<size_t>(offset) * stride;
+        for (uint32_t i = 0; i < frames; i++) {
+            const float sample = src[i * stride];
+            x[i] = std::isfinite(sample) ? sample : 0.0f;
+        }
+
+        const f32x4 end = set1(static_cast<float>(frames));
+        f32x4 chunk_overs = zero();
+        for (uint32_t i = 0; i < frames; i += 8) {
+            f32x4 a0 = zero(), a1 = zero(), a2 = zero(), a3 = zero();
+            f32x4 b0 = zero(), b1 = zero(), b2 = zero(), b3 = zero();
+            for (uint32_t j = 0; j < kTruePeakTaps; j++) {
+                const f32x4 xa = load(x + i - j);
+                const f32x4 xb = load(x + i + 4 - j);
+                const f32x4 c0 = set1(kTruePeakPhases[0][j]);
+                const f32x4 c1 = set1(kTruePeakPhases[1][j]);
+                const f32x4 c2 = set1(kTruePeakPhases[2][j]);
+                const f32x4 c3 = set1(kTruePeakPhases[3][j]);
+                a0 = mul_add(c0, xa, a0);
+                a1 = mul_add(c1, xa, a1);
+                a2 = mul_add(c2, xa, a2);
+                a3 = mul_add(c3, xa, a3);
+                b0 = mul_add(c0, xb, b0);
+                b1 = mul_add(c1, xb, b1);
+                b2 = mul_add(c2, xb, b2);
+                b3 = mul_add(c3, xb, b3);
+            }
+            f32x4 peak_a = max(max(max(abs(a0), abs(a1)), max(abs(a2), abs(a3))), abs(load(x + i)));
+            f32x4 peak_b = max(max(max(abs(b0), abs(b1)), max(abs(b2), abs(b3))), abs(load(x + i + 4)));
+
+            // Lanes past the end of the chunk hold stale samples
+            const float base = static_cast<float>(i);
+            peak_a = select(cmp_gt(end, set(base, base + 1.0f, base + 2.0f, base + 3.0f)), peak_a, zero());
+            peak_b = select(cmp_gt(end, set(base + 4.0f, base + 5.0f, base + 6.0f, base + 7.0f)), peak_b, zero());
+
+            peak = max(peak, max(peak_a, peak_b));
+            chunk_overs = chunk_overs + select(cmp_gt(peak_a, one), one, zero()) +
+                          select(cmp_gt(peak_b, one), one, zero());
+        }
+        const f32x4 folded = fold_pairs(chunk_overs);
+        overs += static_cast<uint32_t>(lane(folded, 0) + lane(folded, 1));
+
+        std::memmove(history, x + frames - keep, keep * sizeof(float));
+    }
+    return reduce_max(peak);
+}
+
+} // namespace radioform
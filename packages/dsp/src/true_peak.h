@@ -0,0 +1,75 @@
+/**
+ * @file true_peak.h
+ * @brief ITU-R BS.1770-4 Annex 2 true-peak interpolator and meter
+ *
+ * The interpolator upsamples 4x with four 12-tap polyphase branches; the
+ * true peak of a frame is the largest magnitude over its four phases and the
+ * sample itself. The lookahead limiter detects with it, and TruePeakMeter
+ * reports it for the engine statistics.
+ */
+
+#ifndef RADIOFORM_TRUE_PEAK_H
+#define RADIOFORM_TRUE_PEAK_H
+
+#include "radioform_types.h"
+
+#include <cstdint>
+
+namespace radioform {
+
+// Taps per interpolator phase
+inline constexpr uint32_t kTruePeakTaps = 12;
+
+// 4 phases of 12 taps (tap j weights the sample j frames back)
+inline constexpr float kTruePeakPhases[4][kTruePeakTaps] = {
+    { 0.0017089843750f,  0.0109863281250f, -0.0196533203125f,  0.0332031250000f,
+     -0.0594482421875f,  0.1373291015625f,  0.9721679687500f, -0.1022949218750f,
+      0.0476074218750f, -0.0266113281250f,  0.0148925781250f, -0.0083007812500f},
+    {-0.0291748046875f,  0.0292968750000f, -0.0517578125000f,  0.0891113281250f,
+     -0.1665039062500f,  0.4650878906250f,  0.7797851562500f, -0.2003173828125f,
+      0.1015625000000f, -0.0582275390625f,  0.0330810546875f, -0.0189208984375f},
+    {-0.0189208984375f,  0.0330810546875f, -0.0582275390625f,  0.1015625000000f,
+     -0.2003173828125f,  0.7797851562500f,  0.4650878906250f, -0.1665039062500f,
+      0.0891113281250f, -0.0517578125000f,  0.0292968750000f, -0.0291748046875f},
+    {-0.0083007812500f,  0.0148925781250f, -0.0266113281250f,  0.0476074218750f,
+     -0.1022949218750f,  0.9721679687500f,  0.1373291015625f, -0.0594482421875f,
+      0.0332031250000f, -0.0196533203125f,  0.0109863281250f,  0.0017089843750f},
+};
+
+/**
+ * @brief True-peak meter for up to RADIOFORM_MAX_CHANNELS channels
+ *
+ * Eight frames per pass (two vectors, four phases each: eight independent
+ * accumulators), max-reduced in registers and once per 64-frame chunk.
+ * No allocation.
+ */
+class TruePeakMeter {
+public:
+    /**
+     * @brief Clear the interpolator history
+     */
+    void reset();
+
+    /**
+     * @brief Meter one channel
+     *
+     * Sample i of the channel is data[i * stride]. Non-finite samples are
+     * metered as silence.
+     *
+     * @param overs Raised by the number of frames whose true peak is above
+     *        full scale (0 dBTP)
+     * @return The channel's true peak over the frames (linear)
+     */
+    float process(uint32_t channel, const float* data, uint32_t stride, uint32_t num_frames,
+                  uint32_t& overs);
+
+private:
+    static constexpr uint32_t kChunkFrames = 64;
+
+    // Previous kTruePeakTaps - 1 samples, then the chunk (padded to whole passes)
+    float history_[RADIOFORM_MAX_CHANNELS][kTruePeakTaps - 1 + kChunkFrames + 8] = {};
+};
+
+} // namespace radioform
+
+#endif // RADIOFORM_TRUE_PEAK_H
@@ -5,6 +5,7 @@
 
 #include "test_utils.h"
 #include "biquad.h"
+#include "biquad_bank.h"
 
 using namespace radioform;
 using namespace dsp_test;
@@ -261,3 +262,116 @@ TEST(biquad_reset_clears_state) {
 
     PASS();
 }
+
+TEST(biquad_smooth_transition_keeps_channels_matched) {
+    Biquad bq;
+    bq.init();
+
+    radioform_band_t band;
+    band.frequency_hz = 1000.0f;
+    band.gain_db = 0.0f;
+    band.q_factor = 1.0f;
+    band.type = RADIOFORM_FILTER_PEAK;
+    band.enabled = true;
+    bq.setCoeffs(band, 48000.0f);
+
+    // Ramp over 480 frames: 15 steps of kRampBlockFrames, the first one immediate
+    band.gain_db = 9.0f;
+    bq.setCoeffsSmooth(band, 48000.0f, 480);
+    ASSERT_EQ(bq.rampStepsRemaining(), 14);
+
+    auto input = generate_sine(1024, 1000.0f, 48000.0f);
+    std::vector<float> output_left(input.size());
+    std::vector<float> output_right(input.size());
+
+    for (size_t offset = 0; offset < input.size(); offset += kRampBlockFrames) {
+        bq.processBuffer(
+            input.data() + offset, input.data() + offset,
+            output_left.data() + offset, output_right.data() + offset,
+            kRampBlockFrames
+        );
+        bq.stepRamp();
+    }
+
+    // Identical input on both channels must give identical output while ramping
+    ASSERT(signals_identical(output_left, output_right));
+
+    // The ramp ends exactly on the target coefficients
+    Biquad target;
+    target.init();
+    target.setCoeffs(band, 48000.0f);
+    ASSERT_EQ(bq.rampStepsRemaining(), 0);
+    ASSERT_EQ(bq.coeffs().b0, target.coeffs().b0);
+    ASSERT_EQ(bq.coeffs().a1, target.coeffs().a1);
+    ASSERT_EQ(bq.coeffs().a2, target.coeffs().a2);
+
+    PASS();
+}
+
+TEST(biquad_ramp_steps_stay_stable) {
+    // Sharp low resonance to a wide high cut: a large jump in pole position
+    radioform_band_t from = {30.0f, 12.0f, 10.0f, RADIOFORM_FILTER_PEAK, true};
+    radioform_band_t to = {18000.0f, 0.0f, 0.1f, RADIOFORM_FILTER_LOW_PASS, true};
+
+    Biquad bq;
+    bq.init();
+    bq.setCoeffs(from, 48000.0f);
+    bq.setCoeffsSmooth(to, 48000.0f, 4800);
+
+    // Every step must lie inside the stability triangle |a2| < 1, |a1| < 1 + a2
+    int steps = 0;
+    while (bq.rampStepsRemaining() > 0) {
+        const BiquadCoeffs& c = bq.coeffs();
+        ASSERT(std::abs(c.a2) < 1.0f);
+        ASSERT(std::abs(c.a1) < 1.0f + c.a2);
+        bq.stepRamp();
+        steps++;
+    }
+    ASSERT_EQ(steps, 149);
+
+    PASS();
+}
+
+TEST(biquad_bank_matches_biquad) {
+    BiquadBank bank;
+    bank.init();
+
+    // Every field starts on its own cache line
+    ASSERT_EQ(reinterpret_cast<uintptr_t>(bank.b0_) % kCacheLineSize, 0u);
+    ASSERT_EQ(reinterpret_cast<uintptr_t>(bank.a2_) % kCacheLineSize, 0u);
+    ASSERT_EQ(reinterpret_cast<uintptr_t>(bank.z1_) % kCacheLineSize, 0u);
+    ASSERT_EQ(reinterpret_cast<uintptr_t>(bank.z2_) % kCacheLineSize, 0u);
+
+    Biquad reference[3];
+    const radioform_band_t bands[3] = {
+        {80.0f, 6.0f, 0.707f, RADIOFORM_FILTER_LOW_SHELF, true},
+        {1000.0f, -5.0f, 2.0f, RADIOFORM_FILTER_PEAK, true},
+        {6000.0f, 0.0f, 0.707f, RADIOFORM_FILTER_LOW_PASS, true},
+    };
+    for (uint32_t k = 0; k < 3; k++) {
+        reference[k].init();
+        reference[k].setCoeffs(bands[k], 48000.0f);
+        bank.setCoeffs(k, reference[k].coeffs());
+    }
+    bank.setNumSections(3);
+
+    auto left = generate_white_noise(512, 0.5f);
+    auto right = generate_sine(512, 300.0f, 48000.0f);
+    auto ref_left = left;
+    auto ref_right = right;
+    for (uint32_t k = 0; k < 3; k++) {
+        bank.processSection(k, left.data(), right.data(), 512);
+        reference[k].processBuffer(
+            ref_left.data(), ref_right.data(), ref_left.data(), ref_right.data(), 512);
+    }
+
+    // Same recursion; channels keep separate state
+    for (size_t i = 0; i < left.size(); i++) {
+        ASSERT_NEAR(left[i], ref_left[i], 1e-6f);
+        ASSERT_NEAR(right[i], ref_right[i], 1e-6f);
+    }
+    ASSERT_NEAR(bank.state(0, 2).z1, reference[2].stateLeft().z1, 1e-6f);
+    ASSERT_NEAR(bank.state(1, 2).z2, reference[2].stateRight().z2, 1e-6f);
+
+    PASS();
+}
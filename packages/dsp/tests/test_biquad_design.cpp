@@ -0,0 +1,75 @@
+/**
+ * @file test_biquad_design.cpp
+ * @brief Tests for the batch coefficient designer and its approximations
+ */
+
+#include "test_utils.h"
+#include "biquad_design.h"
+#include "fast_math.h"
+
+#include <algorithm>
+
+using namespace dsp_test;
+using namespace radioform;
+
+TEST(fast_math_error_is_bounded) {
+    double sin_error = 0.0, cos_error = 0.0, exp2_error = 0.0;
+    for (int i = -200000; i <= 200000; i += 4) {
+        float x[4], s[4], c[4], e[4];
+        for (int k = 0; k < 4; k++) {
+            x[k] = static_cast<float>(i + k) * 1e-4f;  // [-20, 20]
+        }
+        simd::f32x4 sin_x, cos_x;
+        fast_math::sincos(simd::load(x), sin_x, cos_x);
+        simd::store(s, sin_x);
+        simd::store(c, cos_x);
+        simd::store(e, fast_math::exp2(simd::load(x)));
+        for (int k = 0; k < 4; k++) {
+            const double xd = x[k];
+            sin_error = std::max(sin_error, std::abs(s[k] - std::sin(xd)));
+            cos_error = std::max(cos_error, std::abs(c[k] - std::cos(xd)));
+            exp2_error = std::max(exp2_error, std::abs(e[k] - std::exp2(xd)) / std::exp2(xd));
+        }
+    }
+    ASSERT(sin_error < 1.5e-7);
+    ASSERT(cos_error < 1.5e-7);
+    ASSERT(exp2_error < 1.5e-7);
+    PASS();
+}
+
+TEST(batch_design_matches_scalar_design) {
+    const float sample_rates[] = {44100.0f, 48000.0f, 96000.0f, 192000.0f};
+    const float frequencies[] = {20.0f, 63.0f, 250.0f, 1000.0f, 4000.0f, 12000.0f, 20000.0f};
+    const float gains[] = {-12.0f, -3.5f, 0.0f, 6.0f, 12.0f};
+    const float qs[] = {0.1f, 0.707f, 2.0f, 10.0f};
+
+    for (float sr : sample_rates) {
+        // Every combination, in batches that leave partial vectors
+        std::vector<radioform_band_t> bands;
+        for (int type = 0; type < 7; type++) {
+            for (float f : frequencies) {
+                for (float g : gains) {
+                    for (float q : qs) {
+                        bands.push_back({f, g, q, static_cast<radioform_filter_type_t>(type), true});
+                    }
+                }
+            }
+        }
+        std::vector<BiquadCoeffs> batch(bands.size());
+        for (size_t first = 0; first < bands.size(); first += 7) {
+            const uint32_t count = static_cast<uint32_t>(std::min<size_t>(7, bands.size() - first));
+            design_biquads(&bands[first], count, sr, &batch[first]);
+        }
+
+        for (size_t i = 0; i < bands.size(); i++) {
+            const BiquadCoeffs reference = Biquad::calculateCoeffs(bands[i], sr);
+            // A few ulps of the coefficients' own scale (|a1| < 2, shelves' b up to 4)
+            ASSERT_NEAR(batch[i].b0, reference.b0, 2e-6 * std::max(1.0f, std::abs(reference.b0)));
+            ASSERT_NEAR(batch[i].b1, reference.b1, 2e-6 * std::max(1.0f, std::abs(reference.b1)));
+            ASSERT_NEAR(batch[i].b2, reference.b2, 2e-6 * std::max(1.0f, std::abs(reference.b2)));
+            ASSERT_NEAR(batch[i].a1, reference.a1, 2e-6);
+            ASSERT_NEAR(batch[i].a2, reference.a2, 2e-6);
+        }
+    }
+    PASS();
+}
@@ -0,0 +1,114 @@
+/**
+ * @file test_coeff_cache.cpp
+ * @brief Tests for the designed-coefficient cache
+ */
+
+#include "test_utils.h"
+#include "radioform_dsp.h"
+#include "coeff_cache.h"
+
+#include <cmath>
+
+using namespace dsp_test;
+using namespace radioform;
+
+namespace {
+
+void make_peak_preset(radioform_preset_t& preset, float gain_offset) {
+    radioform_filter_type_t types[6];
+    float frequencies[6];
+    float gains[6];
+    for (uint32_t b = 0; b < 6; b++) {
+        types[b] = RADIOFORM_FILTER_PEAK;
+        frequencies[b] = 100.0f * std::pow(2.5f, static_cast<float>(b));
+        gains[b] = gain_offset + static_cast<float>(b);
+    }
+    make_preset(preset, 6, types, frequencies, gains, 0.707f);
+    preset.bands[5].enabled = false;  // Disabled bands are not designed
+}
+
+} // namespace
+
+TEST(coeff_cache_quantizes_and_evicts_with_clock) {
+    // Nearby settings share a key
+    const CoeffKey key = CoefficientCache::quantize(make_band(RADIOFORM_FILTER_PEAK, 1000.0f, 3.0f, 0.707f), 48000);
+    ASSERT(key == CoefficientCache::quantize(make_band(RADIOFORM_FILTER_PEAK, 1000.002f, 3.0002f, 0.70702f), 48000));
+    ASSERT(!(key == CoefficientCache::quantize(make_band(RADIOFORM_FILTER_PEAK, 1000.0f, 3.0f, 0.707f), 44100)));
+    const radioform_band_t restored = CoefficientCache::dequantize(key);
+    ASSERT_NEAR(restored.frequency_hz, 1000.0f, 1e-3f);
+    ASSERT_NEAR(restored.gain_db, 3.0f, 1e-6f);
+    ASSERT_NEAR(restored.q_factor, 0.707f, 1e-7f);
+
+    CoefficientCache cache;
+    auto key_for = [](uint32_t i) {
+        return CoefficientCache::quantize(make_band(RADIOFORM_FILTER_PEAK, 20.0f + static_cast<float>(i), 0.0f, 1.0f), 48000);
+    };
+    ASSERT(cache.find(key_for(0)) == nullptr);
+    for (uint32_t i = 0; i < CoefficientCache::kCapacity; i++) {
+        cache.insert(key_for(i), {static_cast<float>(i), 0.0f, 0.0f, 0.0f, 0.0f});
+    }
+    const BiquadCoeffs* first = cache.find(key_for(0));
+    ASSERT(first != nullptr);
+    ASSERT_EQ(first->b0, 0.0f);
+
+    // Full: entry 0 was referenced and gets a second chance, entry 1 goes
+    const uint32_t extra = CoefficientCache::kCapacity;
+    cache.insert(key_for(extra), {static_cast<float>(extra), 0.0f, 0.0f, 0.0f, 0.0f});
+    ASSERT(cache.find(key_for(0)) != nullptr);
+    ASSERT(cache.find(key_for(1)) == nullptr);
+    ASSERT(cache.find(key_for(2)) != nullptr);
+    ASSERT_EQ(cache.find(key_for(extra))->b0, static_cast<float>(extra));
+
+    ASSERT_EQ(cache.hits(), 4u);
+    ASSERT_EQ(cache.misses(), 2u);
+    PASS();
+}
+
+TEST(engine_reuses_cached_coefficients) {
+    radioform_preset_t preset_a, preset_b;
+    make_peak_preset(preset_a, 2.0f);
+    make_peak_preset(preset_b, -4.0f);
+
+    auto* engine = radioform_dsp_create(48000);
+    radioform_stats_t stats;
+    radioform_dsp_get_stats(engine, &stats);
+    const uint64_t base_misses = stats.coeff_cache_misses;
+
+    radioform_dsp_apply_preset(engine, &preset_a);
+    radioform_dsp_apply_preset(engine, &preset_b);
+    radioform_dsp_get_stats(engine, &stats);
+    ASSERT_EQ(stats.coeff_cache_misses - base_misses, 10u);
+    const uint64_t hits_before = stats.coeff_cache_hits;
+
+    // Toggling back designs nothing
+    radioform_dsp_apply_preset(engine, &preset_a);
+    radioform_dsp_get_stats(engine, &stats);
+    ASSERT_EQ(stats.coeff_cache_hits - hits_before, 5u);
+    ASSERT_EQ(stats.coeff_cache_misses - base_misses, 10u);
+
+    // Slider moved away and back: one miss, then a hit
+    radioform_dsp_update_band_gain(engine, 1, 7.5f);
+    radioform_dsp_update_band_gain(engine, 1, preset_a.bands[1].gain_db);
+    radioform_dsp_get_stats(engine, &stats);
+    ASSERT_EQ(stats.coeff_cache_hits - hits_before, 6u);
+    ASSERT_EQ(stats.coeff_cache_misses - base_misses, 11u);
+
+    // Cached designs are the ones a fresh engine computes
+    auto* reference = radioform_dsp_create(48000);
+    radioform_dsp_apply_preset(reference, &preset_a);
+    radioform_dsp_apply_preset(engine, &preset_a);
+    const uint32_t n = 4096;
+    auto mono = generate_white_noise(n, 0.4f);
+    std::vector<float> input(n * 2), output(n * 2), expected(n * 2);
+    for (uint32_t i = 0; i < n; i++) {
+        input[i * 2] = mono[i];
+        input[i * 2 + 1] = -mono[i];
+    }
+    radioform_dsp_process_interleaved(engine, input.data(), output.data(), n);
+    radioform_dsp_process_interleaved(reference, input.data(), expected.data(), n);
+    ASSERT(signals_identical(output, expected));
+
+    radioform_dsp_destroy(engine);
+    radioform_dsp_destroy(reference);
+    PASS();
+}
@@ -0,0 +1,193 @@
+/**
+ * @file test_config_snapshot.cpp
+ * @brief Tests for preset configurations swapped in by the audio thread
+ */
+
+#include "test_utils.h"
+#include "radioform_dsp.h"
+#include "config_snapshot.h"
+
+#include <atomic>
+#include <cmath>
+#include <thread>
+
+using namespace dsp_test;
+using namespace radioform;
+
+namespace {
+
+void make_variant_preset(radioform_preset_t& preset, int variant) {
+    radioform_filter_type_t types[4];
+    float frequencies[4];
+    float gains[4];
+    for (uint32_t b = 0; b < 4; b++) {
+        // Band 0 of variant 1 is low enough to run as an SVF
+        types[b] = (b == 0) ? RADIOFORM_FILTER_LOW_SHELF : RADIOFORM_FILTER_PEAK;
+        frequencies[b] = (variant == 1 ? 20.0f : 60.0f) * std::pow(4.0f, static_cast<float>(b));
+        gains[b] = (variant == 0 ? 6.0f : -4.0f) + static_cast<float>(b);
+    }
+    make_preset(preset, 3 + variant, types, frequencies, gains, 0.7f + 0.3f * static_cast<float>(variant));
+    preset.preamp_db = variant == 0 ? -3.0f : 0.0f;
+    preset.limiter_enabled = variant == 0;
+    preset.limiter_threshold_db = -1.0f;
+}
+
+} // namespace
+
+TEST(config_snapshot_exchange_hands_over_latest) {
+    SnapshotExchange<int> exchange;
+
+    int& first = exchange.acquire();
+    first = 1;
+    exchange.publish();
+    const int* taken = exchange.take();
+    ASSERT(taken == &first);
+    ASSERT(exchange.take() == nullptr);
+
+    // The slot the consumer holds is never handed out for writing
+    int& second = exchange.acquire();
+    ASSERT(&second != taken);
+    second = 2;
+    exchange.publish();
+
+    // Not taken yet: the same slot is withdrawn and rewritten
+    int& third = exchange.acquire();
+    ASSERT(&third == &second);
+    ASSERT(exchange.latest() == nullptr);
+    third = 3;
+    exchange.publish();
+    ASSERT_EQ(*exchange.latest(), 3);
+
+    taken = exchange.take();
+    ASSERT(taken == &third);
+    ASSERT_EQ(*taken, 3);
+
+    // Taking the newer slot retired the first one
+    int& fourth = exchange.acquire();
+    ASSERT(&fourth == &first);
+
+    PASS();
+}
+
+TEST(engine_preset_swap_while_processing) {
+    const uint32_t block = 128;
+    const uint32_t n = 48000;
+    auto mono = generate_white_noise(n, 0.4f);
+    std::vector<float> input(n * 2);
+    for (uint32_t i = 0; i < n; i++) {
+        input[i * 2] = mono[i];
+        input[i * 2 + 1] = 0.5f * mono[i];
+    }
+
+    radioform_preset_t presets[2];
+    make_variant_preset(presets[0], 0);
+    make_variant_preset(presets[1], 1);
+
+    auto* engine = radioform_dsp_create(48000);
+    radioform_dsp_apply_preset(engine, &presets[0]);
+
+    // A preset applied between buffers takes effect at the next one, whole
+    auto* reference = radioform_dsp_create(48000);
+    radioform_dsp_apply_preset(reference, &presets[1]);
+    radioform_dsp_apply_preset(engine, &presets[1]);
+    std::vector<float> output(n * 2), expected(n * 2);
+    radioform_dsp_process_interleaved(engine, input.data(), output.data(), block);
+    radioform_dsp_process_interleaved(reference, input.data(), expected.data(), block);
+    for (uint32_t i = 0; i < block * 2; i++) {
+        ASSERT_NEAR(output[i], expected[i], 0.0f);
+    }
+    radioform_dsp_destroy(reference);
+
+    // Preset changes from another thread while the audio thread runs
+    std::atomic<bool> running{true};
+    std::atomic<int> last{1};
+    std::thread ui([&] {
+        for (int i = 0; running.load(); i++) {
+            radioform_dsp_apply_preset(engine, &presets[i % 2]);
+            last.store(i % 2);
+            std::this_thread::yield();
+        }
+    });
+    for (uint32_t offset = 0; offset + block <= n; offset += block) {
+        radioform_dsp_process_interleaved(engine, input.data() + offset * 2, output.data() + offset * 2, block);
+    }
+    running.store(false);
+    ui.join();
+    for (float sample : output) {
+        ASSERT(std::isfinite(sample));
+    }
+
+    // The last preset applied is the one that ends up running
+    reference = radioform_dsp_create(48000);
+    radioform_dsp_apply_preset(reference, &presets[last.load()]);
+    for (uint32_t offset = 0; offset + block <= n; offset += block) {
+        radioform_dsp_process_interleaved(engine, input.data() + offset * 2, output.data() + offset * 2, block);
+        radioform_dsp_process_interleaved(reference, input.data() + offset * 2, expected.data() + offset * 2, block);
+    }
+    for (uint32_t i = n; i < n * 2; i++) {
+        ASSERT_NEAR(output[i], expected[i], 1e-4f);
+    }
+
+    radioform_dsp_destroy(engine);
+    radioform_dsp_destroy(reference);
+    PASS();
+}
+
+TEST(engine_group_preset_swap_while_processing) {
+    const uint32_t block = 128;
+    const uint32_t n = 48000;
+    auto mono = generate_white_noise(n, 0.4f);
+    std::vector<float> input(n * 2);
+    for (uint32_t i = 0; i < n; i++) {
+        input[i * 2] = mono[i];
+        input[i * 2 + 1] = 0.5f * mono[i];
+    }
+
+    radioform_preset_t presets[2];
+    make_variant_preset(presets[0], 0);
+    make_variant_preset(presets[1], 1);
+
+    auto* group = radioform_dsp_engine_group_create(48000, 2);
+    radioform_dsp_engine_group_apply_preset(group, 0, &presets[0]);
+    radioform_dsp_engine_group_apply_preset(group, 1, &presets[0]);
+
+    // Member 0 changes preset from another thread while the group runs
+    std::vector<float> output[2] = {std::vector<float>(n * 2), std::vector<float>(n * 2)};
+    std::atomic<bool> running{true};
+    std::atomic<int> last{0};
+    std::thread ui([&] {
+        for (int i = 0; running.load(); i++) {
+            radioform_dsp_engine_group_apply_preset(group, 0, &presets[(i + 1) % 2]);
+            last.store((i + 1) % 2);
+            std::this_thread::yield();
+        }
+    });
+    for (uint32_t offset = 0; offset + block <= n; offset += block) {
+        const float* inputs[2] = {input.data() + offset * 2, input.data() + offset * 2};
+        float* outputs[2] = {output[0].data() + offset * 2, output[1].data() + offset * 2};
+        radioform_dsp_engine_group_process_interleaved(group, inputs, outputs, block);
+    }
+    running.store(false);
+    ui.join();
+    for (float sample : output[0]) {
+        ASSERT(std::isfinite(sample));
+    }
+
+    // The last preset applied is the one that ends up running
+    auto* reference = radioform_dsp_create(48000);
+    radioform_dsp_apply_preset(reference, &presets[last.load()]);
+    std::vector<float> expected(n * 2);
+    for (uint32_t offset = 0; offset + block <= n; offset += block) {
+        const float* inputs[2] = {input.data() + offset * 2, input.data() + offset * 2};
+        float* outputs[2] = {output[0].data() + offset * 2, output[1].data() + offset * 2};
+        radioform_dsp_engine_group_process_interleaved(group, inputs, outputs, block);
+        radioform_dsp_process_interleaved(reference, input.data() + offset * 2, expected.data() + offset * 2, block);
+    }
+    for (uint32_t i = n; i < n * 2; i++) {
+        ASSERT_NEAR(output[0][i], expected[i], 1e-3f);
+    }
+
+    radioform_dsp_engine_group_destroy(group);
+    radioform_dsp_destroy(reference);
+    PASS();
+}
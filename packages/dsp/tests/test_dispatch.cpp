@@ -0,0 +1,292 @@
+/**
+ * @file test_dispatch.cpp
+ * @brief Tests for runtime kernel selection
+ */
+
+#include "test_utils.h"
+#include "radioform_dsp.h"
+#include "dispatch.h"
+
+#include <cstring>
+
+using namespace radioform;
+using namespace dsp_test;
+
+namespace {
+
+// Every kernel set runnable on this machine, baseline first
+struct SupportedTables {
+    const KernelTable* tables[4];
+    uint32_t count;
+
+    SupportedTables() : count(supported_kernel_tables(detect_cpu_features(), tables, 4)) {}
+};
+
+struct ChainFixture {
+    Biquad bands[RADIOFORM_MAX_BANDS];  // Per-sample reference
+    BiquadBank cascade;
+    ParallelEQ parallel;
+    ParameterSmoother preamp;
+    StereoDCBlocker dc_blocker;
+    SoftLimiter limiter;
+    StereoChain chain;
+
+    explicit ChainFixture(bool parallel_form) {
+        const radioform_filter_type_t types[] = {
+            RADIOFORM_FILTER_LOW_SHELF, RADIOFORM_FILTER_PEAK, RADIOFORM_FILTER_HIGH_SHELF,
+            RADIOFORM_FILTER_NOTCH, RADIOFORM_FILTER_PEAK
+        };
+        BiquadCoeffs coeffs[RADIOFORM_MAX_BANDS];
+        cascade.init();
+        for (uint32_t b = 0; b < RADIOFORM_MAX_BANDS; b++) {
+            const radioform_band_t band = make_band(
+                types[b % 5], 35.0f * static_cast<float>(b + 1) * static_cast<float>(b + 1),
+                (b % 2 == 0) ? 5.0f : -4.0f, 1.1f);
+            bands[b].init();
+            bands[b].setCoeffs(band, 48000.0f);
+            coeffs[b] = bands[b].coeffs();
+            cascade.setCoeffs(b, coeffs[b]);
+        }
+        cascade.setNumSections(RADIOFORM_MAX_BANDS);
+        chain.cascade = &cascade;
+
+        parallel.init();
+        ParallelDesign design;
+        if (parallel_form && design_parallel(coeffs, RADIOFORM_MAX_BANDS, design)) {
+            parallel.setDesign(design);
+            chain.parallel = &parallel;
+        } else {
+            chain.parallel = nullptr;
+        }
+
+        preamp.init(48000.0f, 10.0f);
+        preamp.setValue(radioform::db_to_gain(6.0f));
+        dc_blocker.init(48000.0f, 5.0f);
+        limiter.init(-1.0f);
+
+        chain.preamp = &preamp;
+        chain.dc_blocker = &dc_blocker;
+        chain.limiter = &limiter;
+    }
+};
+
+std::vector<float> sine(size_t num_frames, float frequency, float amplitude) {
+    auto signal = generate_sine(num_frames, frequency, 48000.0f);
+    for (float& x : signal) {
+        x *= amplitude;
+    }
+    return signal;
+}
+
+std::vector<float> stereo_input(size_t num_frames) {
+    auto left = generate_white_noise(num_frames, 0.4f);
+    auto right = generate_sine(num_frames, 700.0f, 48000.0f);
+    std::vector<float> input(num_frames * 2);
+    for (size_t i = 0; i < num_frames; i++) {
+        input[i * 2] = left[i];
+        input[i * 2 + 1] = right[i] * 0.6f;
+    }
+    return input;
+}
+
+} // namespace
+
+TEST(engine_reports_kernel_info) {
+    auto* engine = radioform_dsp_create(48000);
+    ASSERT(engine != nullptr);
+
+    radioform_kernel_info_t info;
+    ASSERT_EQ(radioform_dsp_get_kernel_info(engine, &info), RADIOFORM_OK);
+    ASSERT_EQ(radioform_dsp_get_kernel_info(engine, nullptr), RADIOFORM_ERROR_NULL_POINTER);
+    ASSERT_EQ(radioform_dsp_get_kernel_info(nullptr, &info), RADIOFORM_ERROR_NULL_POINTER);
+
+    // The best runnable set is bound, and it is consistent with the features
+    const uint32_t features = detect_cpu_features();
+    const KernelTable& expected = select_kernel_table(features);
+    ASSERT(info.kernel_set != nullptr);
+    ASSERT(std::strcmp(info.kernel_set, expected.name) == 0);
+    ASSERT_EQ(info.cpu_features, features);
+    ASSERT_EQ(info.vector_width, expected.vector_width);
+    ASSERT((features & expected.required_features) == expected.required_features);
+
+#if RADIOFORM_HAVE_AVX2_KERNELS
+    const bool avx2 = (features & (RADIOFORM_CPU_AVX2 | RADIOFORM_CPU_FMA)) ==
+        (RADIOFORM_CPU_AVX2 | RADIOFORM_CPU_FMA);
+    ASSERT_EQ(avx2, std::strcmp(info.kernel_set, "avx2+fma") == 0);
+#endif
+
+    radioform_dsp_destroy(engine);
+    PASS();
+}
+
+TEST(dispatch_interleaved_kernels_agree) {
+    const SupportedTables supported;
+    ASSERT(supported.count >= 1);
+    ASSERT(supported.tables[0] == &baseline::kKernelTable);
+
+    const size_t num_frames = 2048;
+    auto input = stereo_input(num_frames);
+
+    for (int parallel_form = 0; parallel_form < 2; parallel_form++) {
+        ChainFixture reference(parallel_form != 0);
+        std::vector<float> out_reference(input.size());
+        baseline::kKernelTable.select_stereo(reference.chain).steady(
+            reference.chain, input.data(), out_reference.data(), num_frames);
+
+        for (uint32_t t = 1; t < supported.count; t++) {
+            ChainFixture fixture(parallel_form != 0);
+            ASSERT_EQ(fixture.chain.parallel != nullptr, reference.chain.parallel != nullptr);
+
+            std::vector<float> output(input.size());
+            supported.tables[t]->select_stereo(fixture.chain).steady(
+                fixture.chain, input.data(), output.data(), num_frames);
+
+            // Fused multiply-adds round differently, nothing else should differ
+            for (size_t i = 0; i < output.size(); i++) {
+                ASSERT_NEAR(output[i], out_reference[i], 1e-3f);
+            }
+        }
+    }
+
+    PASS();
+}
+
+TEST(dispatch_planar_kernels_agree) {
+    const SupportedTables supported;
+    const uint32_t num_frames = 1027;  // Odd length exercises every tail path
+    auto source_left = generate_white_noise(num_frames, 0.9f);
+    auto source_right = sine(num_frames, 3000.0f, 1.3f);
+    source_left[100] = std::numeric_limits<float>::quiet_NaN();
+
+    for (uint32_t t = 0; t < supported.count; t++) {
+        const KernelTable& kernels = *supported.tables[t];
+
+        // EQ structures against the per-sample cascade
+        for (int parallel_form = 0; parallel_form < 2; parallel_form++) {
+            ChainFixture fixture(parallel_form != 0);
+            ChainFixture reference(false);
+            auto left = generate_white_noise(num_frames, 0.5f);
+            auto right = generate_sine(num_frames, 440.0f, 48000.0f);
+            auto ref_left = left;
+            auto ref_right = right;
+
+            if (fixture.chain.parallel) {
+                kernels.parallel_eq(*fixture.chain.parallel, left.data(), right.data(), num_frames);
+            } else {
+                BlockBiquad sections[RADIOFORM_MAX_BANDS];
+                for (uint32_t b = 0; b < RADIOFORM_MAX_BANDS; b++) {
+                    sections[b].update(fixture.bands[b].coeffs());
+                }
+                kernels.block_cascade(sections, fixture.cascade,
+                                      left.data(), right.data(), num_frames);
+            }
+            for (uint32_t b = 0; b < RADIOFORM_MAX_BANDS; b++) {
+                reference.bands[b].processBuffer(
+                    ref_left.data(), ref_right.data(), ref_left.data(), ref_right.data(), num_frames);
+            }
+            for (uint32_t i = 0; i < num_frames; i++) {
+                ASSERT_NEAR(left[i], ref_left[i], 1e-3f);
+                ASSERT_NEAR(right[i], ref_right[i], 1e-3f);
+            }
+        }
+
+        // DC blocker, limiter and peak meter against the scalar stages
+        ChainFixture fixture(false);
+        ChainFixture reference(false);
+        auto left = sine(num_frames, 50.0f, 1.2f);
+        auto right = sine(num_frames, 6000.0f, 0.5f);
+        for (uint32_t i = 0; i < num_frames; i++) {
+            left[i] += 0.3f;  // DC offset to remove
+        }
+        auto ref_left = left;
+        auto ref_right = right;
+
+        kernels.dc_blocker(fixture.dc_blocker, left.data(), right.data(), num_frames);
+        reference.dc_blocker.processBuffer(
+            ref_left.data(), ref_right.data(), ref_left.data(), ref_right.data(), num_frames);
+        for (uint32_t i = 0; i < num_frames; i++) {
+            ASSERT_NEAR(left[i], ref_left[i], 1e-4f);
+            ASSERT_NEAR(right[i], ref_right[i], 1e-4f);
+        }
+
+        left = source_left;
+        right = source_right;
+        ref_left = source_left;
+        ref_right = source_right;
+        kernels.limiter(fixture.limiter, left.data(), right.data(), num_frames);
+        reference.limiter.processBuffer(ref_left.data(), ref_right.data(), num_frames);
+        for (uint32_t i = 0; i < num_frames; i++) {
+            ASSERT_NEAR(left[i], ref_left[i], 1e-6f);
+            ASSERT_NEAR(right[i], ref_right[i], 1e-6f);
+        }
+
+        // NaN is ignored by the meter
+        const StereoPeak peak = kernels.peak(source_left.data(), source_right.data(), num_frames);
+        float ref_peak_left = 0.0f;
+        float ref_peak_right = 0.0f;
+        for (uint32_t i = 0; i < num_frames; i++) {
+            ref_peak_left = std::max(ref_peak_left, std::abs(source_left[i]));
+            ref_peak_right = std::max(ref_peak_right, std::abs(source_right[i]));
+        }
+        ASSERT_EQ(peak.left, ref_peak_left);
+        ASSERT_EQ(peak.right, ref_peak_right);
+    }
+
+    PASS();
+}
+
+TEST(dispatch_multichannel_kernels_agree) {
+    // 7.1 frames: two 4-lane vectors in the baseline set, one 8-lane vector with AVX2
+    const SupportedTables supported;
+    const uint32_t num_frames = 515;
+    std::vector<float> source(num_frames * kFrameStride);
+    const auto noise = generate_white_noise(source.size(), 0.9f);
+    for (size_t i = 0; i < source.size(); i++) {
+        source[i] = noise[i] + ((i % kFrameStride) == 3 ? 0.4f : 0.0f);
+    }
+
+    std::vector<float> reference;
+    float reference_peaks[RADIOFORM_MAX_CHANNELS] = {};
+    for (uint32_t t = 0; t < supported.count; t++) {
+        ChainFixture fixture(false);
+        MultichannelDCBlocker dc;
+        dc.init(48000.0f, 5.0f);
+        MultichannelChain chain = {};
+        chain.num_channels = RADIOFORM_MAX_CHANNELS;
+        chain.cascade = &fixture.cascade;
+        chain.preamp = &fixture.preamp;
+        chain.dc_blocker = &dc;
+        chain.limiter = &fixture.limiter;
+
+        auto frames = source;
+        float peaks[RADIOFORM_MAX_CHANNELS] = {};
+        supported.tables[t]->multichannel(chain, frames.data(), num_frames, peaks);
+        if (t == 0) {
+            reference = frames;
+            std::copy(peaks, peaks + RADIOFORM_MAX_CHANNELS, reference_peaks);
+            continue;
+        }
+        for (size_t i = 0; i < frames.size(); i++) {
+            ASSERT_NEAR(frames[i], reference[i], 1e-3f);
+        }
+        for (uint32_t ch = 0; ch < RADIOFORM_MAX_CHANNELS; ch++) {
+            ASSERT_NEAR(peaks[ch], reference_peaks[ch], 1e-3f);
+        }
+    }
+
+    // Each lane is an independent channel: lane 0 matches the stereo kernel's left
+    ChainFixture fixture(false);
+    std::vector<float> stereo(num_frames * 2);
+    for (uint32_t i = 0; i < num_frames; i++) {
+        stereo[i * 2] = source[i * kFrameStride];
+        stereo[i * 2 + 1] = source[i * kFrameStride + 1];
+    }
+    baseline::kKernelTable.select_stereo(fixture.chain).steady(
+        fixture.chain, stereo.data(), stereo.data(), num_frames);
+    for (uint32_t i = 0; i < num_frames; i++) {
+        ASSERT_NEAR(reference[i * kFrameStride], stereo[i * 2], 1e-4f);
+        ASSERT_NEAR(reference[i * kFrameStride + 1], stereo[i * 2 + 1], 1e-4f);
+    }
+
+    PASS();
+}
@@ -0,0 +1,160 @@
+/**
+ * @file test_engine_group.cpp
+ * @brief Tests for groups of engines processed in SIMD lanes
+ */
+
+#include "test_utils.h"
+#include "radioform_dsp.h"
+
+#include <limits>
+
+using namespace dsp_test;
+
+namespace {
+
+// Member e gets its own mix of bands; the first band is low enough to run as an SVF
+void make_member_preset(radioform_preset_t& preset, uint32_t e) {
+    const radioform_filter_type_t types[] = {
+        RADIOFORM_FILTER_LOW_SHELF, RADIOFORM_FILTER_PEAK, RADIOFORM_FILTER_NOTCH,
+        RADIOFORM_FILTER_HIGH_SHELF
+    };
+    const float frequencies[] = {25.0f, 400.0f, 3000.0f, 11000.0f};
+    float gains[4];
+    for (uint32_t b = 0; b < 4; b++) {
+        gains[b] = 6.0f - 2.5f * static_cast<float>((b + e) % 7);
+    }
+    make_preset(preset, 1 + e % 4, types, frequencies, gains, 0.8f + 0.1f * static_cast<float>(e));
+    preset.preamp_db = -1.0f * static_cast<float>(e % 3);
+    preset.limiter_enabled = (e % 2) == 0;
+    preset.limiter_threshold_db = -2.0f;
+}
+
+std::vector<float> stereo_signal(uint32_t e, size_t num_frames) {
+    auto left = generate_sine(num_frames, 30.0f + 900.0f * static_cast<float>(e), 48000.0f);
+    auto noise = generate_white_noise(num_frames * 2, 0.3f);
+    std::vector<float> frames(num_frames * 2);
+    for (size_t i = 0; i < num_frames; i++) {
+        frames[i * 2] = left[i] * 0.8f + noise[i * 2];
+        frames[i * 2 + 1] = noise[i * 2 + 1];
+    }
+    return frames;
+}
+
+} // namespace
+
+TEST(engine_group_validates_arguments) {
+    ASSERT(radioform_dsp_engine_group_create(48000, 0) == nullptr);
+    ASSERT(radioform_dsp_engine_group_create(48000, RADIOFORM_MAX_GROUP_ENGINES + 1) == nullptr);
+    ASSERT(radioform_dsp_engine_group_create(1000, 2) == nullptr);
+    ASSERT_EQ(radioform_dsp_engine_group_get_num_engines(nullptr), 0u);
+
+    auto* group = radioform_dsp_engine_group_create(48000, 3);
+    ASSERT(group != nullptr);
+    ASSERT_EQ(radioform_dsp_engine_group_get_num_engines(group), 3u);
+
+    radioform_preset_t preset;
+    radioform_dsp_preset_init_flat(&preset);
+    ASSERT_EQ(radioform_dsp_engine_group_apply_preset(group, 3, &preset), RADIOFORM_ERROR_INVALID_PARAM);
+    ASSERT_EQ(radioform_dsp_engine_group_apply_preset(group, 0, nullptr), RADIOFORM_ERROR_NULL_POINTER);
+    preset.num_bands = RADIOFORM_MAX_BANDS + 1;
+    ASSERT(radioform_dsp_engine_group_apply_preset(group, 0, &preset) != RADIOFORM_OK);
+
+    radioform_dsp_engine_group_destroy(group);
+    PASS();
+}
+
+TEST(engine_group_matches_standalone_engines) {
+    // Every member count exercises full, partial and multi-vector lane sets
+    const uint32_t num_frames = 3001;
+    for (uint32_t engines = 1; engines <= RADIOFORM_MAX_GROUP_ENGINES; engines++) {
+        auto* group = radioform_dsp_engine_group_create(48000, engines);
+        ASSERT(group != nullptr);
+
+        std::vector<std::vector<float>> grouped;
+        std::vector<std::vector<float>> expected;
+        for (uint32_t e = 0; e < engines; e++) {
+            radioform_preset_t preset;
+            make_member_preset(preset, e);
+            ASSERT_EQ(radioform_dsp_engine_group_apply_preset(group, e, &preset), RADIOFORM_OK);
+
+            auto* engine = radioform_dsp_create(48000);
+            ASSERT_EQ(radioform_dsp_apply_preset(engine, &preset), RADIOFORM_OK);
+            auto frames = stereo_signal(e, num_frames);
+            grouped.push_back(frames);
+            radioform_dsp_process_interleaved(engine, frames.data(), frames.data(), num_frames);
+            expected.push_back(frames);
+            radioform_dsp_destroy(engine);
+        }
+
+        const float* inputs[RADIOFORM_MAX_GROUP_ENGINES];
+        float* outputs[RADIOFORM_MAX_GROUP_ENGINES];
+        for (uint32_t e = 0; e < engines; e++) {
+            inputs[e] = grouped[e].data();
+            outputs[e] = grouped[e].data();
+        }
+        radioform_dsp_engine_group_process_interleaved(group, inputs, outputs, num_frames);
+
+        for (uint32_t e = 0; e < engines; e++) {
+            for (size_t i = 0; i < grouped[e].size(); i++) {
+                ASSERT_NEAR(grouped[e][i], expected[e][i], 1e-3f);
+            }
+            radioform_stats_t stats;
+            radioform_dsp_engine_group_get_stats(group, e, &stats);
+            ASSERT_EQ(stats.frames_processed, static_cast<uint64_t>(num_frames));
+            ASSERT(stats.peak_left_db > -20.0f);
+        }
+
+        radioform_dsp_engine_group_destroy(group);
+    }
+
+    PASS();
+}
+
+TEST(engine_group_members_are_independent) {
+    const uint32_t engines = 4;
+    const uint32_t num_frames = 2048;
+    auto* group = radioform_dsp_engine_group_create(48000, engines);
+
+    // Members 0 and 2 share a preset (shared design must still give equal output)
+    radioform_preset_t shared;
+    make_member_preset(shared, 3);
+    radioform_preset_t other;
+    make_member_preset(other, 1);
+    ASSERT_EQ(radioform_dsp_engine_group_apply_preset(group, 0, &shared), RADIOFORM_OK);
+    ASSERT_EQ(radioform_dsp_engine_group_apply_preset(group, 1, &other), RADIOFORM_OK);
+    ASSERT_EQ(radioform_dsp_engine_group_apply_preset(group, 2, &shared), RADIOFORM_OK);
+    ASSERT_EQ(radioform_dsp_engine_group_apply_preset(group, 3, &other), RADIOFORM_OK);
+    radioform_dsp_engine_group_set_bypass(group, 3, true);
+
+    std::vector<std::vector<float>> buffers(engines, stereo_signal(0, num_frames));
+    const auto input = buffers[0];
+    buffers[1][100] = std::numeric_limits<float>::quiet_NaN();
+
+    const float* inputs[engines];
+    float* outputs[engines];
+    for (uint32_t e = 0; e < engines; e++) {
+        inputs[e] = buffers[e].data();
+        outputs[e] = buffers[e].data();
+    }
+    radioform_dsp_engine_group_process_interleaved(group, inputs, outputs, num_frames);
+
+    ASSERT(signals_identical(buffers[0], buffers[2]));
+    ASSERT(!signals_identical(buffers[0], input));
+    ASSERT(signals_identical(buffers[3], input));
+
+    // NaN in member 1 is recovered and does not leak into the other lanes
+    for (uint32_t e = 0; e < 3; e++) {
+        for (float sample : buffers[e]) {
+            ASSERT(std::isfinite(sample));
+        }
+    }
+    ASSERT(!is_silent(std::vector<float>(buffers[1].end() - 200, buffers[1].end())));
+
+    radioform_stats_t stats;
+    radioform_dsp_engine_group_get_stats(group, 3, &stats);
+    ASSERT(stats.bypass_active);
+    ASSERT_EQ(stats.peak_left_db, -120.0f);
+
+    radioform_dsp_engine_group_destroy(group);
+    PASS();
+}
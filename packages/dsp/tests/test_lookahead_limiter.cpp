@@ -0,0 +1,164 @@
+/**
+ * @file test_lookahead_limiter.cpp
+ * @brief Tests for the lookahead true-peak limiter
+ */
+
+#include "test_utils.h"
+#include "radioform_dsp.h"
+#include "lookahead_limiter.h"
+
+#include <cmath>
+
+using namespace dsp_test;
+using namespace radioform;
+
+TEST(lookahead_limiter_delays_quiet_signals_unchanged) {
+    LookaheadLimiter limiter;
+    limiter.init(2);
+    limiter.configure(96, 4800.0f, -1.0f);
+    const uint32_t latency = limiter.latencyFrames();
+    ASSERT_EQ(latency, 96u + LookaheadLimiter::kDetectorDelay);
+
+    // Well below the ceiling (true peak included): a pure delay, in odd-sized calls
+    const uint32_t n = 4000;
+    auto left = generate_white_noise(n, 0.2f);
+    auto right = generate_sine(n, 440.0f, 48000.0f);
+    std::vector<float> interleaved(n * 2);
+    for (uint32_t i = 0; i < n; i++) {
+        interleaved[i * 2] = left[i];
+        interleaved[i * 2 + 1] = 0.5f * right[i];
+    }
+    float peaks[2] = {};
+    for (uint32_t offset = 0; offset < n;) {
+        const uint32_t frames = std::min(n - offset, 77u);
+        limiter.processInterleaved(interleaved.data() + offset * 2, 2, frames, peaks);
+        offset += frames;
+    }
+    for (uint32_t i = 0; i < n; i++) {
+        ASSERT_EQ(interleaved[i * 2], i < latency ? 0.0f : left[i - latency]);
+        ASSERT_EQ(interleaved[i * 2 + 1], i < latency ? 0.0f : 0.5f * right[i - latency]);
+    }
+    ASSERT(peaks[0] > 0.0f && peaks[0] <= 0.2f);
+    PASS();
+}
+
+TEST(lookahead_limiter_holds_true_peak_ceiling) {
+    const float ceiling = std::pow(10.0f, -1.0f / 20.0f);
+    const uint32_t n = 48000;
+
+    // Loud bursts: no output sample above the ceiling, and no clipping
+    // (the gain ramps in ahead of each burst)
+    {
+        LookaheadLimiter limiter;
+        limiter.init(2);
+        limiter.configure(96, 2400.0f, -1.0f);
+        auto left = generate_white_noise(n, 0.3f);
+        for (uint32_t i = 0; i < n; i++) {
+            if ((i / 4800) % 2 == 1) {
+                left[i] *= 8.0f;
+            }
+        }
+        auto right = left;
+        float peaks[2] = {};
+        limiter.processPlanar(left.data(), right.data(), n, peaks);
+        ASSERT(peaks[0] <= ceiling * 1.0001f);
+        ASSERT(peaks[0] > ceiling * 0.8f);
+        for (uint32_t i = 0; i < n; i++) {
+            ASSERT(std::fabs(left[i]) <= ceiling * 1.0001f);
+            ASSERT_EQ(left[i], right[i]);
+        }
+    }
+
+    // A quarter-rate sine sampled 45 degrees off its crests: sample peaks at
+    // 0.707, true peak 1.0. Only the true peak is over the ceiling.
+    {
+        LookaheadLimiter limiter;
+        limiter.init(2);
+        limiter.configure(96, 2400.0f, -1.0f);
+        std::vector<float> left(n), right(n);
+        for (uint32_t i = 0; i < n; i++) {
+            left[i] = right[i] = std::sin(1.5707963f * static_cast<float>(i) + 0.7853982f);
+        }
+        float peaks[2] = {};
+        limiter.processPlanar(left.data(), right.data(), n, peaks);
+        float settled = 0.0f;
+        for (uint32_t i = n / 2; i < n; i++) {
+            settled = std::max(settled, std::fabs(left[i]));
+        }
+        ASSERT_NEAR(settled, 0.70710678f * ceiling, 0.01f);
+    }
+
+    PASS();
+}
+
+TEST(engine_lookahead_limiter_mode) {
+    radioform_preset_t preset;
+    radioform_dsp_preset_init_flat(&preset);
+    preset.limiter_enabled = true;
+    preset.limiter_threshold_db = -2.0f;
+    preset.preamp_db = 12.0f;
+
+    auto* engine = radioform_dsp_create(48000);
+    ASSERT_EQ(radioform_dsp_apply_preset(engine, &preset), RADIOFORM_OK);
+    ASSERT_EQ(radioform_dsp_get_latency_frames(engine), 0u);
+
+    // The reported latency is the installed configuration's, so it changes
+    // when the next buffer takes the new configuration
+    float frame[2] = {};
+    auto install = [&] { radioform_dsp_process_interleaved(engine, frame, frame, 1); };
+
+    ASSERT_EQ(radioform_dsp_set_limiter_mode(engine, RADIOFORM_LIMITER_MODE_LOOKAHEAD, 0.5f, 100.0f),
+              RADIOFORM_ERROR_INVALID_PARAM);
+    ASSERT_EQ(radioform_dsp_set_limiter_mode(engine, RADIOFORM_LIMITER_MODE_LOOKAHEAD, 2.0f, 2000.0f),
+              RADIOFORM_ERROR_INVALID_PARAM);
+    ASSERT_EQ(radioform_dsp_set_limiter_mode(engine, RADIOFORM_LIMITER_MODE_LOOKAHEAD, 2.0f, 50.0f),
+              RADIOFORM_OK);
+    ASSERT_EQ(radioform_dsp_get_latency_frames(engine), 0u);
+    install();
+    ASSERT_EQ(radioform_dsp_get_latency_frames(engine), 96u + LookaheadLimiter::kDetectorDelay);
+
+    // +12 dB into a -2 dB ceiling, both process paths
+    const float ceiling = std::pow(10.0f, -2.0f / 20.0f);
+    const uint32_t n = 24000;
+    auto mono = generate_white_noise(n, 0.5f);
+    std::vector<float> interleaved(n * 2);
+    for (uint32_t i = 0; i < n; i++) {
+        interleaved[i * 2] = mono[i];
+        interleaved[i * 2 + 1] = -mono[i];
+    }
+    auto left = mono;
+    auto right = mono;
+    for (uint32_t offset = 0; offset < n; offset += 512) {
+        radioform_dsp_process_interleaved(engine, interleaved.data() + offset * 2,
+                                          interleaved.data() + offset * 2, std::min(512u, n - offset));
+    }
+    radioform_dsp_reset(engine);
+    radioform_dsp_process_planar(engine, left.data(), right.data(), left.data(), right.data(), n);
+    for (uint32_t i = 0; i < n; i++) {
+        ASSERT(std::fabs(interleaved[i * 2]) <= ceiling * 1.0001f);
+        ASSERT(std::fabs(interleaved[i * 2 + 1]) <= ceiling * 1.0001f);
+        ASSERT(std::fabs(left[i]) <= ceiling * 1.0001f);
+    }
+    radioform_stats_t stats;
+    radioform_dsp_get_stats(engine, &stats);
+    ASSERT(stats.peak_left_db <= -2.0f + 0.001f);
+
+    // Latency follows the preset's limiter switch and the sample rate
+    preset.limiter_enabled = false;
+    ASSERT_EQ(radioform_dsp_apply_preset(engine, &preset), RADIOFORM_OK);
+    install();
+    ASSERT_EQ(radioform_dsp_get_latency_frames(engine), 0u);
+    preset.limiter_enabled = true;
+    ASSERT_EQ(radioform_dsp_apply_preset(engine, &preset), RADIOFORM_OK);
+    ASSERT_EQ(radioform_dsp_set_sample_rate(engine, 96000), RADIOFORM_OK);
+    install();
+    ASSERT_EQ(radioform_dsp_get_latency_frames(engine), 192u + LookaheadLimiter::kDetectorDelay);
+
+    ASSERT_EQ(radioform_dsp_set_limiter_mode(engine, RADIOFORM_LIMITER_MODE_SOFT, 2.0f, 50.0f),
+              RADIOFORM_OK);
+    install();
+    ASSERT_EQ(radioform_dsp_get_latency_frames(engine), 0u);
+
+    radioform_dsp_destroy(engine);
+    PASS();
+}
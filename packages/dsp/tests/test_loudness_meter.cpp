@@ -0,0 +1,192 @@
+/**
+ * @file test_loudness_meter.cpp
+ * @brief Tests for the BS.1770 loudness meter (EBU Tech 3341 reference signals)
+ */
+
+#include "test_utils.h"
+#include "radioform_dsp.h"
+#include "loudness_meter.h"
+
+#include <cmath>
+#include <limits>
+
+using namespace dsp_test;
+using namespace radioform;
+
+namespace {
+
+// 1 kHz sine at level_dbfs (peak), continuing the phase of earlier segments
+void append_tone(std::vector<float>& x, double seconds, double level_dbfs, double sample_rate) {
+    const size_t start = x.size();
+    const size_t n = static_cast<size_t>(seconds * sample_rate);
+    const double amplitude = std::pow(10.0, level_dbfs / 20.0);
+    for (size_t i = start; i < start + n; i++) {
+        x.push_back(static_cast<float>(amplitude * std::sin(2.0 * M_PI * 1000.0 * i / sample_rate)));
+    }
+}
+
+// Meter the same signal on both channels of a stereo meter
+void meter_stereo(LoudnessMeter& meter, const std::vector<float>& x, uint32_t chunk) {
+    for (size_t offset = 0; offset < x.size(); offset += chunk) {
+        const float* channels[2] = {x.data() + offset, x.data() + offset};
+        meter.process(channels, 1, static_cast<uint32_t>(std::min<size_t>(chunk, x.size() - offset)));
+    }
+}
+
+} // namespace
+
+TEST(loudness_meter_reads_reference_tones) {
+    // Tech 3341 cases 1 and 2: stereo 1 kHz at -23 / -33 dBFS reads the
+    // same in LUFS, at any sample rate
+    static LoudnessMeter meter;
+    for (float sample_rate : {44100.0f, 48000.0f, 96000.0f}) {
+        for (double level : {-23.0, -33.0}) {
+            meter.init(sample_rate, 2);
+            ASSERT_EQ(meter.integratedLufs(), LoudnessMeter::kFloorLufs);
+            std::vector<float> x;
+            append_tone(x, 20.0, level, sample_rate);
+            meter_stereo(meter, x, 479);
+            ASSERT_NEAR(meter.momentaryLufs(), static_cast<float>(level), 0.1f);
+            ASSERT_NEAR(meter.shortTermLufs(), static_cast<float>(level), 0.1f);
+            ASSERT_NEAR(meter.integratedLufs(), static_cast<float>(level), 0.1f);
+        }
+    }
+
+    // Windows follow the signal: silence empties momentary after 400 ms and
+    // short-term after 3 s. Only the three windows straddling the tone's end
+    // count towards the integrated reading (47 full windows, then 3/4, 2/4
+    // and 1/4 of one); the silent ones fall under the absolute gate.
+    meter.init(48000.0f, 2);
+    std::vector<float> x;
+    append_tone(x, 5.0, -23.0, 48000.0);
+    x.resize(x.size() + 24000, 0.0f);
+    meter_stereo(meter, x, 512);
+    ASSERT_EQ(meter.momentaryLufs(), LoudnessMeter::kFloorLufs);
+    ASSERT_NEAR(meter.shortTermLufs(), -23.0f + 10.0f * std::log10(25.0f / 30.0f), 0.1f);
+    ASSERT_NEAR(meter.integratedLufs(), -23.0f + 10.0f * std::log10(48.5f / 50.0f), 0.02f);
+
+    // Non-finite samples meter as silence
+    meter.init(48000.0f, 1);
+    std::vector<float> bad(48000, std::numeric_limits<float>::quiet_NaN());
+    const float* channels[1] = {bad.data()};
+    meter.process(channels, 1, 48000);
+    ASSERT_EQ(meter.momentaryLufs(), LoudnessMeter::kFloorLufs);
+    ASSERT_EQ(meter.integratedLufs(), LoudnessMeter::kFloorLufs);
+    PASS();
+}
+
+TEST(loudness_meter_gates_integrated_loudness) {
+    // Tech 3341 case 4: the -72 dBFS passages fall under the absolute gate
+    // and the -36 dBFS ones under the relative gate
+    static LoudnessMeter meter;
+    meter.init(48000.0f, 2);
+    std::vector<float> x;
+    append_tone(x, 10.0, -72.0, 48000.0);
+    append_tone(x, 20.0, -36.0, 48000.0);
+    append_tone(x, 60.0, -23.0, 48000.0);
+    append_tone(x, 20.0, -36.0, 48000.0);
+    append_tone(x, 10.0, -72.0, 48000.0);
+    meter_stereo(meter, x, 1024);
+    ASSERT_NEAR(meter.integratedLufs(), -23.0f, 0.1f);
+
+    // Tech 3341 case 3: two levels 10 LU apart are both above the relative
+    // gate, so the reading sits between them
+    meter.reset();
+    x.clear();
+    append_tone(x, 10.0, -26.0, 48000.0);
+    append_tone(x, 10.0, -20.0, 48000.0);
+    meter_stereo(meter, x, 1024);
+    const float expected = -0.691f + 10.0f * std::log10(
+        0.5f * (std::pow(10.0f, (-26.0f + 0.691f) / 10.0f) + std::pow(10.0f, (-20.0f + 0.691f) / 10.0f)));
+    ASSERT_NEAR(meter.integratedLufs(), expected, 0.1f);
+
+    // 5.1: the LFE does not count, surrounds count 1.41 (+1.5 dB)
+    meter.init(48000.0f, 6);
+    x.clear();
+    append_tone(x, 5.0, -23.0, 48000.0);
+    std::vector<float> silence(x.size(), 0.0f);
+    const float* lfe_only[6] = {silence.data(), silence.data(), silence.data(), x.data(),
+                                silence.data(), silence.data()};
+    meter.process(lfe_only, 1, static_cast<uint32_t>(x.size()));
+    ASSERT_EQ(meter.integratedLufs(), LoudnessMeter::kFloorLufs);
+    meter.reset();
+    const float* surround_only[6] = {silence.data(), silence.data(), silence.data(), silence.data(),
+                                     x.data(), silence.data()};
+    meter.process(surround_only, 1, static_cast<uint32_t>(x.size()));
+    ASSERT_NEAR(meter.integratedLufs(), -23.0f - 3.01f + 1.49f, 0.1f);
+    PASS();
+}
+
+TEST(engine_loudness_metering) {
+    radioform_preset_t preset;
+    radioform_dsp_preset_init_flat(&preset);
+    preset.limiter_enabled = false;
+
+    auto* engine = radioform_dsp_create(48000);
+    ASSERT_EQ(radioform_dsp_apply_preset(engine, &preset), RADIOFORM_OK);
+    ASSERT_EQ(radioform_dsp_get_loudness(engine, nullptr), RADIOFORM_ERROR_NULL_POINTER);
+
+    std::vector<float> tone;
+    append_tone(tone, 4.0, -23.0, 48000.0);
+    const uint32_t n = static_cast<uint32_t>(tone.size());
+    std::vector<float> interleaved(n * 2), output(n * 2);
+    for (uint32_t i = 0; i < n; i++) {
+        interleaved[i * 2] = interleaved[i * 2 + 1] = tone[i];
+    }
+
+    // Off by default
+    radioform_dsp_process_interleaved(engine, interleaved.data(), output.data(), n);
+    radioform_loudness_t loudness;
+    ASSERT_EQ(radioform_dsp_get_loudness(engine, &loudness), RADIOFORM_OK);
+    ASSERT_EQ(loudness.integrated_lufs, -120.0f);
+
+    radioform_dsp_set_loudness_metering(engine, true);
+    for (uint32_t offset = 0; offset < n; offset += 512) {
+        radioform_dsp_process_interleaved(engine, interleaved.data() + offset * 2,
+                                          output.data() + offset * 2, std::min(512u, n - offset));
+    }
+    radioform_dsp_get_loudness(engine, &loudness);
+    ASSERT_NEAR(loudness.momentary_lufs, -23.0f, 0.1f);
+    ASSERT_NEAR(loudness.short_term_lufs, -23.0f, 0.1f);
+    ASSERT_NEAR(loudness.integrated_lufs, -23.0f, 0.1f);
+
+    // Planar path, 6 dB quieter after a reset request
+    std::vector<float> quiet(n);
+    for (uint32_t i = 0; i < n; i++) {
+        quiet[i] = 0.5f * tone[i];
+    }
+    radioform_dsp_reset_loudness(engine);
+    radioform_dsp_process_planar(engine, quiet.data(), quiet.data(), output.data(), output.data() + n, n);
+    radioform_dsp_get_loudness(engine, &loudness);
+    ASSERT_NEAR(loudness.integrated_lufs, -29.02f, 0.1f);
+
+    // Readings follow the sample rate
+    ASSERT_EQ(radioform_dsp_set_sample_rate(engine, 96000), RADIOFORM_OK);
+    std::vector<float> tone_96k;
+    append_tone(tone_96k, 2.0, -23.0, 96000.0);
+    auto right_96k = tone_96k;
+    radioform_dsp_process_planar(engine, tone_96k.data(), right_96k.data(), tone_96k.data(),
+                                 right_96k.data(), static_cast<uint32_t>(tone_96k.size()));
+    radioform_dsp_get_loudness(engine, &loudness);
+    ASSERT_NEAR(loudness.integrated_lufs, -23.0f, 0.1f);
+
+    radioform_dsp_set_loudness_metering(engine, false);
+    radioform_dsp_get_loudness(engine, &loudness);
+    ASSERT_EQ(loudness.momentary_lufs, -120.0f);
+
+    // Multichannel engines meter every channel (left surround of 5.1 here)
+    auto* surround = radioform_dsp_create_with_channels(48000, 6);
+    ASSERT_EQ(radioform_dsp_apply_preset(surround, &preset), RADIOFORM_OK);
+    radioform_dsp_set_loudness_metering(surround, true);
+    std::vector<float> frames(n * 6, 0.0f);
+    for (uint32_t i = 0; i < n; i++) {
+        frames[i * 6 + 4] = tone[i];
+    }
+    radioform_dsp_process_interleaved(surround, frames.data(), frames.data(), n);
+    radioform_dsp_get_loudness(surround, &loudness);
+    ASSERT_NEAR(loudness.integrated_lufs, -23.0f - 3.01f + 1.49f, 0.1f);
+
+    radioform_dsp_destroy(surround);
+    radioform_dsp_destroy(engine);
+    PASS();
+}
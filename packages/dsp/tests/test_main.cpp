@@ -27,6 +27,9 @@ void test_biquad_low_pass_attenuates_high_freq();
 void test_biquad_high_pass_attenuates_low_freq();
 void test_biquad_peak_filter_boosts_at_center_freq();
 void test_biquad_reset_clears_state();
+void test_biquad_smooth_transition_keeps_channels_matched();
+void test_biquad_ramp_steps_stay_stable();
+void test_biquad_bank_matches_biquad();
 
 // Engine tests
 void test_engine_create_destroy();
@@ -40,6 +43,92 @@ void test_engine_limiter_prevents_clipping();
 void test_engine_update_band_gain_realtime();
 void test_engine_statistics_tracking();
 void test_engine_reset_clears_state();
+void test_engine_interleaved_matches_planar();
+void test_engine_interleaved_recovers_from_nan();
+void test_engine_interleaved_nan_input_does_not_latch();
+void test_engine_planar_sub_blocks_match_whole_buffer();
+void test_engine_ramp_steps_independent_of_buffer_size();
+
+// Stereo kernel tests
+void test_stereo_kernel_steady_matches_generic();
+void test_stereo_kernel_detects_ramps();
+
+// Parallel-form EQ tests
+void test_parallel_eq_design_matches_cascade();
+void test_parallel_eq_rejects_coincident_poles();
+void test_engine_parallel_mode_matches_cascade();
+void test_engine_parallel_mode_falls_back_to_cascade();
+void test_engine_parallel_mode_band_update_ramps();
+
+// Block state-space tests
+void test_block_iir_matches_recursive_cascade();
+void test_block_iir_recovers_from_nan();
+void test_block_iir_tracks_coefficient_changes();
+
+// Runtime dispatch tests
+void test_engine_reports_kernel_info();
+void test_dispatch_interleaved_kernels_agree();
+void test_dispatch_planar_kernels_agree();
+void test_dispatch_multichannel_kernels_agree();
+
+// State-variable filter tests
+void test_svf_matches_biquad_response();
+void test_svf_beats_float_biquad_at_low_relative_frequency();
+void test_engine_selects_svf_for_low_bands();
+void test_engine_band_topology_can_be_pinned();
+void test_engine_svf_paths_agree_across_preamp_ramp();
+
+// Multichannel engine tests
+void test_multichannel_engine_validates_channel_count();
+void test_multichannel_engine_matches_stereo_engines();
+void test_multichannel_planar_matches_interleaved();
+
+// Engine group tests
+void test_engine_group_validates_arguments();
+void test_engine_group_matches_standalone_engines();
+void test_engine_group_members_are_independent();
+
+// Parameter queue tests
+void test_parameter_queue_orders_and_coalesces();
+void test_engine_applies_latest_queued_update();
+void test_engine_parameter_updates_from_another_thread();
+
+// Configuration snapshot tests
+void test_config_snapshot_exchange_hands_over_latest();
+void test_engine_preset_swap_while_processing();
+void test_engine_group_preset_swap_while_processing();
+
+// Batch coefficient design tests
+void test_fast_math_error_is_bounded();
+void test_batch_design_matches_scalar_design();
+
+// Coefficient cache tests
+void test_coeff_cache_quantizes_and_evicts_with_clock();
+void test_engine_reuses_cached_coefficients();
+
+// Lookahead limiter tests
+void test_lookahead_limiter_delays_quiet_signals_unchanged();
+void test_lookahead_limiter_holds_true_peak_ceiling();
+void test_engine_lookahead_limiter_mode();
+
+// Oversampler tests
+void test_oversampler_round_trip_is_a_delay();
+void test_oversampler_filters_waveshaper_aliases();
+void test_engine_oversampled_limiter();
+
+// True-peak meter tests
+void test_true_peak_meter_matches_reference_interpolator();
+void test_engine_true_peak_metering();
+
+// Loudness meter tests
+void test_loudness_meter_reads_reference_tones();
+void test_loudness_meter_gates_integrated_loudness();
+void test_engine_loudness_metering();
+
+// Spectrum analyzer tests
+void test_real_fft_matches_direct_dft();
+void test_spectrum_tap_queues_whole_frames();
+void test_engine_spectrum_analyzer();
 
 // Frequency response tests
 void test_freq_response_flat_preset_is_transparent();
@@ -69,6 +158,9 @@ int main(int argc, char** argv) {
     REGISTER_TEST(biquad_high_pass_attenuates_low_freq);
     REGISTER_TEST(biquad_peak_filter_boosts_at_center_freq);
     REGISTER_TEST(biquad_reset_clears_state);
+    REGISTER_TEST(biquad_smooth_transition_keeps_channels_matched);
+    REGISTER_TEST(biquad_ramp_steps_stay_stable);
+    REGISTER_TEST(biquad_bank_matches_biquad);
 
     REGISTER_TEST(engine_create_destroy);
     REGISTER_TEST(engine_invalid_sample_rate);
@@ -81,6 +173,76 @@ int main(int argc, char** argv) {
     REGISTER_TEST(engine_update_band_gain_realtime);
     REGISTER_TEST(engine_statistics_tracking);
     REGISTER_TEST(engine_reset_clears_state);
+    REGISTER_TEST(engine_interleaved_matches_planar);
+    REGISTER_TEST(engine_interleaved_recovers_from_nan);
+    REGISTER_TEST(engine_interleaved_nan_input_does_not_latch);
+    REGISTER_TEST(engine_planar_sub_blocks_match_whole_buffer);
+    REGISTER_TEST(engine_ramp_steps_independent_of_buffer_size);
+
+    REGISTER_TEST(stereo_kernel_steady_matches_generic);
+    REGISTER_TEST(stereo_kernel_detects_ramps);
+
+    REGISTER_TEST(parallel_eq_design_matches_cascade);
+    REGISTER_TEST(parallel_eq_rejects_coincident_poles);
+    REGISTER_TEST(engine_parallel_mode_matches_cascade);
+    REGISTER_TEST(engine_parallel_mode_falls_back_to_cascade);
+    REGISTER_TEST(engine_parallel_mode_band_update_ramps);
+
+    REGISTER_TEST(block_iir_matches_recursive_cascade);
+    REGISTER_TEST(block_iir_recovers_from_nan);
+    REGISTER_TEST(block_iir_tracks_coefficient_changes);
+
+    REGISTER_TEST(engine_reports_kernel_info);
+    REGISTER_TEST(dispatch_interleaved_kernels_agree);
+    REGISTER_TEST(dispatch_planar_kernels_agree);
+    REGISTER_TEST(dispatch_multichannel_kernels_agree);
+
+    REGISTER_TEST(svf_matches_biquad_response);
+    REGISTER_TEST(svf_beats_float_biquad_at_low_relative_frequency);
+    REGISTER_TEST(engine_selects_svf_for_low_bands);
+    REGISTER_TEST(engine_band_topology_can_be_pinned);
+    REGISTER_TEST(engine_svf_paths_agree_across_preamp_ramp);
+
+    REGISTER_TEST(multichannel_engine_validates_channel_count);
+    REGISTER_TEST(multichannel_engine_matches_stereo_engines);
+    REGISTER_TEST(multichannel_planar_matches_interleaved);
+
+    REGISTER_TEST(engine_group_validates_arguments);
+    REGISTER_TEST(engine_group_matches_standalone_engines);
+    REGISTER_TEST(engine_group_members_are_independent);
+
+    REGISTER_TEST(parameter_queue_orders_and_coalesces);
+    REGISTER_TEST(engine_applies_latest_queued_update);
+    REGISTER_TEST(engine_parameter_updates_from_another_thread);
+
+    REGISTER_TEST(config_snapshot_exchange_hands_over_latest);
+    REGISTER_TEST(engine_preset_swap_while_processing);
+    REGISTER_TEST(engine_group_preset_swap_while_processing);
+
+    REGISTER_TEST(fast_math_error_is_bounded);
+    REGISTER_TEST(batch_design_matches_scalar_design);
+
+    REGISTER_TEST(coeff_cache_quantizes_and_evicts_with_clock);
+    REGISTER_TEST(engine_reuses_cached_coefficients);
+
+    REGISTER_TEST(lookahead_limiter_delays_quiet_signals_unchanged);
+    REGISTER_TEST(lookahead_limiter_holds_true_peak_ceiling);
+    REGISTER_TEST(engine_lookahead_limiter_mode);
+
+    REGISTER_TEST(oversampler_round_trip_is_a_delay);
+    REGISTER_TEST(oversampler_filters_waveshaper_aliases);
+    REGISTER_TEST(engine_oversampled_limiter);
+
+    REGISTER_TEST(true_peak_meter_matches_reference_interpolator);
+    REGISTER_TEST(engine_true_peak_metering);
+
+    REGISTER_TEST(loudness_meter_reads_reference_tones);
+    REGISTER_TEST(loudness_meter_gates_integrated_loudness);
+    REGISTER_TEST(engine_loudness_metering);
+
+    REGISTER_TEST(real_fft_matches_direct_dft);
+    REGISTER_TEST(spectrum_tap_queues_whole_frames);
+    REGISTER_TEST(engine_spectrum_analyzer);
 
     REGISTER_TEST(freq_response_flat_preset_is_transparent);
     REGISTER_TEST(freq_response_peak_filter_at_1khz);
@@ -0,0 +1,166 @@
+/**
+ * @file test_multichannel.cpp
+ * @brief Tests for engines with other than two channels
+ */
+
+#include "test_utils.h"
+#include "radioform_dsp.h"
+
+#include <limits>
+
+using namespace dsp_test;
+
+namespace {
+
+// A different signal on every channel, loud enough to reach the limiter
+std::vector<std::vector<float>> channel_signals(uint32_t num_channels, size_t num_frames) {
+    std::vector<std::vector<float>> signals;
+    for (uint32_t ch = 0; ch < num_channels; ch++) {
+        auto signal = generate_sine(num_frames, 40.0f + 700.0f * static_cast<float>(ch), 48000.0f);
+        auto noise = generate_white_noise(num_frames, 0.2f);
+        for (size_t i = 0; i < num_frames; i++) {
+            signal[i] = signal[i] * 0.3f * static_cast<float>(ch + 1) + noise[i];
+        }
+        signals.push_back(signal);
+    }
+    return signals;
+}
+
+} // namespace
+
+TEST(multichannel_engine_validates_channel_count) {
+    ASSERT(radioform_dsp_create_with_channels(48000, 0) == nullptr);
+    ASSERT(radioform_dsp_create_with_channels(48000, RADIOFORM_MAX_CHANNELS + 1) == nullptr);
+    ASSERT_EQ(radioform_dsp_get_num_channels(nullptr), 0u);
+
+    for (uint32_t channels = 1; channels <= RADIOFORM_MAX_CHANNELS; channels++) {
+        auto* engine = radioform_dsp_create_with_channels(48000, channels);
+        ASSERT(engine != nullptr);
+        ASSERT_EQ(radioform_dsp_get_num_channels(engine), channels);
+
+        // Parallel form is stereo-only
+        ASSERT_EQ(radioform_dsp_set_eq_mode(engine, RADIOFORM_EQ_MODE_PARALLEL), RADIOFORM_OK);
+        ASSERT_EQ(radioform_dsp_get_active_eq_mode(engine) == RADIOFORM_EQ_MODE_PARALLEL,
+                  channels == 2);
+        radioform_dsp_destroy(engine);
+    }
+
+    auto* stereo = radioform_dsp_create(48000);
+    ASSERT_EQ(radioform_dsp_get_num_channels(stereo), 2u);
+    radioform_dsp_destroy(stereo);
+
+    PASS();
+}
+
+TEST(multichannel_engine_matches_stereo_engines) {
+    // 5.1 and 7.1 must sound like one stereo engine per channel pair,
+    // including a band edit ramping part-way through
+    radioform_preset_t preset;
+    make_shelf_peak_preset(preset, 30.0f, {6.0f, -4.0f, 3.0f, 5.0f});
+    preset.limiter_enabled = true;
+    preset.limiter_threshold_db = -1.0f;
+
+    for (uint32_t channels : {6u, 8u}) {
+        const uint32_t num_frames = 4800;
+        auto signals = channel_signals(channels, num_frames);
+
+        auto* engine = radioform_dsp_create_with_channels(48000, channels);
+        ASSERT(engine != nullptr);
+        ASSERT_EQ(radioform_dsp_apply_preset(engine, &preset), RADIOFORM_OK);
+        ASSERT_EQ(radioform_dsp_get_band_topology(engine, 0), RADIOFORM_TOPOLOGY_SVF);
+
+        std::vector<float> interleaved(num_frames * channels);
+        for (uint32_t i = 0; i < num_frames; i++) {
+            for (uint32_t ch = 0; ch < channels; ch++) {
+                interleaved[i * channels + ch] = signals[ch][i];
+            }
+        }
+
+        // Odd-sized calls so blocks and ramp steps do not line up
+        const uint32_t split = 1001;
+        radioform_dsp_process_interleaved(engine, interleaved.data(), interleaved.data(), split);
+        radioform_dsp_update_band_gain(engine, 1, 4.0f);
+        radioform_dsp_update_band_gain(engine, 0, -2.0f);
+        radioform_dsp_process_interleaved(engine, interleaved.data() + split * channels,
+                                          interleaved.data() + split * channels, num_frames - split);
+
+        for (uint32_t pair = 0; pair < channels / 2; pair++) {
+            auto* stereo = radioform_dsp_create(48000);
+            ASSERT_EQ(radioform_dsp_apply_preset(stereo, &preset), RADIOFORM_OK);
+            std::vector<float> frames(num_frames * 2);
+            for (uint32_t i = 0; i < num_frames; i++) {
+                frames[i * 2] = signals[pair * 2][i];
+                frames[i * 2 + 1] = signals[pair * 2 + 1][i];
+            }
+            radioform_dsp_process_interleaved(stereo, frames.data(), frames.data(), split);
+            radioform_dsp_update_band_gain(stereo, 1, 4.0f);
+            radioform_dsp_update_band_gain(stereo, 0, -2.0f);
+            radioform_dsp_process_interleaved(stereo, frames.data() + split * 2,
+                                              frames.data() + split * 2, num_frames - split);
+
+            for (uint32_t i = 0; i < num_frames; i++) {
+                ASSERT_NEAR(interleaved[i * channels + pair * 2], frames[i * 2], 1e-4f);
+                ASSERT_NEAR(interleaved[i * channels + pair * 2 + 1], frames[i * 2 + 1], 1e-4f);
+            }
+            radioform_dsp_destroy(stereo);
+        }
+
+        radioform_dsp_destroy(engine);
+    }
+
+    PASS();
+}
+
+TEST(multichannel_planar_matches_interleaved) {
+    radioform_preset_t preset;
+    make_shelf_peak_preset(preset, 30.0f, {6.0f, -4.0f, 3.0f, 5.0f});
+    preset.limiter_enabled = true;
+    preset.limiter_threshold_db = -1.0f;
+
+    for (uint32_t channels : {1u, 3u, 6u}) {
+        const uint32_t num_frames = 2000;
+        auto signals = channel_signals(channels, num_frames);
+        signals[0][500] = std::numeric_limits<float>::quiet_NaN();
+
+        auto* planar = radioform_dsp_create_with_channels(48000, channels);
+        auto* interleaved = radioform_dsp_create_with_channels(48000, channels);
+        ASSERT_EQ(radioform_dsp_apply_preset(planar, &preset), RADIOFORM_OK);
+        ASSERT_EQ(radioform_dsp_apply_preset(interleaved, &preset), RADIOFORM_OK);
+
+        std::vector<float> frames(num_frames * channels);
+        for (uint32_t i = 0; i < num_frames; i++) {
+            for (uint32_t ch = 0; ch < channels; ch++) {
+                frames[i * channels + ch] = signals[ch][i];
+            }
+        }
+        const float* inputs[RADIOFORM_MAX_CHANNELS];
+        float* outputs[RADIOFORM_MAX_CHANNELS];
+        for (uint32_t ch = 0; ch < channels; ch++) {
+            inputs[ch] = signals[ch].data();
+            outputs[ch] = signals[ch].data();
+        }
+
+        radioform_dsp_process_channels(planar, inputs, outputs, num_frames);
+        radioform_dsp_process_interleaved(interleaved, frames.data(), frames.data(), num_frames);
+
+        for (uint32_t i = 0; i < num_frames; i++) {
+            for (uint32_t ch = 0; ch < channels; ch++) {
+                ASSERT_EQ(signals[ch][i], frames[i * channels + ch]);
+                ASSERT(std::isfinite(signals[ch][i]));
+            }
+        }
+
+        // NaN in channel 0 leaves the others untouched and does not latch
+        ASSERT(!is_silent(std::vector<float>(signals[0].end() - 100, signals[0].end())));
+
+        radioform_stats_t stats;
+        radioform_dsp_get_stats(planar, &stats);
+        ASSERT_EQ(stats.frames_processed, static_cast<uint64_t>(num_frames));
+        ASSERT(stats.peak_left_db > -20.0f);
+
+        radioform_dsp_destroy(planar);
+        radioform_dsp_destroy(interleaved);
+    }
+
+    PASS();
+}
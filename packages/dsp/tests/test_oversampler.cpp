@@ -0,0 +1,181 @@
+/**
+ * @file test_oversampler.cpp
+ * @brief Tests for the half-band oversampler and the oversampled limiter
+ */
+
+#include "test_utils.h"
+#include "radioform_dsp.h"
+#include "oversampler.h"
+#include "limiter.h"
+
+#include <cmath>
+
+using namespace dsp_test;
+using namespace radioform;
+
+namespace {
+
+// Amplitude of one frequency in x[start..] (single-bin DFT)
+float tone_level(const std::vector<float>& x, size_t start, double frequency, double sample_rate) {
+    const double w = 2.0 * M_PI * frequency / sample_rate;
+    double re = 0.0, im = 0.0;
+    for (size_t i = start; i < x.size(); i++) {
+        re += x[i] * std::cos(w * static_cast<double>(i));
+        im -= x[i] * std::sin(w * static_cast<double>(i));
+    }
+    return static_cast<float>(2.0 * std::sqrt(re * re + im * im) / static_cast<double>(x.size() - start));
+}
+
+} // namespace
+
+TEST(oversampler_round_trip_is_a_delay) {
+    static Oversampler oversampler;
+    oversampler.init();
+
+    // Passband tones come back delayed by the reported latency, in odd-sized calls
+    for (uint32_t factor : {2u, 4u, 8u}) {
+        for (double frequency : {1000.0, 12000.0, 18000.0}) {
+            oversampler.setFactor(factor);
+            ASSERT_EQ(oversampler.factor(), factor);
+            const uint32_t n = 4800;
+            std::vector<float> x(n);
+            for (uint32_t i = 0; i < n; i++) {
+                x[i] = 0.5f * static_cast<float>(std::sin(2.0 * M_PI * frequency * i / 48000.0));
+            }
+            uint32_t stage_samples = 0;
+            for (uint32_t offset = 0; offset < n; offset += 100) {
+                oversampler.processChannel(1, x.data() + offset, 1, std::min(100u, n - offset),
+                    [&](float*, uint32_t count) { stage_samples += count; });
+            }
+            ASSERT_EQ(stage_samples, n * factor);
+
+            const double latency = Oversampler::latencyFrames(factor);
+            for (uint32_t i = 200; i < n; i++) {
+                const double expected = 0.5 * std::sin(2.0 * M_PI * frequency * (i - latency) / 48000.0);
+                ASSERT_NEAR(x[i], static_cast<float>(expected), 5e-4f);
+            }
+        }
+    }
+    ASSERT_NEAR(Oversampler::latencyFrames(1), 0.0f, 0.0f);
+    ASSERT_NEAR(Oversampler::latencyFrames(2), 23.0f, 1e-6f);
+    ASSERT_NEAR(Oversampler::latencyFrames(8), 30.25f, 1e-6f);
+    PASS();
+}
+
+TEST(oversampler_filters_waveshaper_aliases) {
+    static Oversampler oversampler;
+    oversampler.init();
+    HardClipper clipper;
+    clipper.init(1.0f);
+
+    // A 4.7 kHz sine clipped hard: the 7th harmonic (32.9 kHz) aliases to
+    // 15.1 kHz and the 11th (51.7 kHz) to 3.7 kHz at the base rate
+    float alias_db[4] = {};
+    const uint32_t factors[4] = {1, 2, 4, 8};
+    for (uint32_t f = 0; f < 4; f++) {
+        oversampler.setFactor(factors[f]);
+        const uint32_t n = 24000;
+        std::vector<float> x(n);
+        for (uint32_t i = 0; i < n; i++) {
+            x[i] = 2.0f * static_cast<float>(std::sin(2.0 * M_PI * 4700.0 * i / 48000.0));
+        }
+        const float peak = oversampler.processChannel(0, x.data(), 1, n, [&](float* samples, uint32_t count) {
+            for (uint32_t i = 0; i < count; i++) {
+                samples[i] = clipper.processSample(samples[i]);
+            }
+        });
+        ASSERT(peak >= 1.0f && peak < 1.3f);  // Decimation ringing only
+        const float alias = std::max(tone_level(x, 4800, 15100.0, 48000.0),
+                                     tone_level(x, 4800, 3700.0, 48000.0));
+        alias_db[f] = gain_to_db(alias);
+        ASSERT_NEAR(tone_level(x, 4800, 4700.0, 48000.0), 1.218f, 0.01f);
+    }
+    ASSERT(alias_db[0] > -45.0f);
+    for (uint32_t f = 1; f < 4; f++) {
+        ASSERT(alias_db[f] < -85.0f);
+    }
+    PASS();
+}
+
+TEST(engine_oversampled_limiter) {
+    radioform_preset_t preset;
+    radioform_dsp_preset_init_flat(&preset);
+    preset.limiter_enabled = true;
+    preset.limiter_threshold_db = -3.0f;
+    preset.preamp_db = 12.0f;
+
+    auto* engine = radioform_dsp_create(48000);
+    float frame[2] = {};
+    auto install = [&] { radioform_dsp_process_interleaved(engine, frame, frame, 1); };
+    ASSERT_EQ(radioform_dsp_apply_preset(engine, &preset), RADIOFORM_OK);
+    ASSERT_EQ(radioform_dsp_set_limiter_oversampling(engine, 3), RADIOFORM_ERROR_INVALID_PARAM);
+    ASSERT_EQ(radioform_dsp_set_limiter_oversampling(engine, 16), RADIOFORM_ERROR_INVALID_PARAM);
+    ASSERT_EQ(radioform_dsp_set_limiter_oversampling(engine, 2), RADIOFORM_OK);
+    install();
+    ASSERT_EQ(radioform_dsp_get_latency_frames(engine), 23u);
+    ASSERT_EQ(radioform_dsp_set_limiter_oversampling(engine, 8), RADIOFORM_OK);
+    install();
+    ASSERT_EQ(radioform_dsp_get_latency_frames(engine), 30u);
+    ASSERT_EQ(radioform_dsp_set_limiter_oversampling(engine, 4), RADIOFORM_OK);
+    install();
+    ASSERT_EQ(radioform_dsp_get_latency_frames(engine), 29u);
+
+    // +12 dB of full-band noise into the waveshaper: bounded output on both
+    // paths (decimation removes the clipped harmonics, so peaks land a few
+    // dB over the threshold), and the limiter stays odd-symmetric
+    const float ceiling = std::pow(10.0f, -3.0f / 20.0f);
+    const uint32_t n = 12000;
+    auto mono = generate_white_noise(n, 0.5f);
+    std::vector<float> interleaved(n * 2);
+    for (uint32_t i = 0; i < n; i++) {
+        interleaved[i * 2] = mono[i];
+        interleaved[i * 2 + 1] = -mono[i];
+    }
+    auto left = mono;
+    auto right = mono;
+    for (uint32_t offset = 0; offset < n; offset += 333) {
+        radioform_dsp_process_interleaved(engine, interleaved.data() + offset * 2,
+                                          interleaved.data() + offset * 2, std::min(333u, n - offset));
+    }
+    radioform_dsp_reset(engine);
+    radioform_dsp_process_planar(engine, left.data(), right.data(), left.data(), right.data(), n);
+    for (uint32_t i = 0; i < n; i++) {
+        ASSERT_EQ(interleaved[i * 2 + 1], -interleaved[i * 2]);
+        ASSERT(std::fabs(interleaved[i * 2]) <= ceiling * 1.6f);
+        ASSERT(std::fabs(left[i]) <= ceiling * 1.6f);
+        ASSERT_EQ(left[i], right[i]);
+    }
+    radioform_stats_t stats;
+    radioform_dsp_get_stats(engine, &stats);
+    ASSERT(stats.peak_left_db > -6.0f && stats.peak_left_db < -3.0f + 4.1f);
+
+    // Multichannel engines oversample every channel
+    auto* surround = radioform_dsp_create_with_channels(48000, 3);
+    ASSERT_EQ(radioform_dsp_apply_preset(surround, &preset), RADIOFORM_OK);
+    ASSERT_EQ(radioform_dsp_set_limiter_oversampling(surround, 2), RADIOFORM_OK);
+    std::vector<float> frames(n * 3);
+    for (uint32_t i = 0; i < n; i++) {
+        frames[i * 3] = frames[i * 3 + 1] = frames[i * 3 + 2] = mono[i];
+    }
+    radioform_dsp_process_interleaved(surround, frames.data(), frames.data(), n);
+    for (uint32_t i = 0; i < n; i++) {
+        ASSERT(std::fabs(frames[i * 3 + 2]) <= ceiling * 1.6f);
+        ASSERT_EQ(frames[i * 3 + 2], frames[i * 3]);
+    }
+
+    // Oversampling only applies while the soft limiter is in use
+    ASSERT_EQ(radioform_dsp_set_limiter_mode(engine, RADIOFORM_LIMITER_MODE_LOOKAHEAD, 2.0f, 50.0f),
+              RADIOFORM_OK);
+    install();
+    ASSERT_EQ(radioform_dsp_get_latency_frames(engine), 96u + 6u);
+    ASSERT_EQ(radioform_dsp_set_limiter_mode(engine, RADIOFORM_LIMITER_MODE_SOFT, 2.0f, 50.0f),
+              RADIOFORM_OK);
+    preset.limiter_enabled = false;
+    ASSERT_EQ(radioform_dsp_apply_preset(engine, &preset), RADIOFORM_OK);
+    install();
+    ASSERT_EQ(radioform_dsp_get_latency_frames(engine), 0u);
+
+    radioform_dsp_destroy(surround);
+    radioform_dsp_destroy(engine);
+    PASS();
+}
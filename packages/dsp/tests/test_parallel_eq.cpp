@@ -0,0 +1,244 @@
+/**
+ * @file test_parallel_eq.cpp
+ * @brief Tests for the parallel-form EQ
+ */
+
+#include "test_utils.h"
+#include "radioform_dsp.h"
+#include "parallel_eq.h"
+#include "dispatch.h"
+
+using namespace radioform;
+using namespace dsp_test;
+
+namespace {
+
+// Ten bands spread over the spectrum, similar to the bundled presets
+void init_ten_band_preset(radioform_preset_t& preset) {
+    const float freqs[] = {32, 64, 125, 250, 500, 1000, 2000, 4000, 8000, 16000};
+    const float gains[] = {5, 4, 2, -1, -2, 1, 2, 3, 4, 5};
+
+    radioform_dsp_preset_init_flat(&preset);
+    preset.num_bands = 10;
+    for (uint32_t b = 0; b < 10; b++) {
+        preset.bands[b] = {freqs[b], gains[b], 1.414f, RADIOFORM_FILTER_PEAK, true};
+    }
+    preset.bands[0].type = RADIOFORM_FILTER_LOW_SHELF;
+    preset.bands[9].type = RADIOFORM_FILTER_HIGH_SHELF;
+    preset.preamp_db = -3.0f;
+}
+
+// Run the same signal through an engine, interleaved, in 256-frame buffers
+std::vector<float> render(radioform_dsp_engine_t* engine, const std::vector<float>& input) {
+    std::vector<float> output(input.size());
+    const size_t num_frames = input.size() / 2;
+    for (size_t offset = 0; offset < num_frames; offset += 256) {
+        radioform_dsp_process_interleaved(
+            engine, input.data() + offset * 2, output.data() + offset * 2, 256);
+    }
+    return output;
+}
+
+std::vector<float> stereo_noise(size_t num_frames) {
+    auto left = generate_white_noise(num_frames, 0.25f);
+    auto right = generate_sine(num_frames, 1000.0f, 48000.0f);
+    std::vector<float> input(num_frames * 2);
+    for (size_t i = 0; i < num_frames; i++) {
+        input[i * 2] = left[i];
+        input[i * 2 + 1] = right[i] * 0.5f;
+    }
+    return input;
+}
+
+} // namespace
+
+TEST(parallel_eq_design_matches_cascade) {
+    const radioform_filter_type_t types[] = {
+        RADIOFORM_FILTER_LOW_SHELF, RADIOFORM_FILTER_PEAK, RADIOFORM_FILTER_NOTCH,
+        RADIOFORM_FILTER_BAND_PASS, RADIOFORM_FILTER_HIGH_SHELF
+    };
+
+    Biquad bands[5];
+    BiquadCoeffs coeffs[5];
+    for (int b = 0; b < 5; b++) {
+        radioform_band_t band = {60.0f * (b + 1) * (b + 1), 6.0f, 1.0f, types[b], true};
+        bands[b].init();
+        bands[b].setCoeffs(band, 48000.0f);
+        coeffs[b] = bands[b].coeffs();
+    }
+
+    ParallelDesign design;
+    ASSERT(design_parallel(coeffs, 5, design));
+    ASSERT_EQ(design.num_sections, 5u);
+
+    ParallelEQ parallel;
+    parallel.init();
+    parallel.setDesign(design);
+    ASSERT_EQ(parallel.numGroups(4), 3u);
+    ASSERT_EQ(parallel.numGroups(8), 2u);
+
+    auto left = generate_white_noise(4096, 0.5f);
+    auto right = generate_impulse(4096);
+    auto cascade_left = left;
+    auto cascade_right = right;
+
+    baseline::kKernelTable.parallel_eq(parallel, left.data(), right.data(), 4096);
+    for (int b = 0; b < 5; b++) {
+        bands[b].processBuffer(
+            cascade_left.data(), cascade_right.data(),
+            cascade_left.data(), cascade_right.data(), 4096);
+    }
+
+    for (size_t i = 0; i < left.size(); i++) {
+        ASSERT_NEAR(left[i], cascade_left[i], 1e-4f);
+        ASSERT_NEAR(right[i], cascade_right[i], 1e-4f);
+    }
+
+    PASS();
+}
+
+TEST(parallel_eq_rejects_coincident_poles) {
+    // Two identical bands share their poles: no partial-fraction expansion
+    Biquad bq;
+    bq.init();
+    bq.setCoeffs({100.0f, 6.0f, 1.0f, RADIOFORM_FILTER_PEAK, true}, 48000.0f);
+    const BiquadCoeffs coeffs[2] = {bq.coeffs(), bq.coeffs()};
+
+    ParallelDesign design;
+    ASSERT(!design_parallel(coeffs, 2, design));
+
+    // An empty cascade is just the direct term
+    ASSERT(design_parallel(coeffs, 0, design));
+    ASSERT_EQ(design.direct, 1.0f);
+
+    PASS();
+}
+
+TEST(engine_parallel_mode_matches_cascade) {
+    auto* cascade = radioform_dsp_create(48000);
+    auto* parallel = radioform_dsp_create(48000);
+    ASSERT(cascade != nullptr);
+    ASSERT(parallel != nullptr);
+
+    ASSERT_EQ(radioform_dsp_set_eq_mode(parallel, RADIOFORM_EQ_MODE_PARALLEL), RADIOFORM_OK);
+    ASSERT_EQ(radioform_dsp_set_eq_mode(parallel, static_cast<radioform_eq_mode_t>(7)),
+              RADIOFORM_ERROR_INVALID_PARAM);
+
+    radioform_preset_t preset;
+    init_ten_band_preset(preset);
+    radioform_dsp_apply_preset(cascade, &preset);
+    radioform_dsp_apply_preset(parallel, &preset);
+    ASSERT_EQ(radioform_dsp_get_active_eq_mode(parallel), RADIOFORM_EQ_MODE_PARALLEL);
+    ASSERT_EQ(radioform_dsp_get_active_eq_mode(cascade), RADIOFORM_EQ_MODE_CASCADE);
+
+    const size_t num_frames = 4096;
+    auto input = stereo_noise(num_frames);
+    auto out_cascade = render(cascade, input);
+    auto out_parallel = render(parallel, input);
+
+    for (size_t i = 0; i < out_cascade.size(); i++) {
+        ASSERT_NEAR(out_parallel[i], out_cascade[i], 1e-3f);
+    }
+
+    // The planar path runs the same sections
+    auto* planar = radioform_dsp_create(48000);
+    ASSERT(planar != nullptr);
+    radioform_dsp_set_eq_mode(planar, RADIOFORM_EQ_MODE_PARALLEL);
+    radioform_dsp_apply_preset(planar, &preset);
+
+    std::vector<float> left(num_frames);
+    std::vector<float> right(num_frames);
+    for (size_t i = 0; i < num_frames; i++) {
+        left[i] = input[i * 2];
+        right[i] = input[i * 2 + 1];
+    }
+    radioform_dsp_process_planar(
+        planar, left.data(), right.data(), left.data(), right.data(), num_frames);
+    for (size_t i = 0; i < num_frames; i++) {
+        ASSERT_NEAR(left[i], out_parallel[i * 2], 1e-3f);
+        ASSERT_NEAR(right[i], out_parallel[i * 2 + 1], 1e-3f);
+    }
+
+    radioform_dsp_destroy(cascade);
+    radioform_dsp_destroy(parallel);
+    radioform_dsp_destroy(planar);
+    PASS();
+}
+
+TEST(engine_parallel_mode_falls_back_to_cascade) {
+    auto* cascade = radioform_dsp_create(48000);
+    auto* parallel = radioform_dsp_create(48000);
+    ASSERT(cascade != nullptr);
+    ASSERT(parallel != nullptr);
+
+    radioform_dsp_set_eq_mode(parallel, RADIOFORM_EQ_MODE_PARALLEL);
+
+    // Duplicate bands have coincident poles
+    radioform_preset_t preset;
+    radioform_dsp_preset_init_flat(&preset);
+    preset.num_bands = 2;
+    preset.bands[0] = {200.0f, 4.0f, 1.0f, RADIOFORM_FILTER_PEAK, true};
+    preset.bands[1] = preset.bands[0];
+    radioform_dsp_apply_preset(cascade, &preset);
+    radioform_dsp_apply_preset(parallel, &preset);
+
+    ASSERT_EQ(radioform_dsp_get_eq_mode(parallel), RADIOFORM_EQ_MODE_PARALLEL);
+    ASSERT_EQ(radioform_dsp_get_active_eq_mode(parallel), RADIOFORM_EQ_MODE_CASCADE);
+
+    auto input = stereo_noise(1024);
+    ASSERT(signals_identical(render(parallel, input), render(cascade, input)));
+
+    // A well-conditioned preset switches back to parallel form
+    preset.bands[1].frequency_hz = 2000.0f;
+    radioform_dsp_apply_preset(parallel, &preset);
+    ASSERT_EQ(radioform_dsp_get_active_eq_mode(parallel), RADIOFORM_EQ_MODE_PARALLEL);
+
+    radioform_dsp_destroy(cascade);
+    radioform_dsp_destroy(parallel);
+    PASS();
+}
+
+TEST(engine_parallel_mode_band_update_ramps) {
+    auto* cascade = radioform_dsp_create(48000);
+    auto* parallel = radioform_dsp_create(48000);
+    ASSERT(cascade != nullptr);
+    ASSERT(parallel != nullptr);
+
+    radioform_dsp_set_eq_mode(parallel, RADIOFORM_EQ_MODE_PARALLEL);
+
+    radioform_preset_t preset;
+    init_ten_band_preset(preset);
+    radioform_dsp_apply_preset(cascade, &preset);
+    radioform_dsp_apply_preset(parallel, &preset);
+
+    radioform_dsp_update_band_gain(cascade, 5, -8.0f);
+    radioform_dsp_update_band_gain(parallel, 5, -8.0f);
+    radioform_dsp_update_band_frequency(cascade, 7, 3000.0f);
+    radioform_dsp_update_band_frequency(parallel, 7, 3000.0f);
+    ASSERT_EQ(radioform_dsp_get_active_eq_mode(parallel), RADIOFORM_EQ_MODE_PARALLEL);
+
+    // Smooth through the ramp (1 kHz tone, band 5 sits on it)
+    std::vector<float> input(8192 * 2);
+    auto tone = generate_sine(8192, 1000.0f, 48000.0f);
+    for (size_t i = 0; i < tone.size(); i++) {
+        input[i * 2] = tone[i] * 0.5f;
+        input[i * 2 + 1] = tone[i] * 0.5f;
+    }
+    auto out_cascade = render(cascade, input);
+    auto out_parallel = render(parallel, input);
+
+    std::vector<float> left(tone.size());
+    for (size_t i = 0; i < tone.size(); i++) {
+        left[i] = out_parallel[i * 2];
+    }
+    ASSERT(!has_discontinuities(left, 0.1f));
+
+    // Both structures end at the same filter once the ramps are done
+    for (size_t i = 4096 * 2; i < out_cascade.size(); i++) {
+        ASSERT_NEAR(out_parallel[i], out_cascade[i], 1e-3f);
+    }
+
+    radioform_dsp_destroy(cascade);
+    radioform_dsp_destroy(parallel);
+    PASS();
+}
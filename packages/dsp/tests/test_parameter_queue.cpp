@@ -0,0 +1,210 @@
+/**
+ * @file test_parameter_queue.cpp
+ * @brief Tests for the realtime parameter handoff to the audio thread
+ */
+
+#include "test_utils.h"
+#include "radioform_dsp.h"
+#include "parameter_queue.h"
+
+#include <atomic>
+#include <cmath>
+#include <thread>
+
+using namespace dsp_test;
+using namespace radioform;
+
+namespace {
+
+std::vector<float> interleave(const std::vector<float>& mono) {
+    std::vector<float> frames(mono.size() * 2);
+    for (size_t i = 0; i < mono.size(); i++) {
+        frames[i * 2] = mono[i];
+        frames[i * 2 + 1] = -0.5f * mono[i];
+    }
+    return frames;
+}
+
+} // namespace
+
+TEST(parameter_queue_orders_and_coalesces) {
+    // Ring: FIFO order across the wrap point, full at capacity
+    SpscQueue<uint32_t, 4> queue;
+    uint32_t value = 0;
+    for (uint32_t round = 0; round < 3; round++) {
+        for (uint32_t i = 0; i < 4; i++) {
+            ASSERT(queue.push(round * 10 + i));
+        }
+        ASSERT(!queue.push(99));
+        ASSERT_EQ(queue.size(), 4u);
+        for (uint32_t i = 0; i < 4; i++) {
+            ASSERT(queue.pop(value));
+            ASSERT_EQ(value, round * 10 + i);
+        }
+        ASSERT(!queue.pop(value));
+    }
+
+    // Mailbox: only the latest unread value is seen, once
+    Mailbox<int> mailbox;
+    ASSERT(mailbox.take() == nullptr);
+    mailbox.back() = 1;
+    ASSERT(mailbox.publish());
+    mailbox.back() = 2;
+    ASSERT(!mailbox.publish());
+    const int* latest = mailbox.take();
+    ASSERT(latest != nullptr);
+    ASSERT_EQ(*latest, 2);
+    ASSERT(mailbox.take() == nullptr);
+    mailbox.back() = 3;
+    ASSERT(mailbox.publish());
+    latest = mailbox.take();
+    ASSERT(latest != nullptr);
+    ASSERT_EQ(*latest, 3);
+
+    // Pending list: each target once, however often it is published
+    ParameterQueue updates;
+    for (int i = 0; i < 100; i++) {
+        updates.band(3).epoch = static_cast<uint32_t>(i);
+        updates.publish(3);
+        updates.preamp().gain = static_cast<float>(i);
+        updates.publish(ParameterQueue::kPreampTarget);
+    }
+    int band_calls = 0, preamp_calls = 0, parallel_calls = 0;
+    uint32_t band_index = 0, band_epoch = 0;
+    float preamp_gain = 0.0f;
+    updates.drain(
+        [&](uint32_t band, const BandUpdate& update) {
+            band_index = band;
+            band_epoch = update.epoch;
+            band_calls++;
+        },
+        [&](const PreampUpdate& update) {
+            preamp_gain = update.gain;
+            preamp_calls++;
+        },
+        [&](const ParallelUpdate&) { parallel_calls++; });
+    ASSERT_EQ(band_calls, 1);
+    ASSERT_EQ(preamp_calls, 1);
+    ASSERT_EQ(parallel_calls, 0);
+    ASSERT_EQ(band_index, 3u);
+    ASSERT_EQ(band_epoch, 99u);
+    ASSERT_NEAR(preamp_gain, 99.0f, 0.0f);
+
+    PASS();
+}
+
+TEST(engine_applies_latest_queued_update) {
+    const uint32_t n = 4800;
+    const auto input = interleave(generate_white_noise(n, 0.3f));
+    // A low shelf low enough to run as an SVF, then biquad bands
+    radioform_preset_t preset;
+    make_shelf_peak_preset(preset, 25.0f, {3.0f, 3.0f, 3.0f, 3.0f});
+    preset.preamp_db = -2.0f;
+    preset.limiter_enabled = false;
+
+    for (int parallel = 0; parallel < 2; parallel++) {
+        const radioform_eq_mode_t mode = parallel ? RADIOFORM_EQ_MODE_PARALLEL : RADIOFORM_EQ_MODE_CASCADE;
+        auto* burst = radioform_dsp_create(48000);
+        auto* single = radioform_dsp_create(48000);
+        for (auto* engine : {burst, single}) {
+            radioform_dsp_set_eq_mode(engine, mode);
+            radioform_dsp_apply_preset(engine, &preset);
+        }
+
+        // Many edits between two buffers cost the audio thread one update
+        for (int i = 0; i < 50; i++) {
+            const float step = static_cast<float>(i);
+            for (uint32_t b = 0; b < preset.num_bands; b++) {
+                radioform_dsp_update_band_gain(burst, b, -6.0f + 0.2f * step);
+                radioform_dsp_update_band_q(burst, b, 0.5f + 0.03f * step);
+            }
+            radioform_dsp_update_preamp(burst, -0.1f * step);
+        }
+        for (uint32_t b = 0; b < preset.num_bands; b++) {
+            radioform_dsp_update_band_gain(single, b, -6.0f + 0.2f * 49.0f);
+            radioform_dsp_update_band_q(single, b, 0.5f + 0.03f * 49.0f);
+        }
+        radioform_dsp_update_preamp(single, -4.9f);
+
+        std::vector<float> out_burst(n * 2), out_single(n * 2);
+        radioform_dsp_process_interleaved(burst, input.data(), out_burst.data(), n);
+        radioform_dsp_process_interleaved(single, input.data(), out_single.data(), n);
+        ASSERT(signals_identical(out_burst, out_single));
+
+        radioform_dsp_destroy(burst);
+        radioform_dsp_destroy(single);
+    }
+
+    PASS();
+}
+
+TEST(engine_parameter_updates_from_another_thread) {
+    const uint32_t block = 256;
+    const uint32_t n = 48000;
+    const auto input = interleave(generate_white_noise(n, 0.3f));
+    // A low shelf low enough to run as an SVF, then biquad bands
+    radioform_preset_t preset;
+    make_shelf_peak_preset(preset, 25.0f, {3.0f, 3.0f, 3.0f, 3.0f});
+    preset.preamp_db = -2.0f;
+    preset.limiter_enabled = false;
+
+    auto* engine = radioform_dsp_create(48000);
+    radioform_dsp_apply_preset(engine, &preset);
+
+    // Updates queued for a preset that is then replaced are dropped
+    radioform_dsp_update_band_gain(engine, 1, 12.0f);
+    radioform_dsp_update_preamp(engine, -12.0f);
+    radioform_dsp_apply_preset(engine, &preset);
+    auto* reference = radioform_dsp_create(48000);
+    radioform_dsp_apply_preset(reference, &preset);
+    std::vector<float> output(n * 2), expected(n * 2);
+    radioform_dsp_process_interleaved(engine, input.data(), output.data(), block);
+    radioform_dsp_process_interleaved(reference, input.data(), expected.data(), block);
+    for (uint32_t i = 0; i < block * 2; i++) {
+        ASSERT_NEAR(output[i], expected[i], 0.0f);
+    }
+    radioform_dsp_destroy(reference);
+
+    // Slider automation while the audio thread runs, with the preset
+    // re-applied now and then (edits right after an apply must survive)
+    std::atomic<bool> running{true};
+    std::thread ui([&] {
+        for (int step = 0; running.load(); step++) {
+            if (step % 8 == 0) {
+                radioform_preset_t current;
+                radioform_dsp_get_preset(engine, &current);
+                radioform_dsp_apply_preset(engine, &current);
+            }
+            const float phase = static_cast<float>(step) * 0.1f;
+            radioform_dsp_update_band_gain(engine, step % 4, 9.0f * std::sin(phase));
+            radioform_dsp_update_band_frequency(engine, 2, 2000.0f * std::pow(2.0f, std::sin(phase)));
+            radioform_dsp_update_preamp(engine, -3.0f + 2.0f * std::sin(phase));
+            std::this_thread::yield();
+        }
+    });
+    for (uint32_t offset = 0; offset + block <= n; offset += block) {
+        radioform_dsp_process_interleaved(engine, input.data() + offset * 2, output.data() + offset * 2, block);
+    }
+    running.store(false);
+    ui.join();
+    for (float sample : output) {
+        ASSERT(std::isfinite(sample));
+    }
+
+    // Once the updates settle, the engine sounds like its final configuration
+    radioform_preset_t final_preset;
+    radioform_dsp_get_preset(engine, &final_preset);
+    reference = radioform_dsp_create(48000);
+    radioform_dsp_apply_preset(reference, &final_preset);
+    for (uint32_t offset = 0; offset + block <= n; offset += block) {
+        radioform_dsp_process_interleaved(engine, input.data() + offset * 2, output.data() + offset * 2, block);
+        radioform_dsp_process_interleaved(reference, input.data() + offset * 2, expected.data() + offset * 2, block);
+    }
+    for (uint32_t i = n; i < n * 2; i++) {
+        ASSERT_NEAR(output[i], expected[i], 1e-4f);
+    }
+
+    radioform_dsp_destroy(engine);
+    radioform_dsp_destroy(reference);
+    PASS();
+}
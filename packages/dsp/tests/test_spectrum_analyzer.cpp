@@ -0,0 +1,195 @@
+/**
+ * @file test_spectrum_analyzer.cpp
+ * @brief Tests for the split-radix FFT, the spectrum tap and the analyzer
+ */
+
+#include "test_utils.h"
+#include "radioform_dsp.h"
+#include "fft.h"
+#include "spectrum_analyzer.h"
+
+#include <cmath>
+
+using namespace dsp_test;
+using namespace radioform;
+
+namespace {
+
+// Bin of a spectrum whose range contains frequency
+uint32_t bin_at(const radioform_spectrum_t& spectrum, float frequency) {
+    uint32_t best = 0;
+    for (uint32_t b = 1; b < spectrum.num_bins; b++) {
+        if (std::fabs(std::log(spectrum.frequency_hz[b] / frequency)) <
+            std::fabs(std::log(spectrum.frequency_hz[best] / frequency))) {
+            best = b;
+        }
+    }
+    return best;
+}
+
+} // namespace
+
+TEST(real_fft_matches_direct_dft) {
+    static RealFFT fft;
+    ASSERT(!fft.init(12));
+    ASSERT(!fft.init(8));
+    ASSERT(!fft.init(16384));
+
+    for (uint32_t n : {16u, 32u, 64u, 256u, 1024u}) {
+        ASSERT(fft.init(n));
+        auto x = generate_white_noise(n, 1.0f);
+        std::vector<float> power(n / 2 + 1);
+        fft.powerSpectrum(x.data(), power.data());
+
+        double total = 0.0;
+        for (uint32_t k = 0; k <= n / 2; k++) {
+            total += power[k];
+        }
+        for (uint32_t k = 0; k <= n / 2; k++) {
+            double re = 0.0, im = 0.0;
+            for (uint32_t i = 0; i < n; i++) {
+                const double angle = -2.0 * M_PI * static_cast<double>(k) * i / n;
+                re += x[i] * std::cos(angle);
+                im += x[i] * std::sin(angle);
+            }
+            const double expected = re * re + im * im;
+            ASSERT(std::fabs(power[k] - expected) <= 1e-5 * total / (n / 2));
+        }
+    }
+    PASS();
+}
+
+TEST(spectrum_tap_queues_whole_frames) {
+    // Bulk push/pop wrap around the ring and stop at its ends
+    SpscQueue<float, 8> queue;
+    const float in[6] = {1, 2, 3, 4, 5, 6};
+    float out[8] = {};
+    ASSERT_EQ(queue.push(in, 6), 6u);
+    ASSERT_EQ(queue.pop(out, 4), 4u);
+    ASSERT_EQ(queue.push(in, 6), 6u);  // Wraps
+    ASSERT_EQ(queue.push(in, 6), 0u);  // Full
+    ASSERT_EQ(queue.pop(out, 8), 8u);
+    const float expected[8] = {5, 6, 1, 2, 3, 4, 5, 6};
+    for (uint32_t i = 0; i < 8; i++) {
+        ASSERT_EQ(out[i], expected[i]);
+    }
+    ASSERT_EQ(queue.pop(out, 8), 0u);
+
+    // Planar and interleaved writes queue the same frames; overflow is dropped
+    static SpectrumTap tap;
+    const uint32_t n = 300;
+    auto left = generate_white_noise(n, 1.0f);
+    auto right = generate_white_noise(n, 0.5f);
+    std::vector<float> interleaved(n * 2);
+    for (uint32_t i = 0; i < n; i++) {
+        interleaved[i * 2] = left[i];
+        interleaved[i * 2 + 1] = right[i];
+    }
+    tap.write(left.data(), right.data(), 1, n);
+    tap.write(interleaved.data(), interleaved.data() + 1, 2, n);
+    std::vector<float> frames(n * 4);
+    ASSERT_EQ(tap.read(frames.data(), n * 2), n * 2);
+    for (uint32_t i = 0; i < n * 2; i++) {
+        ASSERT_EQ(frames[i], interleaved[i]);
+        ASSERT_EQ(frames[n * 2 + i], interleaved[i]);
+    }
+
+    std::vector<float> silence(SpectrumTap::kCapacityFrames * 2, 0.0f);
+    tap.write(silence.data(), silence.data() + 1, 2, SpectrumTap::kCapacityFrames - 10);
+    tap.write(left.data(), right.data(), 1, 100);
+    ASSERT_EQ(tap.droppedFrames(), 90u);
+    ASSERT_EQ(tap.read(silence.data(), SpectrumTap::kCapacityFrames), SpectrumTap::kCapacityFrames);
+    PASS();
+}
+
+TEST(engine_spectrum_analyzer) {
+    radioform_preset_t preset;
+    radioform_dsp_preset_init_flat(&preset);
+    preset.limiter_enabled = false;
+
+    auto* engine = radioform_dsp_create(48000);
+    ASSERT_EQ(radioform_dsp_apply_preset(engine, &preset), RADIOFORM_OK);
+
+    radioform_spectrum_config_t config;
+    radioform_dsp_spectrum_config_init_default(&config);
+    config.fft_size = 3000;
+    ASSERT_EQ(radioform_dsp_configure_spectrum(engine, &config), RADIOFORM_ERROR_INVALID_PARAM);
+    radioform_dsp_spectrum_config_init_default(&config);
+    config.max_frequency_hz = 30000.0f;
+    ASSERT_EQ(radioform_dsp_configure_spectrum(engine, &config), RADIOFORM_ERROR_INVALID_PARAM);
+    radioform_dsp_spectrum_config_init_default(&config);
+    config.num_bins = RADIOFORM_MAX_SPECTRUM_BINS + 1;
+    ASSERT_EQ(radioform_dsp_configure_spectrum(engine, &config), RADIOFORM_ERROR_INVALID_PARAM);
+    config.num_bins = 120;
+    ASSERT_EQ(radioform_dsp_configure_spectrum(engine, &config), RADIOFORM_OK);
+
+    // Nothing is queued while the tap is off. The tone sits on FFT bin 88
+    // (no scalloping loss).
+    const uint32_t n = 48000;
+    const float tone_hz = 88.0f * 48000.0f / 4096.0f;
+    auto tone = generate_sine(n, tone_hz, 48000.0f);
+    std::vector<float> left(n), right(n);
+    for (uint32_t i = 0; i < n; i++) {
+        left[i] = right[i] = 0.5f * tone[i];
+    }
+    radioform_spectrum_t spectrum;
+    radioform_dsp_process_planar(engine, left.data(), right.data(), left.data(), right.data(), 512);
+    ASSERT_EQ(radioform_dsp_analyze_spectrum(engine, &spectrum), RADIOFORM_OK);
+    ASSERT_EQ(spectrum.frames_analyzed, 0u);
+    ASSERT_EQ(spectrum.num_bins, 120u);
+
+    // A -6 dBFS tone reads -6 dB in its bin and stays out of distant ones,
+    // analyzed as the UI would (every few buffers)
+    radioform_dsp_set_spectrum_tap(engine, true);
+    std::vector<float> interleaved(n * 2);
+    for (uint32_t i = 0; i < n; i++) {
+        interleaved[i * 2] = interleaved[i * 2 + 1] = 0.5f * tone[i];
+    }
+    for (uint32_t offset = 0; offset < n; offset += 512) {
+        const uint32_t frames = std::min(512u, n - offset);
+        radioform_dsp_process_interleaved(engine, interleaved.data() + offset * 2,
+                                          interleaved.data() + offset * 2, frames);
+        if ((offset / 512) % 3 == 2) {
+            radioform_dsp_analyze_spectrum(engine, &spectrum);
+        }
+    }
+    radioform_dsp_analyze_spectrum(engine, &spectrum);
+    ASSERT_EQ(spectrum.frames_analyzed, static_cast<uint64_t>(n));
+    ASSERT_EQ(spectrum.frames_dropped, 0u);
+    const uint32_t tone_bin = bin_at(spectrum, tone_hz);
+    ASSERT_NEAR(spectrum.magnitude_db[tone_bin], -6.02f, 0.1f);
+    ASSERT_NEAR(spectrum.peak_db[tone_bin], -6.02f, 0.1f);
+    ASSERT(spectrum.magnitude_db[bin_at(spectrum, 100.0f)] < -80.0f);
+    ASSERT(spectrum.magnitude_db[bin_at(spectrum, 10000.0f)] < -80.0f);
+    ASSERT(spectrum.frequency_hz[0] > 20.0f && spectrum.frequency_hz[119] < 20000.0f);
+
+    // Two seconds of silence: the average decays (200 ms time constant, so
+    // ~43 dB), the peak is held for 1 s and then falls at 20 dB/s. Then the
+    // ring overflows while nothing is analyzed.
+    std::vector<float> silence(n * 2, 0.0f);
+    for (int second = 0; second < 2; second++) {
+        for (uint32_t offset = 0; offset < n; offset += 512) {
+            radioform_dsp_process_interleaved(engine, silence.data() + offset * 2,
+                                              silence.data() + offset * 2, std::min(512u, n - offset));
+            if ((offset / 512) % 3 == 2) {
+                radioform_dsp_analyze_spectrum(engine, &spectrum);
+            }
+        }
+    }
+    radioform_dsp_analyze_spectrum(engine, &spectrum);
+    ASSERT(spectrum.magnitude_db[tone_bin] < -40.0f);
+    ASSERT(spectrum.peak_db[tone_bin] < -20.0f && spectrum.peak_db[tone_bin] > -40.0f);
+    radioform_dsp_process_interleaved(engine, silence.data(), silence.data(), n);
+    radioform_dsp_analyze_spectrum(engine, &spectrum);
+    ASSERT(spectrum.frames_dropped > 0);
+
+    // Bins follow the sample rate (top edge down to the new Nyquist)
+    ASSERT_EQ(radioform_dsp_set_sample_rate(engine, 32000), RADIOFORM_OK);
+    radioform_dsp_analyze_spectrum(engine, &spectrum);
+    ASSERT_EQ(spectrum.num_bins, 120u);
+    ASSERT_EQ(spectrum.frames_analyzed, 0u);
+    ASSERT(spectrum.frequency_hz[119] < 16000.0f && spectrum.frequency_hz[119] > 15000.0f);
+
+    radioform_dsp_destroy(engine);
+    PASS();
+}
@@ -0,0 +1,107 @@
+/**
+ * @file test_stereo_kernel.cpp
+ * @brief Tests for the vectorized stereo kernels
+ */
+
+#include "test_utils.h"
+#include "stereo_kernel.h"
+#include "dispatch.h"
+
+using namespace radioform;
+using namespace dsp_test;
+
+namespace {
+
+struct KernelFixture {
+    BiquadBank cascade;
+    ParameterSmoother preamp;
+    StereoDCBlocker dc_blocker;
+    SoftLimiter limiter;
+    StereoChain chain;
+
+    KernelFixture(uint32_t num_bands, bool limiter_enabled) {
+        cascade.init();
+        const radioform_filter_type_t types[] = {
+            RADIOFORM_FILTER_LOW_SHELF, RADIOFORM_FILTER_PEAK, RADIOFORM_FILTER_HIGH_SHELF,
+            RADIOFORM_FILTER_NOTCH, RADIOFORM_FILTER_PEAK
+        };
+        for (uint32_t b = 0; b < RADIOFORM_MAX_BANDS; b++) {
+            const radioform_band_t band = make_band(
+                types[b % 5], 40.0f * static_cast<float>(b + 1) * static_cast<float>(b + 1),
+                (b % 2 == 0) ? 4.0f : -3.0f, 1.2f);
+            Biquad design;
+            design.init();
+            design.setCoeffs(band, 48000.0f);
+            cascade.setCoeffs(b, design.coeffs());
+        }
+        cascade.setNumSections(num_bands);
+        chain.cascade = &cascade;
+        chain.parallel = nullptr;
+
+        preamp.init(48000.0f, 10.0f);
+        preamp.setValue(radioform::db_to_gain(3.0f));
+        dc_blocker.init(48000.0f, 5.0f);
+        limiter.init(-1.0f);
+
+        chain.preamp = &preamp;
+        chain.dc_blocker = &dc_blocker;
+        chain.limiter = limiter_enabled ? &limiter : nullptr;
+    }
+};
+
+} // namespace
+
+TEST(stereo_kernel_steady_matches_generic) {
+    const size_t num_frames = 512;
+    auto left = generate_sine(num_frames, 220.0f, 48000.0f);
+    auto right = generate_sine(num_frames, 5000.0f, 48000.0f);
+    std::vector<float> input(num_frames * 2);
+    for (size_t i = 0; i < num_frames; i++) {
+        input[i * 2] = left[i];
+        input[i * 2 + 1] = right[i];
+    }
+
+    // Within each kernel set, every table entry must match the generic kernel exactly
+    const KernelTable* tables[4];
+    const uint32_t num_tables = supported_kernel_tables(detect_cpu_features(), tables, 4);
+    ASSERT(num_tables >= 1);
+
+    for (uint32_t t = 0; t < num_tables; t++) {
+        for (uint32_t num_bands = 0; num_bands <= RADIOFORM_MAX_BANDS; num_bands++) {
+            for (int limiter = 0; limiter < 2; limiter++) {
+                KernelFixture steady(num_bands, limiter != 0);
+                KernelFixture generic(num_bands, limiter != 0);
+
+                const StereoKernels kernels = tables[t]->select_stereo(steady.chain);
+                ASSERT(kernels.steady != nullptr);
+                ASSERT(!stereo_chain_ramping(steady.chain));
+
+                std::vector<float> out_steady(input.size());
+                std::vector<float> out_generic(input.size());
+                StereoPeak peak_steady = kernels.steady(
+                    steady.chain, input.data(), out_steady.data(), num_frames);
+                StereoPeak peak_generic = kernels.ramping(
+                    generic.chain, input.data(), out_generic.data(), num_frames);
+
+                ASSERT(signals_identical(out_steady, out_generic));
+                ASSERT_EQ(peak_steady.left, peak_generic.left);
+                ASSERT_EQ(peak_steady.right, peak_generic.right);
+            }
+        }
+    }
+
+    PASS();
+}
+
+TEST(stereo_kernel_detects_ramps) {
+    KernelFixture fixture(3, false);
+    ASSERT(!stereo_chain_ramping(fixture.chain));
+
+    // Preamp ramp
+    fixture.preamp.setTarget(1.0f);
+    ASSERT(stereo_chain_ramping(fixture.chain));
+    fixture.preamp.setValue(1.0f);
+    ASSERT(!stereo_chain_ramping(fixture.chain));
+
+    PASS();
+}
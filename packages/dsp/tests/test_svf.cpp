@@ -0,0 +1,308 @@
+/**
+ * @file test_svf.cpp
+ * @brief Tests for the state-variable filter topology
+ */
+
+#include "test_utils.h"
+#include "radioform_dsp.h"
+#include "biquad.h"
+#include "svf.h"
+
+using namespace radioform;
+using namespace dsp_test;
+
+namespace {
+
+// RBJ peaking filter designed and run in double precision
+std::vector<double> reference_peak(const std::vector<float>& input, const radioform_band_t& band,
+                                   double sample_rate) {
+    const double pi = 3.14159265358979323846;
+    const double w0 = 2.0 * pi * band.frequency_hz / sample_rate;
+    const double alpha = std::sin(w0) / (2.0 * band.q_factor);
+    const double A = std::pow(10.0, band.gain_db / 40.0);
+    const double a0 = 1.0 + alpha / A;
+    const double b0 = (1.0 + alpha * A) / a0;
+    const double b1 = -2.0 * std::cos(w0) / a0;
+    const double b2 = (1.0 - alpha * A) / a0;
+    const double a1 = b1;
+    const double a2 = (1.0 - alpha / A) / a0;
+
+    std::vector<double> output(input.size());
+    double x1 = 0.0, x2 = 0.0, y1 = 0.0, y2 = 0.0;
+    for (size_t i = 0; i < input.size(); i++) {
+        const double x = input[i];
+        const double y = b0 * x + b1 * x1 + b2 * x2 - a1 * y1 - a2 * y2;
+        x2 = x1;
+        x1 = x;
+        y2 = y1;
+        y1 = y;
+        output[i] = y;
+    }
+    return output;
+}
+
+float rms_error(const std::vector<float>& signal, const std::vector<double>& reference) {
+    double sum = 0.0;
+    for (size_t i = 0; i < signal.size(); i++) {
+        const double e = signal[i] - reference[i];
+        sum += e * e;
+    }
+    return static_cast<float>(std::sqrt(sum / static_cast<double>(signal.size())));
+}
+
+} // namespace
+
+TEST(svf_matches_biquad_response) {
+    const radioform_filter_type_t types[] = {
+        RADIOFORM_FILTER_PEAK, RADIOFORM_FILTER_LOW_SHELF, RADIOFORM_FILTER_HIGH_SHELF,
+        RADIOFORM_FILTER_LOW_PASS, RADIOFORM_FILTER_HIGH_PASS, RADIOFORM_FILTER_NOTCH,
+        RADIOFORM_FILTER_BAND_PASS
+    };
+
+    // Low enough that the biquad's bandwidth prewarping is off (w0 < 0.01)
+    for (radioform_filter_type_t type : types) {
+        const radioform_band_t band = make_band(type, 60.0f, 6.0f, 0.9f);
+
+        Biquad bq;
+        bq.init();
+        bq.setCoeffs(band, 48000.0f);
+        StateVariableFilter svf;
+        svf.init();
+        svf.setCoeffs(band, 48000.0f);
+
+        auto left = generate_impulse(8192);
+        auto right = generate_impulse(8192);
+        std::vector<float> expected(left.size());
+        bq.processBuffer(left.data(), left.data(), expected.data(), expected.data(), 8192);
+        svf.processPlanar(left.data(), right.data(), 8192);
+
+        for (size_t i = 0; i < left.size(); i++) {
+            ASSERT_NEAR(left[i], expected[i], 1e-4f);
+            ASSERT_EQ(left[i], right[i]);
+        }
+    }
+
+    PASS();
+}
+
+TEST(svf_beats_float_biquad_at_low_relative_frequency) {
+    // 25 Hz at 192 kHz: f/fs ~ 1.3e-4, where float biquad coefficients lose
+    // most of their precision
+    const radioform_band_t band = make_band(RADIOFORM_FILTER_PEAK, 25.0f, 9.0f, 2.0f);
+    const float sample_rate = 192000.0f;
+    ASSERT(svf_preferred(band, sample_rate));
+
+    const auto input = generate_white_noise(96000, 0.5f);
+    const auto reference = reference_peak(input, band, sample_rate);
+
+    Biquad bq;
+    bq.init();
+    bq.setCoeffs(band, sample_rate);
+    std::vector<float> biquad_out(input.size());
+    bq.processBuffer(input.data(), input.data(), biquad_out.data(), biquad_out.data(),
+                     static_cast<uint32_t>(input.size()));
+
+    StateVariableFilter svf;
+    svf.init();
+    svf.setCoeffs(band, sample_rate);
+    auto svf_left = input;
+    auto svf_right = input;
+    svf.processPlanar(svf_left.data(), svf_right.data(), static_cast<uint32_t>(input.size()));
+
+    const float biquad_error = rms_error(biquad_out, reference);
+    const float svf_error = rms_error(svf_left, reference);
+    ASSERT(svf_error < 1e-5f);
+    ASSERT(svf_error * 10.0f < biquad_error);
+
+    PASS();
+}
+
+TEST(engine_selects_svf_for_low_bands) {
+    radioform_preset_t preset;
+    radioform_dsp_preset_init_flat(&preset);
+    preset.num_bands = 2;
+    preset.bands[0] = make_band(RADIOFORM_FILTER_PEAK, 100.0f, 6.0f, 1.0f);
+    preset.bands[1] = make_band(RADIOFORM_FILTER_PEAK, 1000.0f, -3.0f, 1.0f);
+    preset.limiter_enabled = false;
+
+    // 100 Hz is a biquad band at 48 kHz and an SVF band at 192 kHz
+    auto* engine = radioform_dsp_create(48000);
+    ASSERT(engine != nullptr);
+    ASSERT_EQ(radioform_dsp_apply_preset(engine, &preset), RADIOFORM_OK);
+    ASSERT_EQ(radioform_dsp_get_band_topology(engine, 0), RADIOFORM_TOPOLOGY_BIQUAD);
+    ASSERT_EQ(radioform_dsp_get_band_topology(engine, 1), RADIOFORM_TOPOLOGY_BIQUAD);
+
+    ASSERT_EQ(radioform_dsp_set_sample_rate(engine, 192000), RADIOFORM_OK);
+    ASSERT_EQ(radioform_dsp_get_band_topology(engine, 0), RADIOFORM_TOPOLOGY_SVF);
+    ASSERT_EQ(radioform_dsp_get_band_topology(engine, 1), RADIOFORM_TOPOLOGY_BIQUAD);
+    ASSERT_EQ(radioform_dsp_get_band_topology(engine, 5), RADIOFORM_TOPOLOGY_BIQUAD);
+
+    // The SVF band still applies its boost, in both processing paths
+    const uint32_t num_frames = 96000;
+    auto left = generate_sine(num_frames, 100.0f, 192000.0f);
+    for (float& x : left) {
+        x *= 0.25f;
+    }
+    auto right = left;
+    std::vector<float> interleaved(num_frames * 2);
+    for (uint32_t i = 0; i < num_frames; i++) {
+        interleaved[i * 2] = left[i];
+        interleaved[i * 2 + 1] = right[i];
+    }
+
+    // Let the preamp settle (the sample rate change restarts its smoother)
+    std::vector<float> scratch(num_frames, 0.0f);
+    radioform_dsp_process_planar(engine, scratch.data(), scratch.data(), scratch.data(),
+                                 scratch.data(), num_frames);
+
+    radioform_dsp_reset(engine);
+    radioform_dsp_process_planar(engine, left.data(), right.data(), left.data(), right.data(),
+                                 num_frames);
+    radioform_dsp_reset(engine);
+    radioform_dsp_process_interleaved(engine, interleaved.data(), interleaved.data(), num_frames);
+
+    std::vector<float> settled(left.begin() + num_frames / 2, left.end());
+    const float gain_db = gain_to_db(measure_peak(settled) / 0.25f);
+    ASSERT_NEAR(gain_db, 6.0f, 0.3f);
+    for (uint32_t i = 0; i < num_frames; i++) {
+        ASSERT_NEAR(interleaved[i * 2], left[i], 1e-4f);
+    }
+
+    // Realtime edits ramp the SVF band like any other
+    radioform_dsp_update_band_gain(engine, 0, -6.0f);
+    auto tail = generate_sine(num_frames, 100.0f, 192000.0f);
+    for (float& x : tail) {
+        x *= 0.25f;
+    }
+    auto tail_right = tail;
+    radioform_dsp_process_planar(engine, tail.data(), tail_right.data(), tail.data(),
+                                 tail_right.data(), num_frames);
+    ASSERT(!has_discontinuities(tail, 0.05f));
+    std::vector<float> settled_tail(tail.begin() + num_frames / 2, tail.end());
+    ASSERT_NEAR(gain_to_db(measure_peak(settled_tail) / 0.25f), -6.0f, 0.3f);
+
+    radioform_dsp_destroy(engine);
+    PASS();
+}
+
+TEST(engine_band_topology_can_be_pinned) {
+    const radioform_filter_type_t types[] = {
+        RADIOFORM_FILTER_PEAK, RADIOFORM_FILTER_LOW_SHELF, RADIOFORM_FILTER_HIGH_SHELF,
+        RADIOFORM_FILTER_LOW_PASS, RADIOFORM_FILTER_HIGH_PASS, RADIOFORM_FILTER_NOTCH,
+        RADIOFORM_FILTER_BAND_PASS
+    };
+    const uint32_t num_frames = 8192;
+    auto noise = generate_white_noise(num_frames, 0.3f);
+
+    auto* biquad_engine = radioform_dsp_create(48000);
+    auto* svf_engine = radioform_dsp_create(48000);
+    ASSERT_EQ(radioform_dsp_set_band_topology(svf_engine, 0, RADIOFORM_TOPOLOGY_SVF), RADIOFORM_OK);
+    ASSERT_EQ(radioform_dsp_set_band_topology(svf_engine, RADIOFORM_MAX_BANDS, RADIOFORM_TOPOLOGY_SVF),
+              RADIOFORM_ERROR_INVALID_PARAM);
+
+    // Every type runs on the SVF with the biquad's response
+    for (radioform_filter_type_t type : types) {
+        radioform_preset_t preset;
+        radioform_dsp_preset_init_flat(&preset);
+        preset.num_bands = 1;
+        preset.bands[0] = make_band(type, 2000.0f, 6.0f, 1.5f);
+        preset.limiter_enabled = false;
+        ASSERT_EQ(radioform_dsp_apply_preset(biquad_engine, &preset), RADIOFORM_OK);
+        ASSERT_EQ(radioform_dsp_apply_preset(svf_engine, &preset), RADIOFORM_OK);
+        ASSERT_EQ(radioform_dsp_get_band_topology(biquad_engine, 0), RADIOFORM_TOPOLOGY_BIQUAD);
+        ASSERT_EQ(radioform_dsp_get_band_topology(svf_engine, 0), RADIOFORM_TOPOLOGY_SVF);
+
+        radioform_dsp_reset(biquad_engine);
+        radioform_dsp_reset(svf_engine);
+        auto biquad_left = noise, biquad_right = noise, svf_left = noise, svf_right = noise;
+        radioform_dsp_process_planar(biquad_engine, biquad_left.data(), biquad_right.data(),
+                                     biquad_left.data(), biquad_right.data(), num_frames);
+        radioform_dsp_process_planar(svf_engine, svf_left.data(), svf_right.data(),
+                                     svf_left.data(), svf_right.data(), num_frames);
+        for (uint32_t i = 0; i < num_frames; i++) {
+            ASSERT_NEAR(svf_left[i], biquad_left[i], 1e-5f);
+        }
+    }
+
+    // Fast automation: a full-range gain sweep, a new target every 32 frames
+    radioform_preset_t preset;
+    radioform_dsp_preset_init_flat(&preset);
+    preset.num_bands = 1;
+    preset.bands[0] = make_band(RADIOFORM_FILTER_PEAK, 1000.0f, 0.0f, 2.0f);
+    preset.limiter_enabled = false;
+    ASSERT_EQ(radioform_dsp_apply_preset(svf_engine, &preset), RADIOFORM_OK);
+    auto sine = generate_sine(num_frames, 1000.0f, 48000.0f);
+    std::vector<float> interleaved(num_frames * 2);
+    for (uint32_t i = 0; i < num_frames; i++) {
+        interleaved[i * 2] = interleaved[i * 2 + 1] = 0.05f * sine[i];
+    }
+    for (uint32_t offset = 0; offset < num_frames; offset += 32) {
+        const float phase = static_cast<float>(offset) / static_cast<float>(num_frames);
+        radioform_dsp_update_band_gain(svf_engine, 0, 12.0f * std::sin(6.2831853f * 4.0f * phase));
+        radioform_dsp_process_interleaved(svf_engine, interleaved.data() + offset * 2,
+                                          interleaved.data() + offset * 2, 32);
+    }
+    std::vector<float> left(num_frames);
+    for (uint32_t i = 0; i < num_frames; i++) {
+        ASSERT(std::isfinite(interleaved[i * 2]));
+        left[i] = interleaved[i * 2];
+    }
+    ASSERT(!has_discontinuities(left, 0.05f));
+
+    // Back to the automatic choice
+    ASSERT_EQ(radioform_dsp_set_band_topology(svf_engine, 0, RADIOFORM_TOPOLOGY_AUTO), RADIOFORM_OK);
+    ASSERT_EQ(radioform_dsp_get_band_topology(svf_engine, 0), RADIOFORM_TOPOLOGY_BIQUAD);
+
+    radioform_dsp_destroy(biquad_engine);
+    radioform_dsp_destroy(svf_engine);
+    PASS();
+}
+
+TEST(engine_svf_paths_agree_across_preamp_ramp) {
+    radioform_preset_t preset;
+    radioform_dsp_preset_init_flat(&preset);
+    preset.num_bands = 1;
+    preset.bands[0] = make_band(RADIOFORM_FILTER_PEAK, 100.0f, 12.0f, 2.0f);
+    preset.limiter_enabled = false;
+
+    // The preamp runs ahead of the SVF band in both paths, so a preamp ramp
+    // leaves the same history in its state
+    auto* planar_engine = radioform_dsp_create(192000);
+    auto* interleaved_engine = radioform_dsp_create(192000);
+    ASSERT_EQ(radioform_dsp_apply_preset(planar_engine, &preset), RADIOFORM_OK);
+    ASSERT_EQ(radioform_dsp_apply_preset(interleaved_engine, &preset), RADIOFORM_OK);
+    ASSERT_EQ(radioform_dsp_get_band_topology(interleaved_engine, 0), RADIOFORM_TOPOLOGY_SVF);
+
+    const uint32_t num_frames = 96000;
+    const uint32_t block = 512;
+    auto left = generate_sine(num_frames, 100.0f, 192000.0f);
+    for (float& x : left) {
+        x *= 0.3f;
+    }
+    auto right = left;
+    std::vector<float> interleaved(num_frames * 2);
+    for (uint32_t i = 0; i < num_frames; i++) {
+        interleaved[i * 2] = left[i];
+        interleaved[i * 2 + 1] = right[i];
+    }
+
+    for (uint32_t offset = 0; offset < num_frames; offset += block) {
+        if (offset == 20 * block) {
+            radioform_dsp_update_preamp(planar_engine, -12.0f);
+            radioform_dsp_update_preamp(interleaved_engine, -12.0f);
+        }
+        const uint32_t frames = std::min(block, num_frames - offset);
+        radioform_dsp_process_planar(planar_engine, left.data() + offset, right.data() + offset,
+                                     left.data() + offset, right.data() + offset, frames);
+        radioform_dsp_process_interleaved(interleaved_engine, interleaved.data() + offset * 2,
+                                          interleaved.data() + offset * 2, frames);
+    }
+    for (uint32_t i = 0; i < num_frames; i++) {
+        ASSERT_NEAR(interleaved[i * 2], left[i], 1e-4f);
+        ASSERT_NEAR(interleaved[i * 2 + 1], right[i], 1e-4f);
+    }
+
+    radioform_dsp_destroy(planar_engine);
+    radioform_dsp_destroy(interleaved_engine);
+    PASS();
+}
@@ -0,0 +1,152 @@
+/**
+ * @file test_true_peak.cpp
+ * @brief Tests for the BS.1770 true-peak meter
+ */
+
+#include "test_utils.h"
+#include "radioform_dsp.h"
+#include "true_peak.h"
+
+#include <cmath>
+#include <limits>
+
+using namespace dsp_test;
+using namespace radioform;
+
+namespace {
+
+// Quarter-rate sine sampled 45 degrees off its crests: sample peaks at
+// 0.707 * amplitude, true peak at the amplitude
+std::vector<float> offset_quarter_rate_sine(uint32_t n, float amplitude) {
+    std::vector<float> x(n);
+    for (uint32_t i = 0; i < n; i++) {
+        x[i] = amplitude * std::sin(1.5707963f * static_cast<float>(i) + 0.7853982f);
+    }
+    return x;
+}
+
+} // namespace
+
+TEST(true_peak_meter_matches_reference_interpolator) {
+    // Scalar reference: the largest |phase output| or |sample| over all frames
+    const uint32_t n = 1000;
+    auto noise = generate_white_noise(n, 0.8f);
+    float reference = 0.0f;
+    uint32_t reference_overs = 0;
+    for (uint32_t i = 0; i < n; i++) {
+        float frame = std::fabs(noise[i]);
+        for (uint32_t p = 0; p < 4; p++) {
+            float sum = 0.0f;
+            for (uint32_t j = 0; j < kTruePeakTaps && j <= i; j++) {
+                sum += kTruePeakPhases[p][j] * noise[i - j];
+            }
+            frame = std::max(frame, std::fabs(sum));
+        }
+        reference = std::max(reference, frame);
+        reference_overs += frame > 1.0f ? 1 : 0;
+    }
+
+    // Interleaved in odd-sized calls (partial passes mask their stale lanes)
+    std::vector<float> interleaved(n * 2, 0.0f);
+    for (uint32_t i = 0; i < n; i++) {
+        interleaved[i * 2 + 1] = noise[i];
+    }
+    TruePeakMeter meter;
+    meter.reset();
+    float peak = 0.0f;
+    uint32_t overs = 0;
+    for (uint32_t offset = 0; offset < n;) {
+        const uint32_t frames = std::min(n - offset, 37u);
+        peak = std::max(peak, meter.process(1, interleaved.data() + offset * 2 + 1, 2, frames, overs));
+        offset += frames;
+    }
+    ASSERT_NEAR(peak, reference, 1e-5f);
+    ASSERT(overs + 2 >= reference_overs && overs <= reference_overs + 2);
+    ASSERT(reference_overs > 0);
+
+    // Sample peak misses what the interpolator finds
+    meter.reset();
+    auto sine = offset_quarter_rate_sine(4800, 1.0f);
+    overs = 0;
+    const float sine_peak = meter.process(0, sine.data(), 1, 4800, overs);
+    ASSERT_NEAR(sine_peak, 1.0f, 0.01f);
+    ASSERT(measure_peak(sine) < 0.71f);
+
+    // Non-finite input meters as silence
+    meter.reset();
+    std::vector<float> bad(64, 0.0f);
+    bad[10] = std::numeric_limits<float>::quiet_NaN();
+    bad[20] = std::numeric_limits<float>::infinity();
+    overs = 0;
+    ASSERT_EQ(meter.process(2, bad.data(), 1, 64, overs), 0.0f);
+    ASSERT_EQ(overs, 0u);
+    PASS();
+}
+
+TEST(engine_true_peak_metering) {
+    radioform_preset_t preset;
+    radioform_dsp_preset_init_flat(&preset);
+    preset.limiter_enabled = false;
+
+    auto* engine = radioform_dsp_create(48000);
+    ASSERT_EQ(radioform_dsp_apply_preset(engine, &preset), RADIOFORM_OK);
+
+    // 0.707 sample peak, +0.8 dBTP
+    const uint32_t n = 4800;
+    auto sine = offset_quarter_rate_sine(n, 1.1f);
+    std::vector<float> interleaved(n * 2), output(n * 2);
+    for (uint32_t i = 0; i < n; i++) {
+        interleaved[i * 2] = sine[i];
+        interleaved[i * 2 + 1] = 0.5f * sine[i];
+    }
+
+    // Off by default
+    radioform_dsp_process_interleaved(engine, interleaved.data(), output.data(), n);
+    radioform_stats_t stats;
+    radioform_dsp_get_stats(engine, &stats);
+    ASSERT_EQ(stats.true_peak_left_db, -120.0f);
+    ASSERT_EQ(stats.true_peak_overs, 0u);
+    ASSERT_NEAR(stats.peak_left_db, gain_to_db(1.1f * 0.70710678f), 0.1f);
+
+    radioform_dsp_set_true_peak_metering(engine, true);
+    radioform_dsp_process_interleaved(engine, interleaved.data(), output.data(), n);
+    radioform_dsp_get_stats(engine, &stats);
+    ASSERT_NEAR(stats.true_peak_left_db, gain_to_db(1.1f), 0.1f);
+    ASSERT_NEAR(stats.true_peak_right_db, gain_to_db(0.55f), 0.1f);
+    const uint64_t interleaved_overs = stats.true_peak_overs;
+    // One crest every other frame, left channel only
+    ASSERT(interleaved_overs + 8 >= n / 2 && interleaved_overs <= n / 2);
+
+    // Planar path, counting on
+    auto left = sine;
+    auto right = sine;
+    radioform_dsp_process_planar(engine, left.data(), right.data(), left.data(), right.data(), n);
+    radioform_dsp_get_stats(engine, &stats);
+    ASSERT_NEAR(stats.true_peak_right_db, gain_to_db(1.1f), 0.1f);
+    ASSERT(stats.true_peak_overs + 16 >= interleaved_overs + n);  // Both channels
+
+    // Off again, and reset clears the count
+    radioform_dsp_set_true_peak_metering(engine, false);
+    radioform_dsp_get_stats(engine, &stats);
+    ASSERT_EQ(stats.true_peak_left_db, -120.0f);
+    radioform_dsp_reset(engine);
+    radioform_dsp_get_stats(engine, &stats);
+    ASSERT_EQ(stats.true_peak_overs, 0u);
+
+    // Multichannel engines meter their first two channels
+    auto* surround = radioform_dsp_create_with_channels(48000, 6);
+    ASSERT_EQ(radioform_dsp_apply_preset(surround, &preset), RADIOFORM_OK);
+    radioform_dsp_set_true_peak_metering(surround, true);
+    std::vector<float> frames(n * 6, 0.0f);
+    for (uint32_t i = 0; i < n; i++) {
+        frames[i * 6 + 1] = sine[i];
+    }
+    radioform_dsp_process_interleaved(surround, frames.data(), frames.data(), n);
+    radioform_dsp_get_stats(surround, &stats);
+    ASSERT_EQ(stats.true_peak_left_db, -120.0f);
+    ASSERT_NEAR(stats.true_peak_right_db, gain_to_db(1.1f), 0.1f);
+
+    radioform_dsp_destroy(surround);
+    radioform_dsp_destroy(engine);
+    PASS();
+}
@@ -12,6 +12,8 @@
 #include <vector>
 #include <functional>
 
+#include "radioform_dsp.h"
+
 // ============================================================================
 // Simple Test Framework
 // ============================================================================
@@ -236,6 +238,43 @@ inline bool has_discontinuities(const std::vector<float>& signal, float max_delt
     return false;
 }
 
+/** Build an enabled band */
+inline radioform_band_t make_band(radioform_filter_type_t type, float frequency, float gain_db, float q) {
+    radioform_band_t band;
+    band.frequency_hz = frequency;
+    band.gain_db = gain_db;
+    band.q_factor = q;
+    band.type = type;
+    band.enabled = true;
+    return band;
+}
+
+/** Build a flat preset holding num_bands enabled bands with one Q */
+inline void make_preset(
+    radioform_preset_t& preset,
+    uint32_t num_bands,
+    const radioform_filter_type_t* types,
+    const float* frequencies,
+    const float* gains_db,
+    float q
+) {
+    radioform_dsp_preset_init_flat(&preset);
+    preset.num_bands = num_bands;
+    for (uint32_t b = 0; b < num_bands; b++) {
+        preset.bands[b] = make_band(types[b], frequencies[b], gains_db[b], q);
+    }
+}
+
+/** Build a low shelf, two peaks (250 Hz, 2 kHz) and a 9 kHz high shelf at Q 0.9 */
+inline void make_shelf_peak_preset(radioform_preset_t& preset, float low_shelf_hz, const float (&gains_db)[4]) {
+    const radioform_filter_type_t types[] = {
+        RADIOFORM_FILTER_LOW_SHELF, RADIOFORM_FILTER_PEAK, RADIOFORM_FILTER_PEAK,
+        RADIOFORM_FILTER_HIGH_SHELF
+    };
+    const float frequencies[] = {low_shelf_hz, 250.0f, 2000.0f, 9000.0f};
+    make_preset(preset, 4, types, frequencies, gains_db, 0.9f);
+}
+
 /** Convert dB to linear gain */
 inline float db_to_gain(float db) {
     return std::pow(10.0f, db / 20.0f);
@@ -0,0 +1,233 @@
+/**
+ * @file batch.cpp
+ * @brief Batch renderer: decode each input once, fan it out to every preset
+ *
+ * A decode task reads one input into memory and queues one render task per
+ * preset on its own worker's deque; idle workers steal the renders, so a
+ * long file's presets spread over all cores while short files finish on
+ * their own. Renders stream the shared decoded audio through the engine in
+ * blocks and write the output as they go. A decoded input is freed when its
+ * last render finishes.
+ */
+
+#include "batch.h"
+#include "radioform_dsp.h"
+#include "wav_io.h"
+#include "preset_json.h"
+#include "work_stealing_pool.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <filesystem>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <string>
+#include <vector>
+
+namespace {
+
+struct BatchPreset {
+    std::string stem;  // File name without extension, used in output names
+    radioform_preset_t preset;
+};
+
+struct DecodedInput {
+    std::string stem;
+    WAVHeader header;
+    std::vector<float> samples;  // Interleaved stereo
+};
+
+struct BatchTotals {
+    std::atomic<uint64_t> renders{0};
+    std::atomic<uint64_t> failures{0};
+    std::atomic<uint64_t> audio_microseconds{0};
+    std::mutex log_mutex;
+
+    void fail(const std::string& message) {
+        failures.fetch_add(1);
+        std::lock_guard<std::mutex> lock(log_mutex);
+        std::cerr << "Error: " << message << std::endl;
+    }
+};
+
+bool decode(const std::string& path, DecodedInput& input) {
+    WAVReader reader;
+    if (!reader.open(path.c_str())) {
+        return false;
+    }
+    input.header = reader.header();
+    if (input.header.num_channels != 2) {
+        std::cerr << "Error: Only stereo files are supported: " << path << std::endl;
+        return false;
+    }
+
+    // The header's data size can be a placeholder (0xFFFFFFFF from streaming
+    // writers), so never reserve more than the file can actually hold
+    std::error_code ec;
+    const uint64_t file_bytes = std::filesystem::file_size(path, ec);
+    const uint64_t data_bytes = ec ? 0 : std::min<uint64_t>(reader.dataBytes(), file_bytes);
+
+    std::vector<float> block(static_cast<size_t>(kBlockFrames) * 2);
+    input.samples.reserve(static_cast<size_t>(data_bytes / input.header.block_align * 2));
+    while (uint32_t frames = reader.read(block.data())) {
+        input.samples.insert(input.samples.end(), block.begin(), block.begin() + frames * 2);
+    }
+    return true;
+}
+
+void render(const DecodedInput& input, const BatchPreset& preset,
+            const std::filesystem::path& output_dir, BatchTotals& totals) {
+    const std::string output = (output_dir / (input.stem + "__" + preset.stem + ".wav")).string();
+    radioform_dsp_engine_t* engine = radioform_dsp_create(input.header.sample_rate);
+    if (!engine || radioform_dsp_apply_preset(engine, &preset.preset) != RADIOFORM_OK) {
+        radioform_dsp_destroy(engine);
+        totals.fail("Failed to set up engine for " + output);
+        return;
+    }
+
+    WAVWriter writer;
+    bool ok = writer.open(output.c_str(), input.header);
+
+    std::vector<float> block(static_cast<size_t>(kBlockFrames) * 2);
+    const size_t total_frames = input.samples.size() / 2;
+    for (size_t offset = 0; ok && offset < total_frames; offset += kBlockFrames) {
+        const uint32_t frames = static_cast<uint32_t>(std::min<size_t>(kBlockFrames, total_frames - offset));
+        radioform_dsp_process_interleaved(engine, input.samples.data() + offset * 2, block.data(), frames);
+        ok = writer.write(block.data(), frames);
+    }
+    ok = ok && writer.finish(output.c_str());
+    radioform_dsp_destroy(engine);
+
+    if (!ok) {
+        totals.fail("Failed writing " + output);
+        return;
+    }
+    totals.renders.fetch_add(1);
+    totals.audio_microseconds.fetch_add(
+        static_cast<uint64_t>(total_frames * 1000000.0 / input.header.sample_rate));
+}
+
+void printUsage() {
+    std::cout << "Usage: wav_processor --batch output_dir --presets a.json [b.json ...]"
+              << " --inputs x.wav [y.wav ...] [--threads N]" << std::endl;
+}
+
+bool uniqueStems(const std::vector<std::string>& paths, const char* kind) {
+    std::map<std::string, std::string> seen;
+    for (const std::string& path : paths) {
+        const std::string stem = std::filesystem::path(path).stem().string();
+        auto [it, inserted] = seen.emplace(stem, path);
+        if (!inserted) {
+            std::cerr << "Error: Duplicate " << kind << " name '" << stem << "' (" << it->second
+                      << " and " << path << ") would write to the same output files" << std::endl;
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace
+
+int runBatch(int argc, char* argv[]) {
+    if (argc < 1) {
+        printUsage();
+        return 1;
+    }
+
+    const std::filesystem::path output_dir = argv[0];
+    std::vector<std::string> preset_files;
+    std::vector<std::string> input_files;
+    size_t num_threads = std::max(1u, std::thread::hardware_concurrency());
+
+    std::vector<std::string>* list = nullptr;
+    for (int i = 1; i < argc; i++) {
+        if (std::strcmp(argv[i], "--presets") == 0) {
+            list = &preset_files;
+        } else if (std::strcmp(argv[i], "--inputs") == 0) {
+            list = &input_files;
+        } else if (std::strcmp(argv[i], "--threads") == 0 && i + 1 < argc) {
+            num_threads = std::max(1, std::atoi(argv[++i]));
+            list = nullptr;
+        } else if (list) {
+            list->push_back(argv[i]);
+        } else {
+            printUsage();
+            return 1;
+        }
+    }
+    if (preset_files.empty() || input_files.empty()) {
+        printUsage();
+        return 1;
+    }
+
+    std::vector<BatchPreset> presets(preset_files.size());
+    for (size_t i = 0; i < preset_files.size(); i++) {
+        presets[i].stem = std::filesystem::path(preset_files[i]).stem().string();
+        if (!preset_json::load(preset_files[i].c_str(), &presets[i].preset)) {
+            return 1;
+        }
+    }
+
+    // Outputs are named <input stem>__<preset stem>.wav; two inputs (or two
+    // presets) with the same stem would render concurrently into one file
+    if (!uniqueStems(preset_files, "preset") || !uniqueStems(input_files, "input")) {
+        return 1;
+    }
+
+    std::error_code ec;
+    std::filesystem::create_directories(output_dir, ec);
+    if (ec) {
+        std::cerr << "Error: Cannot create output directory: " << output_dir << std::endl;
+        return 1;
+    }
+
+    std::cout << "Rendering " << input_files.size() << " file(s) x " << presets.size()
+              << " preset(s) on " << num_threads << " thread(s)..." << std::endl;
+
+    WorkStealingPool pool(num_threads);
+    BatchTotals totals;
+    for (const std::string& path : input_files) {
+        pool.submit([&pool, &presets, &output_dir, &totals, path] {
+            auto input = std::make_shared<DecodedInput>();
+            input->stem = std::filesystem::path(path).stem().string();
+            try {
+                if (!decode(path, *input)) {
+                    totals.fail("Failed to decode " + path);
+                    return;
+                }
+            } catch (const std::bad_alloc&) {
+                // Let the other jobs finish rather than terminating the pool
+                totals.fail("Out of memory decoding " + path);
+                return;
+            }
+            for (const BatchPreset& preset : presets) {
+                pool.submit([input, &preset, &output_dir, &totals] {
+                    render(*input, preset, output_dir, totals);
+                });
+            }
+        });
+    }
+
+    auto start_time = std::chrono::steady_clock::now();
+    pool.run();
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start_time;
+
+    // Realtime factor: seconds of audio rendered per second of wall time
+    const double audio_seconds = static_cast<double>(totals.audio_microseconds.load()) / 1e6;
+    const double realtime_factor = audio_seconds / elapsed.count();
+    const size_t cores = std::min<size_t>(num_threads, std::max(1u, std::thread::hardware_concurrency()));
+    std::cout << "Rendered " << totals.renders.load() << " file(s), "
+              << audio_seconds << " s of audio in " << elapsed.count() << " s" << std::endl;
+    std::cout << "  Realtime factor: " << realtime_factor << "x total, "
+              << realtime_factor / static_cast<double>(cores) << "x per core" << std::endl;
+
+    if (totals.failures.load() > 0) {
+        std::cerr << totals.failures.load() << " job(s) failed" << std::endl;
+        return 1;
+    }
+    return 0;
+}
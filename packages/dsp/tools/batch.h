@@ -0,0 +1,22 @@
+/**
+ * @file batch.h
+ * @brief Batch mode of wav_processor: many files through many preset JSONs
+ */
+
+#ifndef RADIOFORM_TOOLS_BATCH_H
+#define RADIOFORM_TOOLS_BATCH_H
+
+/**
+ * @brief Run the batch renderer
+ *
+ * Arguments (after "--batch"):
+ *   output_dir --presets a.json [b.json ...] --inputs x.wav [y.wav ...] [--threads N]
+ *
+ * Every input is decoded once and rendered through every preset to
+ * output_dir/<input>__<preset>.wav, on a work-stealing pool.
+ *
+ * @return Process exit code
+ */
+int runBatch(int argc, char* argv[]);
+
+#endif // RADIOFORM_TOOLS_BATCH_H
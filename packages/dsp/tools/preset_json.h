@@ -0,0 +1,201 @@
+/**
+ * @file preset_json.h
+ * @brief Load the app's preset JSON files into radioform_preset_t
+ *
+ * Reads the format of the app's bundled presets
+ * (apps/mac/RadioformApp/Sources/Resources/Presets/): name, bands[] of
+ * frequency_hz/gain_db/q_factor/filter_type/enabled, preamp_db,
+ * limiter_enabled and limiter_threshold_db. Only the JSON needed for that
+ * format is parsed; unknown keys are skipped.
+ */
+
+#ifndef RADIOFORM_TOOLS_PRESET_JSON_H
+#define RADIOFORM_TOOLS_PRESET_JSON_H
+
+#include "radioform_dsp.h"
+
+#include <cctype>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+namespace preset_json {
+
+class Parser {
+public:
+    explicit Parser(const std::string& text) : text_(text) {}
+
+    bool parsePreset(radioform_preset_t* preset) {
+        radioform_dsp_preset_init_flat(preset);
+        preset->num_bands = 0;
+        return parseObject([&](const std::string& key) {
+            if (key == "name") {
+                std::string name;
+                if (!parseString(name)) return false;
+                std::strncpy(preset->name, name.c_str(), sizeof(preset->name) - 1);
+                preset->name[sizeof(preset->name) - 1] = '\0';
+                return true;
+            }
+            if (key == "bands") {
+                return parseArray([&] {
+                    if (preset->num_bands >= RADIOFORM_MAX_BANDS) return false;
+                    return parseBand(&preset->bands[preset->num_bands++]);
+                });
+            }
+            if (key == "preamp_db") return parseNumber(preset->preamp_db);
+            if (key == "limiter_enabled") return parseBool(preset->limiter_enabled);
+            if (key == "limiter_threshold_db") return parseNumber(preset->limiter_threshold_db);
+            return skipValue();
+        }) && atEnd();
+    }
+
+private:
+    bool parseBand(radioform_band_t* band) {
+        *band = {};
+        return parseObject([&](const std::string& key) {
+            if (key == "frequency_hz") return parseNumber(band->frequency_hz);
+            if (key == "gain_db") return parseNumber(band->gain_db);
+            if (key == "q_factor") return parseNumber(band->q_factor);
+            if (key == "enabled") return parseBool(band->enabled);
+            if (key == "filter_type") {
+                float type = 0.0f;
+                if (!parseNumber(type)) return false;
+                band->type = static_cast<radioform_filter_type_t>(static_cast<int>(type));
+                return true;
+            }
+            return skipValue();
+        });
+    }
+
+    template <typename OnKey>
+    bool parseObject(OnKey on_key) {
+        if (!consume('{')) return false;
+        if (consume('}')) return true;
+        do {
+            std::string key;
+            if (!parseString(key) || !consume(':') || !on_key(key)) return false;
+        } while (consume(','));
+        return consume('}');
+    }
+
+    template <typename OnElement>
+    bool parseArray(OnElement on_element) {
+        if (!consume('[')) return false;
+        if (consume(']')) return true;
+        do {
+            if (!on_element()) return false;
+        } while (consume(','));
+        return consume(']');
+    }
+
+    bool parseString(std::string& out) {
+        if (!consume('"')) return false;
+        out.clear();
+        while (pos_ < text_.size() && text_[pos_] != '"') {
+            if (text_[pos_] == '\\' && pos_ + 1 < text_.size()) {
+                pos_++;  // Escapes are kept verbatim (names only)
+            }
+            out += text_[pos_++];
+        }
+        return pos_++ < text_.size();
+    }
+
+    bool parseNumber(float& out) {
+        skipSpace();
+        const char* begin = text_.c_str() + pos_;
+        char* end = nullptr;
+        out = std::strtof(begin, &end);
+        if (end == begin) return false;
+        pos_ += static_cast<size_t>(end - begin);
+        return true;
+    }
+
+    bool parseBool(bool& out) {
+        skipSpace();
+        if (text_.compare(pos_, 4, "true") == 0) {
+            out = true;
+            pos_ += 4;
+            return true;
+        }
+        if (text_.compare(pos_, 5, "false") == 0) {
+            out = false;
+            pos_ += 5;
+            return true;
+        }
+        return false;
+    }
+
+    bool skipValue() {
+        skipSpace();
+        if (pos_ >= text_.size()) return false;
+        const char c = text_[pos_];
+        if (c == '{') return parseObject([&](const std::string&) { return skipValue(); });
+        if (c == '[') return parseArray([&] { return skipValue(); });
+        if (c == '"') {
+            std::string ignored;
+            return parseString(ignored);
+        }
+        if (text_.compare(pos_, 4, "null") == 0) {
+            pos_ += 4;
+            return true;
+        }
+        bool flag;
+        float number;
+        return parseBool(flag) || parseNumber(number);
+    }
+
+    void skipSpace() {
+        while (pos_ < text_.size() && std::isspace(static_cast<unsigned char>(text_[pos_]))) {
+            pos_++;
+        }
+    }
+
+    bool consume(char c) {
+        skipSpace();
+        if (pos_ < text_.size() && text_[pos_] == c) {
+            pos_++;
+            return true;
+        }
+        return false;
+    }
+
+    bool atEnd() {
+        skipSpace();
+        return pos_ == text_.size();
+    }
+
+    const std::string& text_;
+    size_t pos_ = 0;
+};
+
+/**
+ * @brief Load and validate a preset JSON file
+ */
+inline bool load(const char* filename, radioform_preset_t* preset) {
+    std::ifstream file(filename);
+    if (!file) {
+        std::cerr << "Error: Cannot open preset file: " << filename << std::endl;
+        return false;
+    }
+    std::stringstream buffer;
+    buffer << file.rdbuf();
+    const std::string text = buffer.str();
+
+    Parser parser(text);
+    if (!parser.parsePreset(preset)) {
+        std::cerr << "Error: Malformed preset JSON: " << filename << std::endl;
+        return false;
+    }
+    if (radioform_dsp_preset_validate(preset) != RADIOFORM_OK) {
+        std::cerr << "Error: Invalid preset: " << filename << std::endl;
+        return false;
+    }
+    return true;
+}
+
+} // namespace preset_json
+
+#endif // RADIOFORM_TOOLS_PRESET_JSON_H
@@ -0,0 +1,286 @@
+/**
+ * @file wav_io.h
+ * @brief Block-wise WAV file reading and writing for the tools
+ *
+ * Inputs are 16/24-bit PCM or 32-bit float; outputs are always 32-bit
+ * float, switching to RF64 past the 4 GB RIFF limit. Both sides work one block at a time, so memory does not depend on
+ * the file length.
+ */
+
+#ifndef RADIOFORM_TOOLS_WAV_IO_H
+#define RADIOFORM_TOOLS_WAV_IO_H
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <vector>
+
+struct WAVHeader {
+    char riff[4];              // "RIFF"
+    uint32_t file_size;        // File size - 8
+    char wave[4];              // "WAVE"
+    char fmt[4];               // "fmt "
+    uint32_t fmt_size;         // Format chunk size (16 for PCM)
+    uint16_t audio_format;     // 1 = PCM, 3 = IEEE float
+    uint16_t num_channels;     // 1 = mono, 2 = stereo
+    uint32_t sample_rate;      // Sample rate (e.g., 48000)
+    uint32_t byte_rate;        // sample_rate * num_channels * bits_per_sample/8
+    uint16_t block_align;      // num_channels * bits_per_sample/8
+    uint16_t bits_per_sample;  // 16, 24, 32
+    char data[4];              // "data"
+    uint32_t data_size;        // Size of data section
+};
+
+// Frames per streamed block (~170 ms at 48 kHz)
+constexpr uint32_t kBlockFrames = 8192;
+
+/**
+ * @brief Reads the data chunk of a WAV file block by block, as float
+ */
+class WAVReader {
+public:
+    bool open(const char* filename) {
+        file_.open(filename, std::ios::binary);
+        if (!file_) {
+            std::cerr << "Error: Cannot open input file: " << filename << std::endl;
+            return false;
+        }
+
+        // Read RIFF header
+        file_.read(header_.riff, 4);
+        file_.read(reinterpret_cast<char*>(&header_.file_size), 4);
+        file_.read(header_.wave, 4);
+
+        // Validate WAV file
+        // RF64 files carry their real sizes in a ds64 chunk
+        const bool rf64 = std::strncmp(header_.riff, "RF64", 4) == 0;
+        if ((!rf64 && std::strncmp(header_.riff, "RIFF", 4) != 0) ||
+            std::strncmp(header_.wave, "WAVE", 4) != 0) {
+            std::cerr << "Error: Not a valid WAV file" << std::endl;
+            return false;
+        }
+
+        // Read chunks until we find fmt and data
+        bool found_fmt = false;
+        bool found_data = false;
+        uint64_t ds64_data_size = 0;
+
+        while (!file_.eof() && (!found_fmt || !found_data)) {
+            char chunk_id[4];
+            uint32_t chunk_size;
+
+            file_.read(chunk_id, 4);
+            if (file_.gcount() != 4) break;
+
+            file_.read(reinterpret_cast<char*>(&chunk_size), 4);
+
+            if (std::strncmp(chunk_id, "fmt ", 4) == 0) {
+                // Read fmt chunk
+                file_.read(reinterpret_cast<char*>(&header_.audio_format), 16);
+                found_fmt = true;
+                // Skip any extra fmt data
+                if (chunk_size > 16) {
+                    file_.seekg(chunk_size - 16, std::ios::cur);
+                }
+            } else if (rf64 && std::strncmp(chunk_id, "ds64", 4) == 0 && chunk_size >= 16) {
+                // 64-bit RIFF size, then 64-bit data size; skip the rest
+                file_.seekg(8, std::ios::cur);
+                file_.read(reinterpret_cast<char*>(&ds64_data_size), 8);
+                file_.seekg(chunk_size - 16, std::ios::cur);
+            } else if (std::strncmp(chunk_id, "data", 4) == 0) {
+                // Found data chunk; the file is left positioned at its start
+                header_.data_size = chunk_size;
+                data_bytes_ = rf64 && chunk_size == UINT32_MAX ? ds64_data_size : chunk_size;
+                found_data = true;
+                break;
+            } else {
+                // Skip unknown chunk
+                file_.seekg(chunk_size, std::ios::cur);
+            }
+        }
+
+        if (!found_fmt || !found_data) {
+            std::cerr << "Error: Missing fmt or data chunk" << std::endl;
+            return false;
+        }
+
+        // We only support PCM or float formats
+        const bool supported =
+            (header_.audio_format == 3 && header_.bits_per_sample == 32) ||
+            (header_.audio_format == 1 && (header_.bits_per_sample == 16 || header_.bits_per_sample == 24));
+        if (!supported) {
+            std::cerr << "Error: Only 16/24-bit PCM and 32-bit IEEE float WAV files are supported"
+                      << std::endl;
+            return false;
+        }
+        if (header_.num_channels == 0 ||
+            header_.block_align != header_.num_channels * (header_.bits_per_sample / 8)) {
+            std::cerr << "Error: Invalid fmt chunk" << std::endl;
+            return false;
+        }
+
+        remaining_bytes_ = data_bytes_ - data_bytes_ % header_.block_align;
+        raw_.resize(static_cast<size_t>(kBlockFrames) * header_.block_align);
+
+        return true;
+    }
+
+    const WAVHeader& header() const { return header_; }
+
+    /**
+     * @brief Size of the data chunk in bytes, from ds64 for RF64 files
+     */
+    uint64_t dataBytes() const { return data_bytes_; }
+
+    void printInfo(const char* filename) const {
+        std::cout << "Input file: " << filename << std::endl;
+        std::cout << "  Sample rate: " << header_.sample_rate << " Hz" << std::endl;
+        std::cout << "  Channels: " << header_.num_channels << std::endl;
+        std::cout << "  Bits per sample: " << header_.bits_per_sample << std::endl;
+        std::cout << "  Duration: " << (data_bytes_ / header_.byte_rate) << " seconds" << std::endl;
+    }
+
+    /**
+     * @brief Read and convert up to kBlockFrames frames
+     *
+     * @return Frames read; 0 at the end of the data chunk (or of a truncated file)
+     */
+    uint32_t read(float* samples) {
+        const size_t want = std::min<size_t>(raw_.size(), remaining_bytes_);
+        file_.read(reinterpret_cast<char*>(raw_.data()), static_cast<std::streamsize>(want));
+        const uint32_t frames = static_cast<uint32_t>(file_.gcount()) / header_.block_align;
+        remaining_bytes_ = frames * header_.block_align == want ? remaining_bytes_ - want : 0;
+
+        const size_t num_samples = static_cast<size_t>(frames) * header_.num_channels;
+        if (header_.audio_format == 3) {
+            // IEEE float - copy directly
+            std::memcpy(samples, raw_.data(), num_samples * sizeof(float));
+        } else if (header_.bits_per_sample == 16) {
+            // 16-bit PCM - convert to float
+            for (size_t i = 0; i < num_samples; i++) {
+                int16_t value;
+                std::memcpy(&value, &raw_[i * 2], sizeof(value));
+                samples[i] = value / 32768.0f;
+            }
+        } else {
+            // 24-bit PCM - convert to float
+            for (size_t i = 0; i < num_samples; i++) {
+                int32_t value = (raw_[i * 3 + 2] << 16) | (raw_[i * 3 + 1] << 8) | raw_[i * 3];
+                if (value & 0x800000) value |= 0xFF000000; // Sign extend
+                samples[i] = value / 8388608.0f;
+            }
+        }
+        return frames;
+    }
+
+private:
+    std::ifstream file_;
+    WAVHeader header_ = {};
+    uint64_t data_bytes_ = 0;
+    uint64_t remaining_bytes_ = 0;
+    std::vector<uint8_t> raw_;
+};
+
+/**
+ * @brief Writes a 32-bit float WAV file block by block
+ *
+ * Sizes in the header are placeholders until finish(). A JUNK chunk sized
+ * for a ds64 chunk follows the RIFF header; if the file outgrows the 32-bit
+ * RIFF size fields, finish() turns it into an RF64 file (EBU Tech 3306) by
+ * rewriting the JUNK chunk as ds64. Smaller files stay plain RIFF.
+ */
+class WAVWriter {
+public:
+    bool open(const char* filename, const WAVHeader& input) {
+        file_.open(filename, std::ios::binary);
+        if (!file_) {
+            std::cerr << "Error: Cannot create output file: " << filename << std::endl;
+            return false;
+        }
+
+        // Build proper WAV header (always output 32-bit float)
+        // RIFF header
+        std::memcpy(header_.riff, "RIFF", 4);
+        std::memcpy(header_.wave, "WAVE", 4);
+
+        // fmt chunk
+        std::memcpy(header_.fmt, "fmt ", 4);
+        header_.fmt_size = 16;
+        header_.audio_format = 3; // IEEE float
+        header_.num_channels = input.num_channels;
+        header_.sample_rate = input.sample_rate;
+        header_.bits_per_sample = 32;
+        header_.block_align = header_.num_channels * 4;
+        header_.byte_rate = header_.sample_rate * header_.block_align;
+
+        // data chunk
+        std::memcpy(header_.data, "data", 4);
+        header_.data_size = 0;
+
+        writeHeader(false);
+        return static_cast<bool>(file_);
+    }
+
+    bool write(const float* samples, uint32_t num_frames) {
+        const size_t bytes = static_cast<size_t>(num_frames) * header_.block_align;
+        file_.write(reinterpret_cast<const char*>(samples), static_cast<std::streamsize>(bytes));
+        data_bytes_ += bytes;
+        return static_cast<bool>(file_);
+    }
+
+    /**
+     * @brief Patch the chunk sizes into the header and close the file
+     */
+    bool finish(const char* filename) {
+        file_.seekp(0);
+        writeHeader(kHeaderBytes - 8 + data_bytes_ > UINT32_MAX);
+        file_.close();
+        if (!file_) {
+            std::cerr << "Error: Failed writing output file: " << filename << std::endl;
+            return false;
+        }
+        return true;
+    }
+
+private:
+    // RIFF header, JUNK/ds64 chunk, fmt chunk and data chunk header
+    static constexpr uint32_t kDs64Size = 28;
+    static constexpr uint64_t kHeaderBytes = 12 + (8 + kDs64Size) + (8 + 16) + 8;
+
+    void writeHeader(bool rf64) {
+        const uint64_t riff_size = kHeaderBytes - 8 + data_bytes_;
+
+        file_.write(rf64 ? "RF64" : "RIFF", 4);
+        writeValue(rf64 ? UINT32_MAX : static_cast<uint32_t>(riff_size));
+        file_.write(header_.wave, 4);
+
+        // ds64: 64-bit RIFF size, data size and sample count, then an empty
+        // table of other oversized chunks. As JUNK it is ignored by readers.
+        file_.write(rf64 ? "ds64" : "JUNK", 4);
+        writeValue(kDs64Size);
+        writeValue(rf64 ? riff_size : uint64_t{0});
+        writeValue(rf64 ? data_bytes_ : uint64_t{0});
+        writeValue(rf64 ? data_bytes_ / header_.block_align : uint64_t{0});
+        writeValue(uint32_t{0});
+
+        file_.write(header_.fmt, 4);
+        writeValue(header_.fmt_size);
+        file_.write(reinterpret_cast<const char*>(&header_.audio_format), 16);
+
+        file_.write(header_.data, 4);
+        writeValue(rf64 ? UINT32_MAX : static_cast<uint32_t>(data_bytes_));
+    }
+
+    template <typename T>
+    void writeValue(T value) {
+        file_.write(reinterpret_cast<const char*>(&value), sizeof(value));
+    }
+
+    std::ofstream file_;
+    WAVHeader header_ = {};
+    uint64_t data_bytes_ = 0;
+};
+
+#endif // RADIOFORM_TOOLS_WAV_IO_H
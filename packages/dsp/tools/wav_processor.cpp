@@ -2,175 +2,124 @@
  * @file wav_processor.cpp
  * @brief Simple WAV file processor for testing DSP engine
  *
+ * Streams the file in fixed-size blocks (double-buffered, I/O on its own
+ * thread), so memory use does not grow with the file length.
+ *
  * Usage: wav_processor input.wav output.wav [preset]
- * Presets: bass, treble, vocal, flat
+ *        wav_processor --batch output_dir --presets a.json ... --inputs x.wav ...
+ * Presets: bass, treble, vocal, flat (batch mode takes preset JSON files)
  */
 
 #include "radioform_dsp.h"
+#include "wav_io.h"
+#include "batch.h"
 #include <iostream>
-#include <fstream>
 #include <vector>
 #include <cstring>
 #include <cstdint>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
 
 // ============================================================================
-// Simple WAV File I/O
+// Double-Buffered Pipeline
 // ============================================================================
 
-struct WAVHeader {
-    char riff[4];              // "RIFF"
-    uint32_t file_size;        // File size - 8
-    char wave[4];              // "WAVE"
-    char fmt[4];               // "fmt "
-    uint32_t fmt_size;         // Format chunk size (16 for PCM)
-    uint16_t audio_format;     // 1 = PCM, 3 = IEEE float
-    uint16_t num_channels;     // 1 = mono, 2 = stereo
-    uint32_t sample_rate;      // Sample rate (e.g., 48000)
-    uint32_t byte_rate;        // sample_rate * num_channels * bits_per_sample/8
-    uint16_t block_align;      // num_channels * bits_per_sample/8
-    uint16_t bits_per_sample;  // 16, 24, 32
-    char data[4];              // "data"
-    uint32_t data_size;        // Size of data section
-};
-
-bool readWAV(const char* filename, WAVHeader& header, std::vector<float>& samples) {
-    std::ifstream file(filename, std::ios::binary);
-    if (!file) {
-        std::cerr << "Error: Cannot open input file: " << filename << std::endl;
-        return false;
+/**
+ * @brief Two blocks shared by an I/O thread and the DSP thread
+ *
+ * Block i lives in slot i % 2. The I/O thread writes a slot's processed
+ * block and reads the next input into it while the DSP thread works on the
+ * other slot, so file I/O overlaps processing and memory stays at two
+ * blocks whatever the file length.
+ */
+class BlockPipeline {
+public:
+    enum class State { Empty, Filled, Processed, End };
+
+    struct Slot {
+        std::vector<float> samples;
+        uint32_t frames = 0;
+        State state = State::Empty;
+    };
+
+    explicit BlockPipeline(uint32_t num_channels) {
+        for (Slot& slot : slots_) {
+            slot.samples.resize(static_cast<size_t>(kBlockFrames) * num_channels);
+        }
     }
 
-    // Read RIFF header
-    file.read(header.riff, 4);
-    file.read(reinterpret_cast<char*>(&header.file_size), 4);
-    file.read(header.wave, 4);
+    Slot& slot(uint64_t block) { return slots_[block % 2]; }
 
-    // Validate WAV file
-    if (std::strncmp(header.riff, "RIFF", 4) != 0 ||
-        std::strncmp(header.wave, "WAVE", 4) != 0) {
-        std::cerr << "Error: Not a valid WAV file" << std::endl;
-        return false;
+    // Wait until block's slot is in one of the given states
+    void wait(uint64_t block, State a, State b) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        cv_.wait(lock, [&] { return slot(block).state == a || slot(block).state == b || failed_; });
     }
 
-    // Read chunks until we find fmt and data
-    bool found_fmt = false;
-    bool found_data = false;
-
-    while (!file.eof() && (!found_fmt || !found_data)) {
-        char chunk_id[4];
-        uint32_t chunk_size;
-
-        file.read(chunk_id, 4);
-        if (file.gcount() != 4) break;
-
-        file.read(reinterpret_cast<char*>(&chunk_size), 4);
-
-        if (std::strncmp(chunk_id, "fmt ", 4) == 0) {
-            // Read fmt chunk
-            file.read(reinterpret_cast<char*>(&header.audio_format), 16);
-            found_fmt = true;
-            // Skip any extra fmt data
-            if (chunk_size > 16) {
-                file.seekg(chunk_size - 16, std::ios::cur);
-            }
-        } else if (std::strncmp(chunk_id, "data", 4) == 0) {
-            // Found data chunk
-            header.data_size = chunk_size;
-            found_data = true;
-            break; // Data chunk found, stop searching
-        } else {
-            // Skip unknown chunk
-            file.seekg(chunk_size, std::ios::cur);
+    void publish(uint64_t block, State state) {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            slot(block).state = state;
         }
+        cv_.notify_all();
     }
 
-    if (!found_fmt || !found_data) {
-        std::cerr << "Error: Missing fmt or data chunk" << std::endl;
-        return false;
-    }
-
-    // We only support PCM or float formats
-    if (header.audio_format != 1 && header.audio_format != 3) {
-        std::cerr << "Error: Only PCM and IEEE float WAV files are supported" << std::endl;
-        return false;
-    }
-
-    // Print info
-    std::cout << "Input file: " << filename << std::endl;
-    std::cout << "  Sample rate: " << header.sample_rate << " Hz" << std::endl;
-    std::cout << "  Channels: " << header.num_channels << std::endl;
-    std::cout << "  Bits per sample: " << header.bits_per_sample << std::endl;
-    std::cout << "  Duration: " << (header.data_size / header.byte_rate) << " seconds" << std::endl;
-
-    // Read audio data
-    uint32_t num_samples = header.data_size / (header.bits_per_sample / 8);
-    samples.resize(num_samples);
-
-    if (header.audio_format == 3 && header.bits_per_sample == 32) {
-        // IEEE float - read directly
-        file.read(reinterpret_cast<char*>(samples.data()), header.data_size);
-    } else if (header.audio_format == 1 && header.bits_per_sample == 16) {
-        // 16-bit PCM - convert to float
-        std::vector<int16_t> pcm_samples(num_samples);
-        file.read(reinterpret_cast<char*>(pcm_samples.data()), header.data_size);
-        for (size_t i = 0; i < num_samples; i++) {
-            samples[i] = pcm_samples[i] / 32768.0f;
+    void fail() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            failed_ = true;
         }
-    } else if (header.audio_format == 1 && header.bits_per_sample == 24) {
-        // 24-bit PCM - convert to float
-        std::vector<uint8_t> bytes(header.data_size);
-        file.read(reinterpret_cast<char*>(bytes.data()), header.data_size);
-        for (size_t i = 0; i < num_samples; i++) {
-            int32_t value = (bytes[i * 3 + 2] << 16) | (bytes[i * 3 + 1] << 8) | bytes[i * 3];
-            if (value & 0x800000) value |= 0xFF000000; // Sign extend
-            samples[i] = value / 8388608.0f;
-        }
-    } else {
-        std::cerr << "Error: Unsupported bit depth: " << header.bits_per_sample << std::endl;
-        return false;
+        cv_.notify_all();
     }
 
-    return true;
-}
-
-bool writeWAV(const char* filename, const WAVHeader& header, const std::vector<float>& samples) {
-    std::ofstream file(filename, std::ios::binary);
-    if (!file) {
-        std::cerr << "Error: Cannot create output file: " << filename << std::endl;
-        return false;
+    bool failed() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return failed_;
     }
 
-    // Build proper WAV header (always output 32-bit float)
-    WAVHeader out_header;
-
-    // RIFF header
-    std::memcpy(out_header.riff, "RIFF", 4);
-    std::memcpy(out_header.wave, "WAVE", 4);
-
-    // fmt chunk
-    std::memcpy(out_header.fmt, "fmt ", 4);
-    out_header.fmt_size = 16;
-    out_header.audio_format = 3; // IEEE float
-    out_header.num_channels = header.num_channels;
-    out_header.sample_rate = header.sample_rate;
-    out_header.bits_per_sample = 32;
-    out_header.block_align = out_header.num_channels * 4;
-    out_header.byte_rate = out_header.sample_rate * out_header.block_align;
-
-    // data chunk
-    std::memcpy(out_header.data, "data", 4);
-    out_header.data_size = samples.size() * sizeof(float);
-    out_header.file_size = 36 + out_header.data_size;
-
-    file.write(reinterpret_cast<const char*>(&out_header), sizeof(WAVHeader));
-
-    // Write audio data as 32-bit float
-    file.write(reinterpret_cast<const char*>(samples.data()), samples.size() * sizeof(float));
+private:
+    Slot slots_[2];
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    bool failed_ = false;
+};
 
-    std::cout << "Output file: " << filename << std::endl;
-    std::cout << "  Format: 32-bit float" << std::endl;
+/**
+ * @brief I/O thread: write back processed blocks, read the next ones
+ */
+void runIO(BlockPipeline& pipeline, WAVReader& reader, WAVWriter& writer) {
+    using State = BlockPipeline::State;
+
+    for (uint64_t block = 0;; block++) {
+        // Block - 2 used this slot; write it before reusing the slot
+        pipeline.wait(block, State::Empty, State::Processed);
+        if (pipeline.failed()) return;
+
+        BlockPipeline::Slot& slot = pipeline.slot(block);
+        if (slot.state == State::Processed && !writer.write(slot.samples.data(), slot.frames)) {
+            pipeline.fail();
+            return;
+        }
 
-    return true;
+        slot.frames = reader.read(slot.samples.data());
+        if (slot.frames == 0) {
+            pipeline.publish(block, State::End);
+
+            // Flush the last block still in flight
+            if (block > 0) {
+                pipeline.wait(block - 1, State::Processed, State::Processed);
+                if (pipeline.failed()) return;
+                BlockPipeline::Slot& last = pipeline.slot(block - 1);
+                if (!writer.write(last.samples.data(), last.frames)) {
+                    pipeline.fail();
+                }
+            }
+            return;
+        }
+        pipeline.publish(block, State::Filled);
+    }
 }
 
 // ============================================================================
@@ -289,9 +238,15 @@ void createVocalEnhancePreset(radioform_preset_t* preset) {
 // ============================================================================
 
 int main(int argc, char* argv[]) {
+    if (argc > 1 && strcmp(argv[1], "--batch") == 0) {
+        return runBatch(argc - 2, argv + 2);
+    }
+
     if (argc < 3) {
         std::cout << "Radioform DSP WAV Processor" << std::endl;
         std::cout << "Usage: " << argv[0] << " input.wav output.wav [preset]" << std::endl;
+        std::cout << "       " << argv[0] << " --batch output_dir --presets a.json [b.json ...]"
+                  << " --inputs x.wav [y.wav ...] [--threads N]" << std::endl;
         std::cout << std::endl;
         std::cout << "Presets:" << std::endl;
         std::cout << "  bass   - Heavy bass boost (default)" << std::endl;
@@ -305,13 +260,13 @@ int main(int argc, char* argv[]) {
     const char* output_file = argv[2];
     const char* preset_name = (argc > 3) ? argv[3] : "bass";
 
-    // Read input WAV file
-    WAVHeader header;
-    std::vector<float> samples;
-
-    if (!readWAV(input_file, header, samples)) {
+    // Open input WAV file (only the header is read here)
+    WAVReader reader;
+    if (!reader.open(input_file)) {
         return 1;
     }
+    const WAVHeader& header = reader.header();
+    reader.printInfo(input_file);
 
     // WAV processor currently supports stereo input.
     if (header.num_channels != 2) {
@@ -348,11 +303,38 @@ int main(int argc, char* argv[]) {
         return 1;
     }
 
-    // Process audio
+    WAVWriter writer;
+    if (!writer.open(output_file, header)) {
+        radioform_dsp_destroy(engine);
+        return 1;
+    }
+
+    // Process audio: the I/O thread streams blocks in and out around the DSP
     std::cout << "Processing audio..." << std::endl;
 
-    uint32_t num_frames = samples.size() / 2;
-    radioform_dsp_process_interleaved(engine, samples.data(), samples.data(), num_frames);
+    using State = BlockPipeline::State;
+    BlockPipeline pipeline(header.num_channels);
+    std::thread io_thread(runIO, std::ref(pipeline), std::ref(reader), std::ref(writer));
+
+    uint64_t num_frames = 0;
+    for (uint64_t block = 0;; block++) {
+        pipeline.wait(block, State::Filled, State::End);
+        BlockPipeline::Slot& slot = pipeline.slot(block);
+        if (pipeline.failed() || slot.state == State::End) {
+            break;
+        }
+
+        radioform_dsp_process_interleaved(engine, slot.samples.data(), slot.samples.data(), slot.frames);
+        num_frames += slot.frames;
+        pipeline.publish(block, State::Processed);
+    }
+    io_thread.join();
+
+    if (pipeline.failed()) {
+        std::cerr << "Error: Failed writing output file: " << output_file << std::endl;
+        radioform_dsp_destroy(engine);
+        return 1;
+    }
 
     std::cout << "Processed " << num_frames << " frames" << std::endl;
 
@@ -361,12 +343,14 @@ int main(int argc, char* argv[]) {
     radioform_dsp_get_stats(engine, &stats);
     std::cout << "Total frames processed: " << stats.frames_processed << std::endl;
 
-    // Write output WAV file
+    // Finish output WAV file
     std::cout << std::endl;
-    if (!writeWAV(output_file, header, samples)) {
+    if (!writer.finish(output_file)) {
         radioform_dsp_destroy(engine);
         return 1;
     }
+    std::cout << "Output file: " << output_file << std::endl;
+    std::cout << "  Format: 32-bit float" << std::endl;
 
     // Cleanup
     radioform_dsp_destroy(engine);
@@ -0,0 +1,145 @@
+/**
+ * @file work_stealing_pool.h
+ * @brief Work-stealing thread pool for the batch renderer
+ *
+ * Every worker owns a deque: it pushes and pops its own tasks at the back
+ * (newest first, so a task's children run while its data is hot) and idle
+ * workers steal from the front of the others (oldest first). Tasks are
+ * coarse (decode a file, render a file through a preset), so each deque is
+ * a mutex-protected std::deque rather than a lock-free one.
+ */
+
+#ifndef RADIOFORM_TOOLS_WORK_STEALING_POOL_H
+#define RADIOFORM_TOOLS_WORK_STEALING_POOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+class WorkStealingPool {
+public:
+    using Task = std::function<void()>;
+
+    explicit WorkStealingPool(size_t num_threads)
+        : queues_(num_threads)
+    {
+        for (size_t i = 0; i < num_threads; i++) {
+            queues_[i] = std::make_unique<Queue>();
+        }
+    }
+
+    size_t size() const { return queues_.size(); }
+
+    /**
+     * @brief Queue a task
+     *
+     * From a worker the task goes to that worker's own deque; from outside
+     * the pool, tasks are spread round-robin.
+     */
+    void submit(Task task) {
+        size_t index = (current_pool_ == this) ? current_index_
+                                               : next_queue_++ % queues_.size();
+        pending_.fetch_add(1);
+        {
+            // Counted before the push so queued_ never drops below the deques' contents
+            std::lock_guard<std::mutex> lock(idle_mutex_);
+            queued_++;
+        }
+        {
+            std::lock_guard<std::mutex> lock(queues_[index]->mutex);
+            queues_[index]->tasks.push_back(std::move(task));
+        }
+        idle_cv_.notify_one();
+    }
+
+    /**
+     * @brief Start the workers and block until every task (and its children) ran
+     */
+    void run() {
+        std::vector<std::thread> threads;
+        for (size_t i = 0; i < queues_.size(); i++) {
+            threads.emplace_back([this, i] { workerLoop(i); });
+        }
+        for (std::thread& thread : threads) {
+            thread.join();
+        }
+    }
+
+private:
+    struct Queue {
+        std::mutex mutex;
+        std::deque<Task> tasks;
+    };
+
+    bool popLocal(size_t index, Task& task) {
+        Queue& queue = *queues_[index];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        if (queue.tasks.empty()) return false;
+        task = std::move(queue.tasks.back());
+        queue.tasks.pop_back();
+        queued_--;
+        return true;
+    }
+
+    bool steal(size_t thief, Task& task) {
+        for (size_t offset = 1; offset < queues_.size(); offset++) {
+            Queue& victim = *queues_[(thief + offset) % queues_.size()];
+            std::lock_guard<std::mutex> lock(victim.mutex);
+            if (!victim.tasks.empty()) {
+                task = std::move(victim.tasks.front());
+                victim.tasks.pop_front();
+                queued_--;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void workerLoop(size_t index) {
+        current_pool_ = this;
+        current_index_ = index;
+
+        while (true) {
+            Task task;
+            if (popLocal(index, task) || steal(index, task)) {
+                task();
+                if (pending_.fetch_sub(1) == 1) {
+                    // Last task finished: wake everyone so they can exit
+                    std::lock_guard<std::mutex> lock(idle_mutex_);
+                    idle_cv_.notify_all();
+                }
+                continue;
+            }
+
+            // Sleep until something is queued or everything (children included) ran
+            std::unique_lock<std::mutex> lock(idle_mutex_);
+            idle_cv_.wait(lock, [this] { return queued_.load() > 0 || pending_.load() == 0; });
+            if (pending_.load() == 0) {
+                break;
+            }
+        }
+
+        current_pool_ = nullptr;
+    }
+
+    std::vector<std::unique_ptr<Queue>> queues_;
+    std::atomic<size_t> pending_{0};  // Queued or running
+    std::atomic<size_t> queued_{0};   // Queued only
+    std::atomic<size_t> next_queue_{0};
+    std::mutex idle_mutex_;
+    std::condition_variable idle_cv_;
+
+    static thread_local WorkStealingPool* current_pool_;
+    static thread_local size_t current_index_;
+};
+
+inline thread_local WorkStealingPool* WorkStealingPool::current_pool_ = nullptr;
+inline thread_local size_t WorkStealingPool::current_index_ = 0;
+
+#endif // RADIOFORM_TOOLS_WORK_STEALING_POOL_H